@@ -293,14 +293,14 @@ void Java_org_deadc0de_apple2ix_Apple2Activity_nativeReboot(JNIEnv *env, jclass
     if (resetState) {
         // joystick button settings should be balanced by joystick_reset() triggered on CPU thread
         if (resetState == 1) {
-            run_args.joy_button0 = 0xff;
-            run_args.joy_button1 = 0x0;
+            replay_input(REPLAY_INPUT_BUTTON0, 0xff);
+            replay_input(REPLAY_INPUT_BUTTON1, 0x0);
         } else {
-            run_args.joy_button0 = 0x0;
-            run_args.joy_button1 = 0xff;
+            replay_input(REPLAY_INPUT_BUTTON0, 0x0);
+            replay_input(REPLAY_INPUT_BUTTON1, 0xff);
         }
     }
-    cpu65_interrupt(ResetSig);
+    replay_input(REPLAY_INPUT_RESET, 0);
 }
 
 void Java_org_deadc0de_apple2ix_Apple2Activity_nativeOnQuit(JNIEnv *env, jclass cls) {
@@ -489,10 +489,12 @@ void Java_org_deadc0de_apple2ix_Apple2Activity_nativeSaveState(JNIEnv *env, jcla
 
     (*env)->ReleaseStringUTFChars(env, jJsonString, jsonString); jsonString = NULL;
 
+    // repeated quick saves to the same file append delta frames (saveStateDelta truncates and writes a full snapshot
+    // itself when the file is new or was changed behind our back)
     int fdState = -1;
-    _openFdFromJson(&fdState, jsonData, /*fdKey:*/"fdState", /*pathKey:*/"stateFile", O_WRONLY|O_CREAT|O_TRUNC, S_IRUSR|S_IWUSR);
+    _openFdFromJson(&fdState, jsonData, /*fdKey:*/"fdState", /*pathKey:*/"stateFile", O_RDWR|O_CREAT, S_IRUSR|S_IWUSR);
 
-    if (!emulator_saveState(fdState)) {
+    if (!emulator_saveStateDelta(fdState)) {
         LOG("OOPS, could not save emulator state");
     }
 
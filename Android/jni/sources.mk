@@ -36,12 +36,15 @@ APPLE2_AUDIO_SRC = \
     $(APPLE2_SRC_PATH)/audio/speaker.c
 
 APPLE2_META_SRC = \
+    $(APPLE2_SRC_PATH)/meta/cputrace.c \
     $(APPLE2_SRC_PATH)/meta/debug.c \
     $(APPLE2_SRC_PATH)/meta/debugger.c \
     $(APPLE2_SRC_PATH)/meta/systrace.c \
     $(APPLE2_SRC_PATH)/meta/log.c \
     $(APPLE2_SRC_PATH)/meta/memmngt.c \
     $(APPLE2_SRC_PATH)/meta/opcodes.c \
+    $(APPLE2_SRC_PATH)/meta/profiler.c \
+    $(APPLE2_SRC_PATH)/meta/replay.c \
     $(APPLE2_SRC_PATH)/test/sha1.c \
 
 APPLE2_MAIN_SRC = \
@@ -51,6 +54,7 @@ APPLE2_MAIN_SRC = \
     $(APPLE2_SRC_PATH)/disk.c \
     $(APPLE2_SRC_PATH)/display.c \
     $(APPLE2_SRC_PATH)/font.c \
+    $(APPLE2_SRC_PATH)/hdd.c \
     $(APPLE2_SRC_PATH)/interface.c \
     $(APPLE2_SRC_PATH)/joystick.c \
     $(APPLE2_SRC_PATH)/json_parse.c \
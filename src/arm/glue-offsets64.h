@@ -51,3 +51,10 @@
 #define JOY_BUTTON0 274
 #define JOY_BUTTON1 275
 #define EMUL_REINITIALIZE 276
+#define CPU65_HALTED 277
+#define CPU65_OPERAND 278
+#define CPU65_VMEM_RBASE 280
+#define CPU65__OPBYTES 288
+#define CPU65_VMEM_WBASE 296
+#define CPU65_HALTMAP 304
+#define CPU65_PROFILE 312
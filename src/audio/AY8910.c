@@ -54,6 +54,13 @@
 #       include "greatest.h"
 #       undef fprintf // greatest redefines fprintf on Droid!
 #   endif
+#   if defined(__SSE2__)
+#       define AY_SSE2 1
+#       include <emmintrin.h>
+#   elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#       define AY_NEON 1
+#       include <arm_neon.h>
+#   endif
 #endif
 
 /* The AY white noise RNG algorithm is based on info from MAME's ay8910.c -
@@ -509,6 +516,166 @@ sound_write_buf_pstereo( libspectrum_signed_word * out, int c )
 #define HZ_COMMON_DENOMINATOR 50
 #endif
 
+/* apply one queued register change, fixing up derived state as needed */
+static inline void sound_ay_apply_change( CAY8910 *_this, const struct ay_change_tag *change )
+{
+  int reg, r;
+
+  _this->sound_ay_registers[ reg = change->reg ] = change->val;
+
+  /* fix things as needed for some register changes */
+  switch ( reg ) {
+  case 0:
+  case 1:
+  case 2:
+  case 3:
+  case 4:
+  case 5:
+    r = reg >> 1;
+    /* a zero-len period is the same as 1 */
+    _this->ay_tone_period[r] = ( _this->sound_ay_registers[ reg & ~1 ] |
+			  ( _this->sound_ay_registers[ reg | 1 ] & 15 ) << 8 );
+    if( !_this->ay_tone_period[r] )
+      _this->ay_tone_period[r]++;
+
+    /* important to get this right, otherwise e.g. Ghouls 'n' Ghosts
+     * has really scratchy, horrible-sounding vibrato.
+     */
+    if( _this->ay_tone_tick[r] >= _this->ay_tone_period[r] * 2 )
+      _this->ay_tone_tick[r] %= _this->ay_tone_period[r] * 2;
+    break;
+  case 6:
+    _this->ay_noise_tick = 0;
+    _this->ay_noise_period = ( _this->sound_ay_registers[ reg ] & 31 );
+    break;
+  case 11:
+  case 12:
+    /* this one *isn't* fixed-point */
+    _this->ay_env_period =
+      _this->sound_ay_registers[11] | ( _this->sound_ay_registers[12] << 8 );
+    break;
+  case 13:
+    _this->ay_env_internal_tick = _this->ay_env_tick = _this->ay_env_subcycles = 0;
+    _this->env_first = 1;
+    _this->env_rev = 0;
+    _this->env_counter = ( _this->sound_ay_registers[13] & AY_ENV_ATTACK ) ? 0 : 15;
+    break;
+  }
+}
+
+/* advance the envelope by one output sample, returns the number of
+ * 16-AY-cycle steps taken (which also clock the noise generator)
+ */
+static inline unsigned int sound_ay_env_advance( CAY8910 *_this, int envshape )
+{
+  unsigned int noise_count = 0;
+
+  /* envelope output counter gets incr'd every 16 AY cycles.
+   * Has to be a while, as this is sub-output-sample res.
+   */
+  _this->ay_env_subcycles += _this->ay_tick_incr;
+  while( _this->ay_env_subcycles >= ( 16 << 16 ) ) {
+    _this->ay_env_subcycles -= ( 16 << 16 );
+    noise_count++;
+    _this->ay_env_tick++;
+    while( _this->ay_env_tick >= _this->ay_env_period ) {
+      _this->ay_env_tick -= _this->ay_env_period;
+
+      /* do a 1/16th-of-period incr/decr if needed */
+      if( _this->env_first ||
+	  ( ( envshape & AY_ENV_CONT ) && !( envshape & AY_ENV_HOLD ) ) ) {
+	if( _this->env_rev )
+	  _this->env_counter -= ( envshape & AY_ENV_ATTACK ) ? 1 : -1;
+	else
+	  _this->env_counter += ( envshape & AY_ENV_ATTACK ) ? 1 : -1;
+	if( _this->env_counter < 0 )
+	  _this->env_counter = 0;
+	if( _this->env_counter > 15 )
+	  _this->env_counter = 15;
+      }
+
+      _this->ay_env_internal_tick++;
+      while( _this->ay_env_internal_tick >= 16 ) {
+	_this->ay_env_internal_tick -= 16;
+
+	/* end of cycle */
+	if( !( envshape & AY_ENV_CONT ) )
+	  _this->env_counter = 0;
+	else {
+	  if( envshape & AY_ENV_HOLD ) {
+	    if( _this->env_first && ( envshape & AY_ENV_ALT ) )
+	      _this->env_counter = ( _this->env_counter ? 0 : 15 );
+	  } else {
+	    /* non-hold */
+	    if( envshape & AY_ENV_ALT )
+	      _this->env_rev = !_this->env_rev;
+	    else
+	      _this->env_counter = ( envshape & AY_ENV_ATTACK ) ? 0 : 15;
+	  }
+	}
+
+	_this->env_first = 0;
+      }
+
+      /* don't keep trying if period is zero */
+      if( !_this->ay_env_period )
+	break;
+    }
+  }
+
+  return noise_count;
+}
+
+/* advance the tone clock by one output sample, returns the number of
+ * 8-AY-cycle tone ticks elapsed
+ */
+static inline unsigned int sound_ay_tone_advance( CAY8910 *_this )
+{
+  unsigned int tone_count;
+
+  _this->ay_tone_subcycles += _this->ay_tick_incr;
+  tone_count = _this->ay_tone_subcycles >> ( 3 + 16 );
+  _this->ay_tone_subcycles &= ( 8 << 16 ) - 1;
+
+  return tone_count;
+}
+
+/* update noise RNG/filter */
+static inline void sound_ay_noise_advance( CAY8910 *_this, unsigned int noise_count )
+{
+  _this->ay_noise_tick += noise_count;
+  while( _this->ay_noise_tick >= _this->ay_noise_period ) {
+    _this->ay_noise_tick -= _this->ay_noise_period;
+
+    if( ( _this->rng & 1 ) ^ ( ( _this->rng & 2 ) ? 1 : 0 ) )
+      _this->noise_toggle = !_this->noise_toggle;
+
+    /* rng is 17-bit shift reg, bit 0 is output.
+     * input is bit 0 xor bit 2.
+     */
+    _this->rng |= ( ( _this->rng & 1 ) ^ ( ( _this->rng & 4 ) ? 1 : 0 ) ) ? 0x20000 : 0;
+    _this->rng >>= 1;
+
+    /* don't keep trying if period is zero */
+    if( !_this->ay_noise_period )
+      break;
+  }
+}
+
+/* convert change times to sample offsets, use common denominator of 50 to
+   avoid overflowing a dword */
+static void sound_ay_change_offsets(CAY8910 *_this)
+{
+  libspectrum_dword sfreq, cpufreq;
+  int f;
+
+  sfreq = sound_generator_freq / HZ_COMMON_DENOMINATOR;
+//  cpufreq = machine_current->timings.processor_speed / HZ_COMMON_DENOMINATOR;
+  cpufreq = (libspectrum_dword) (m_fCurrentCLK_AY8910 / HZ_COMMON_DENOMINATOR);	// [TC]
+  for( f = 0; f < _this->ay_change_count; f++ )
+    _this->ay_change[f].ofs = (uint16_t) (( _this->ay_change[f].tstates * sfreq ) / cpufreq);	// [TC] Added cast
+}
+
 static void sound_ay_overlay(CAY8910 *_this)
 {
   int tone_level[3];
@@ -517,23 +684,15 @@ static void sound_ay_overlay(CAY8910 *_this)
 //  libspectrum_signed_word *ptr;
   struct ay_change_tag *change_ptr = _this->ay_change;
   int changes_left = _this->ay_change_count;
-  int reg, r;
   int is_low;
   int chan1, chan2, chan3;
   unsigned int tone_count, noise_count;
-  libspectrum_dword sfreq, cpufreq;
 
 ///* If no AY chip, don't produce any AY sound (!) */
 //  if( !machine_current->capabilities & LIBSPECTRUM_MACHINE_CAPABILITY_AY )
 //    return;
 
-/* convert change times to sample offsets, use common denominator of 50 to
-   avoid overflowing a dword */
-  sfreq = sound_generator_freq / HZ_COMMON_DENOMINATOR;
-//  cpufreq = machine_current->timings.processor_speed / HZ_COMMON_DENOMINATOR;
-  cpufreq = (libspectrum_dword) (m_fCurrentCLK_AY8910 / HZ_COMMON_DENOMINATOR);	// [TC]
-  for( f = 0; f < _this->ay_change_count; f++ )
-    _this->ay_change[f].ofs = (uint16_t) (( _this->ay_change[f].tstates * sfreq ) / cpufreq);	// [TC] Added cast
+  sound_ay_change_offsets(_this);
 
   libspectrum_signed_word* pBuf1 = g_ppSoundBuffers[0];
   libspectrum_signed_word* pBuf2 = g_ppSoundBuffers[1];
@@ -547,48 +706,9 @@ static void sound_ay_overlay(CAY8910 *_this)
      * glitches.
      */
     while( changes_left && f >= change_ptr->ofs ) {
-      _this->sound_ay_registers[ reg = change_ptr->reg ] = change_ptr->val;
+      sound_ay_apply_change( _this, change_ptr );
       change_ptr++;
       changes_left--;
-
-      /* fix things as needed for some register changes */
-      switch ( reg ) {
-      case 0:
-      case 1:
-      case 2:
-      case 3:
-      case 4:
-      case 5:
-	r = reg >> 1;
-	/* a zero-len period is the same as 1 */
-	_this->ay_tone_period[r] = ( _this->sound_ay_registers[ reg & ~1 ] |
-			      ( _this->sound_ay_registers[ reg | 1 ] & 15 ) << 8 );
-	if( !_this->ay_tone_period[r] )
-	  _this->ay_tone_period[r]++;
-
-	/* important to get this right, otherwise e.g. Ghouls 'n' Ghosts
-	 * has really scratchy, horrible-sounding vibrato.
-	 */
-	if( _this->ay_tone_tick[r] >= _this->ay_tone_period[r] * 2 )
-	  _this->ay_tone_tick[r] %= _this->ay_tone_period[r] * 2;
-	break;
-      case 6:
-	_this->ay_noise_tick = 0;
-	_this->ay_noise_period = ( _this->sound_ay_registers[ reg ] & 31 );
-	break;
-      case 11:
-      case 12:
-	/* this one *isn't* fixed-point */
-	_this->ay_env_period =
-	  _this->sound_ay_registers[11] | ( _this->sound_ay_registers[12] << 8 );
-	break;
-      case 13:
-	_this->ay_env_internal_tick = _this->ay_env_tick = _this->ay_env_subcycles = 0;
-	_this->env_first = 1;
-	_this->env_rev = 0;
-	_this->env_counter = ( _this->sound_ay_registers[13] & AY_ENV_ATTACK ) ? 0 : 15;
-	break;
-      }
     }
 
     /* the tone level if no enveloping is being used */
@@ -603,59 +723,7 @@ static void sound_ay_overlay(CAY8910 *_this)
       if( _this->sound_ay_registers[ 8 + g ] & 16 )
 	tone_level[g] = level;
 
-    /* envelope output counter gets incr'd every 16 AY cycles.
-     * Has to be a while, as this is sub-output-sample res.
-     */
-    _this->ay_env_subcycles += _this->ay_tick_incr;
-    noise_count = 0;
-    while( _this->ay_env_subcycles >= ( 16 << 16 ) ) {
-      _this->ay_env_subcycles -= ( 16 << 16 );
-      noise_count++;
-      _this->ay_env_tick++;
-      while( _this->ay_env_tick >= _this->ay_env_period ) {
-	_this->ay_env_tick -= _this->ay_env_period;
-
-	/* do a 1/16th-of-period incr/decr if needed */
-	if( _this->env_first ||
-	    ( ( envshape & AY_ENV_CONT ) && !( envshape & AY_ENV_HOLD ) ) ) {
-	  if( _this->env_rev )
-	    _this->env_counter -= ( envshape & AY_ENV_ATTACK ) ? 1 : -1;
-	  else
-	    _this->env_counter += ( envshape & AY_ENV_ATTACK ) ? 1 : -1;
-	  if( _this->env_counter < 0 )
-	    _this->env_counter = 0;
-	  if( _this->env_counter > 15 )
-	    _this->env_counter = 15;
-	}
-
-	_this->ay_env_internal_tick++;
-	while( _this->ay_env_internal_tick >= 16 ) {
-	  _this->ay_env_internal_tick -= 16;
-
-	  /* end of cycle */
-	  if( !( envshape & AY_ENV_CONT ) )
-	    _this->env_counter = 0;
-	  else {
-	    if( envshape & AY_ENV_HOLD ) {
-	      if( _this->env_first && ( envshape & AY_ENV_ALT ) )
-		_this->env_counter = ( _this->env_counter ? 0 : 15 );
-	    } else {
-	      /* non-hold */
-	      if( envshape & AY_ENV_ALT )
-		_this->env_rev = !_this->env_rev;
-	      else
-		_this->env_counter = ( envshape & AY_ENV_ATTACK ) ? 0 : 15;
-	    }
-	  }
-
-	  _this->env_first = 0;
-	}
-
-	/* don't keep trying if period is zero */
-	if( !_this->ay_env_period )
-	  break;
-      }
-    }
+    noise_count = sound_ay_env_advance( _this, envshape );
 
     /* generate tone+noise... or neither.
      * (if no tone/noise is selected, the chip just shoves the
@@ -667,9 +735,7 @@ static void sound_ay_overlay(CAY8910 *_this)
     chan3 = tone_level[2];
     mixer = _this->sound_ay_registers[7];
 
-    _this->ay_tone_subcycles += _this->ay_tick_incr;
-    tone_count = _this->ay_tone_subcycles >> ( 3 + 16 );
-    _this->ay_tone_subcycles &= ( 8 << 16 ) - 1;
+    tone_count = sound_ay_tone_advance( _this );
 
     if( ( mixer & 1 ) == 0 ) {
       level = chan1;
@@ -728,27 +794,129 @@ static void sound_ay_overlay(CAY8910 *_this)
     }
 #endif
 
-    /* update noise RNG/filter */
-    _this->ay_noise_tick += noise_count;
-    while( _this->ay_noise_tick >= _this->ay_noise_period ) {
-      _this->ay_noise_tick -= _this->ay_noise_period;
+    sound_ay_noise_advance( _this, noise_count );
+  }
+}
 
-      if( ( _this->rng & 1 ) ^ ( ( _this->rng & 2 ) ? 1 : 0 ) )
-	_this->noise_toggle = !_this->noise_toggle;
+#ifdef APPLE2IX
+/* Block renderer : produces the same samples as sound_ay_overlay(), but walks the frame in runs between register
+ * changes.  Within a run the mixer, volumes and periods are constant, so the shared envelope/tone-clock/noise state is
+ * stepped once per sample into small arrays, and then each channel is rendered with its mixer/volume branches hoisted
+ * out of the sample loop.  Volume fills and noise gating are done 8 samples at a time.
+ */
+#define AY_BLOCK_MAX 256
 
-      /* rng is 17-bit shift reg, bit 0 is output.
-       * input is bit 0 xor bit 2.
-       */
-      _this->rng |= ( ( _this->rng & 1 ) ^ ( ( _this->rng & 4 ) ? 1 : 0 ) ) ? 0x20000 : 0;
-      _this->rng >>= 1;
+static ay8910_renderer_t ay_renderer = AY8910_RENDERER_BLOCK;
 
-      /* don't keep trying if period is zero */
-      if( !_this->ay_noise_period )
-	break;
+static inline void sound_ay_block_fill(libspectrum_signed_word *out, int level, int n)
+{
+  int i = 0;
+#if AY_SSE2
+  const __m128i vlevel = _mm_set1_epi16((short)level);
+  for( ; i + 8 <= n; i += 8 )
+    _mm_storeu_si128((__m128i *)(out + i), vlevel);
+#elif AY_NEON
+  const int16x8_t vlevel = vdupq_n_s16((int16_t)level);
+  for( ; i + 8 <= n; i += 8 )
+    vst1q_s16(out + i, vlevel);
+#endif
+  for( ; i < n; i++ )
+    out[i] = level;
+}
+
+static inline void sound_ay_block_gate(libspectrum_signed_word *out, const libspectrum_signed_word *keep, int n)
+{
+  int i = 0;
+#if AY_SSE2
+  for( ; i + 8 <= n; i += 8 ) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(out + i));
+    v = _mm_and_si128(v, _mm_loadu_si128((const __m128i *)(keep + i)));
+    _mm_storeu_si128((__m128i *)(out + i), v);
+  }
+#elif AY_NEON
+  for( ; i + 8 <= n; i += 8 )
+    vst1q_s16(out + i, vandq_s16(vld1q_s16(out + i), vld1q_s16(keep + i)));
+#endif
+  for( ; i < n; i++ )
+    out[i] &= keep[i];
+}
+
+static void sound_ay_overlay_block(CAY8910 *_this)
+{
+  libspectrum_signed_word env_level[AY_BLOCK_MAX];
+  libspectrum_signed_word noise_keep[AY_BLOCK_MAX];
+  unsigned int tone_counts[AY_BLOCK_MAX];
+  struct ay_change_tag *change_ptr = _this->ay_change;
+  int changes_left = _this->ay_change_count;
+  int mixer, envshape, vol;
+  int f, g, i, n, end, level, count, is_low, chan;
+  unsigned int tone_count;
+
+  sound_ay_change_offsets(_this);
+
+  for( f = 0; f < sound_generator_framesiz; f = end ) {
+    while( changes_left && f >= change_ptr->ofs ) {
+      sound_ay_apply_change( _this, change_ptr );
+      change_ptr++;
+      changes_left--;
+    }
+
+    /* run extends to the next pending change (or end of frame) */
+    end = sound_generator_framesiz;
+    if( changes_left && change_ptr->ofs < end )
+      end = change_ptr->ofs;
+    if( end - f > AY_BLOCK_MAX )
+      end = f + AY_BLOCK_MAX;
+    n = end - f;
+
+    /* shared state, in the same per-sample order as sound_ay_overlay() */
+    envshape = _this->sound_ay_registers[13];
+    for( i = 0; i < n; i++ ) {
+      unsigned int noise_count;
+      env_level[i] = ay_tone_levels[ _this->env_counter ];
+      noise_count = sound_ay_env_advance( _this, envshape );
+      tone_counts[i] = sound_ay_tone_advance( _this );
+      noise_keep[i] = _this->noise_toggle ? 0 : -1;
+      sound_ay_noise_advance( _this, noise_count );
+    }
+
+    mixer = _this->sound_ay_registers[7];
+    for( g = 0; g < 3; g++ ) {
+      libspectrum_signed_word *out = g_ppSoundBuffers[g] + f;
+
+      vol = _this->sound_ay_registers[ 8 + g ];
+      if( vol & 16 )
+        memcpy(out, env_level, n * sizeof(*out));
+      else
+        sound_ay_block_fill(out, ay_tone_levels[ vol & 15 ], n);
+
+      if( ( mixer & ( 1 << g ) ) == 0 ) {
+        for( i = 0; i < n; i++ ) {
+          level = out[i];
+          tone_count = tone_counts[i];
+          AY_DO_TONE( chan, g );
+          out[i] = chan;
+        }
+      }
+
+      if( ( mixer & ( 0x08 << g ) ) == 0 )
+        sound_ay_block_gate(out, noise_keep, n);
     }
   }
 }
 
+void AY8910_setRenderer(ay8910_renderer_t renderer)
+{
+  assert(renderer < NUM_AY8910_RENDERERS);
+  ay_renderer = renderer;
+}
+
+ay8910_renderer_t AY8910_getRenderer(void)
+{
+  return ay_renderer;
+}
+#endif
+
 // AppleWin:TC  Holding down ScrollLock will result in lots of AY changes /ay_change_count/
 //              - since sound_ay_overlay() is called to consume them.
 
@@ -882,6 +1050,11 @@ void sound_frame( CAY8910 *_this )
 #endif
 
 /* overlay AY sound */
+#ifdef APPLE2IX
+  if( ay_renderer == AY8910_RENDERER_BLOCK )
+    sound_ay_overlay_block(_this);
+  else
+#endif
   sound_ay_overlay(_this);
 
 #ifdef HAVE_SAMPLERATE
@@ -1539,9 +1712,9 @@ bool CAY8910::LoadSnapshot(YamlLoadHelper& yamlLoadHelper, std::string& suffix)
 #include "CPU.h"	// For g_nCumulativeCycles
 #endif
 
-static CAY8910 g_AY8910[MAX_8910];
+static VM_LOCAL CAY8910 g_AY8910[MAX_8910];
 #ifdef APPLE2IX
-static uint64_t g_uLastCumulativeCycles = 0;
+static VM_LOCAL uint64_t g_uLastCumulativeCycles = 0;
 #else
 static unsigned __int64 g_uLastCumulativeCycles = 0;
 #endif
@@ -1653,6 +1826,45 @@ bool _ay8910_loadState(StateHelper_s *helper, unsigned int chip) {
 int _ay8910_testAssertA2V2(unsigned int chip, uint8_t **exData) {
     return _testStateA2V2(&g_AY8910[chip], exData);
 }
+
+static double testCLK = 0.0;
+static int testFreq = 0;
+
+void _ay8910_testInitChip(struct CAY8910 *chip, int nClock, unsigned long nSampleRate) {
+    testCLK = (double)nClock;
+    testFreq = (int)nSampleRate;
+
+    double savedCLK = m_fCurrentCLK_AY8910;
+    int savedFreq = sound_generator_freq;
+    int savedFramesiz = sound_generator_framesiz;
+
+    SetCLK((double)nClock);
+    memset(chip, 0, sizeof(*chip));
+    sound_init(chip, NULL, nSampleRate);
+    sound_ay_reset(chip);
+
+    SetCLK(savedCLK);
+    sound_generator_freq = savedFreq;
+    sound_generator_framesiz = savedFramesiz;
+}
+
+void _ay8910_testRenderFrame(struct CAY8910 *chip, int16_t **buffers, int nNumSamples) {
+    libspectrum_signed_word **savedBuffers = g_ppSoundBuffers;
+    int savedFramesiz = sound_generator_framesiz;
+    int savedFreq = sound_generator_freq;
+    double savedCLK = m_fCurrentCLK_AY8910;
+
+    SetCLK(testCLK);
+    sound_generator_freq = testFreq;
+    sound_generator_framesiz = nNumSamples;
+    g_ppSoundBuffers = buffers;
+    sound_frame(chip);
+
+    SetCLK(savedCLK);
+    sound_generator_freq = savedFreq;
+    g_ppSoundBuffers = savedBuffers;
+    sound_generator_framesiz = savedFramesiz;
+}
 #   endif
 
 #else
@@ -33,10 +33,25 @@ uint8_t* AY8910_GetRegsPtr(unsigned int uChip);
 void AY8910UpdateSetCycles(void);
 
 #if 1 // APPLE2IX
+typedef enum ay8910_renderer_t {
+    AY8910_RENDERER_SCALAR = 0,     // per-sample FUSE path
+    AY8910_RENDERER_BLOCK,          // runs between register changes, SIMD fills/gating
+    NUM_AY8910_RENDERERS,
+} ay8910_renderer_t;
+
+// Select the AY sample renderer (both produce identical output)
+void AY8910_setRenderer(ay8910_renderer_t renderer);
+ay8910_renderer_t AY8910_getRenderer(void);
+
 bool _ay8910_saveState(StateHelper_s *helper, unsigned int chip);
 bool _ay8910_loadState(StateHelper_s *helper, unsigned int chip);
 #   if TESTING
 int _ay8910_testAssertA2V2(unsigned int chip, uint8_t **exData);
+struct CAY8910;
+// Reset a free-standing chip for the given AY clock and sample rate without disturbing the Mockingboard chips
+void _ay8910_testInitChip(struct CAY8910 *chip, int nClock, unsigned long nSampleRate);
+// Render nNumSamples of a free-standing chip into three channel buffers with the current renderer
+void _ay8910_testRenderFrame(struct CAY8910 *chip, int16_t **buffers, int nNumSamples);
 #   endif
 #else
 UINT AY8910_SaveSnapshot(class YamlSaveHelper& yamlSaveHelper, UINT uChip, std::string& suffix);
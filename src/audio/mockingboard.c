@@ -118,6 +118,13 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #           include "greatest.h"
 #           undef fprintf // greatest redefines fprintf on Droid!
 #       endif
+#       if defined(__SSE2__)
+#           define MB_MIX_SSE2 1
+#           include <emmintrin.h>
+#       elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#           define MB_MIX_NEON 1
+#           include <arm_neon.h>
+#       endif
 
 #if defined(FAILED)
 #undef FAILED
@@ -194,13 +201,13 @@ typedef struct
 
 
 // Support 2 MB's, each with 2x SY6522/AY8910 pairs.
-static SY6522_AY8910 g_MB[NUM_AY8910];
+static VM_LOCAL SY6522_AY8910 g_MB[NUM_AY8910];
 
 // Timer vars
-static unsigned long g_n6522TimerPeriod = 0;
+static VM_LOCAL unsigned long g_n6522TimerPeriod = 0;
 #define TIMERDEVICE_INVALID -1
-static unsigned int g_nMBTimerDevice = TIMERDEVICE_INVALID;	// SY6522 device# which is generating timer IRQ
-static unsigned long g_uLastCumulativeCycles = 0;
+static VM_LOCAL unsigned int g_nMBTimerDevice = TIMERDEVICE_INVALID;	// SY6522 device# which is generating timer IRQ
+static VM_LOCAL unsigned long g_uLastCumulativeCycles = 0;
 
 // SSI263 vars:
 static uint16_t g_nSSI263Device = 0;	// SSI263 device# which is generating phoneme-complete IRQ
@@ -215,16 +222,16 @@ static float samplesScale = 1.f;
 static const DWORD SAMPLE_RATE = 44100;	// Use a base freq so that DirectX (or sound h/w) doesn't have to up/down-sample
 #endif
 
-static short* ppAYVoiceBuffer[NUM_VOICES] = {0};
+static VM_LOCAL short* ppAYVoiceBuffer[NUM_VOICES] = {0};
 
 #if 1 // APPLE2IX
 bool g_bDisableDirectSoundMockingboard = false;
-static unsigned long g_nMB_InActiveCycleCount = 0;
+static VM_LOCAL unsigned long g_nMB_InActiveCycleCount = 0;
 #else
 static unsigned __int64	g_nMB_InActiveCycleCount = 0;
 #endif
-static bool g_bMB_RegAccessedFlag = false;
-static bool g_bMB_Active = false;
+static VM_LOCAL bool g_bMB_RegAccessedFlag = false;
+static VM_LOCAL bool g_bMB_Active = false;
 
 #if 1 // APPLE2IX
 static pthread_t g_hThread = 0;
@@ -232,14 +239,14 @@ static pthread_t g_hThread = 0;
 static HANDLE g_hThread = NULL;
 #endif
 
-static bool g_bMBAvailable = false;
+static VM_LOCAL bool g_bMBAvailable = false;
 
 //
 
-static SS_CARDTYPE g_SoundcardType = CT_Empty;	// Use CT_Empty to mean: no soundcard
-static bool g_bPhasorEnable = false;
-static uint8_t g_nPhasorMode = 0;	// 0=Mockingboard emulation, 1=Phasor native
-static unsigned int g_PhasorClockScaleFactor = 1;	// for save-state only
+static VM_LOCAL SS_CARDTYPE g_SoundcardType = CT_Empty;	// Use CT_Empty to mean: no soundcard
+static VM_LOCAL bool g_bPhasorEnable = false;
+static VM_LOCAL uint8_t g_nPhasorMode = 0;	// 0=Mockingboard emulation, 1=Phasor native
+static VM_LOCAL unsigned int g_PhasorClockScaleFactor = 1;	// for save-state only
 
 //-------------------------------------
 
@@ -255,7 +262,7 @@ static const int16_t nWaveDataMin = (int16_t)0x8000;
 static const int16_t nWaveDataMax = (int16_t)0x7FFF;
 
 #if 1 // APPLE2IX
-static short *g_nMixBuffer = NULL;
+static VM_LOCAL short *g_nMixBuffer = NULL;
 #else
 static short g_nMixBuffer[g_dwDSBufferSize / sizeof(short)];
 #endif
@@ -269,7 +276,7 @@ static unsigned long cycles_mb_toggled_r = 0;
 static unsigned long cycles_mb_toggled_w = 0;
 #   endif
 
-static AudioBuffer_s *MockingboardVoice = NULL;
+static VM_LOCAL AudioBuffer_s *MockingboardVoice = NULL;
 static AudioBuffer_s *SSI263Voice[64] = { 0 };
 static pthread_cond_t ssi263_cond = PTHREAD_COND_INITIALIZER;
 static pthread_mutex_t ssi263_mutex = PTHREAD_MUTEX_INITIALIZER;
@@ -289,9 +296,9 @@ static const double g_f6522TimerPeriod_NoIRQ = CLK_6502 / 60.0;		// Constant wha
 //---------------------------------------------------------------------------
 
 // External global vars:
-bool g_bMBTimerIrqActive = false;
+VM_LOCAL bool g_bMBTimerIrqActive = false;
 #if 0 // _DEBUG
-uint32_t g_uTimer1IrqCount = 0;	// DEBUG
+VM_LOCAL uint32_t g_uTimer1IrqCount = 0;	// DEBUG
 #endif
 
 //---------------------------------------------------------------------------
@@ -318,6 +325,32 @@ static void mb_assert(bool condition) {
 
 //---------------------------------------------------------------------------
 
+#if 1 // APPLE2IX
+static void MB_TimerEvent(void);
+
+// Schedule MB_UpdateCycles() for the cycle on which the IRQ-generating timer 1 underflows.  Counters are current as of
+// g_uLastCumulativeCycles.  Underflow is detected as a positive->negative transition, so a negative counter first gets
+// an event when it wraps positive.
+static void MB_ScheduleTimerEvent(void)
+{
+	if (!g_bMBTimerIrqActive || (g_nMBTimerDevice == TIMERDEVICE_INVALID))
+	{
+		timing_cancelEvent(TIMING_EVENT_MB_TIMER);
+		return;
+	}
+
+	uint16_t nCounter = g_MB[g_nMBTimerDevice].sy6522.TIMER1_COUNTER.w;
+	unsigned long uUntil = (nCounter & 0x8000) ? (unsigned long)(nCounter - 0x7FFF) : (unsigned long)nCounter + 1;
+	timing_scheduleEvent(TIMING_EVENT_MB_TIMER, g_uLastCumulativeCycles + uUntil, &MB_TimerEvent);
+}
+
+static void MB_TimerEvent(void)
+{
+	MB_UpdateCycles();
+	MB_ScheduleTimerEvent();
+}
+#endif
+
 static void StartTimer(SY6522_AY8910* pMB)
 {
 	if((pMB->nAY8910Number & 1) != SY6522_DEVICE_A)
@@ -338,6 +371,9 @@ static void StartTimer(SY6522_AY8910* pMB)
 
 	g_bMBTimerIrqActive = true;
 	g_nMBTimerDevice = pMB->nAY8910Number;
+#if 1 // APPLE2IX
+	MB_ScheduleTimerEvent();
+#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -347,6 +383,9 @@ static void StopTimer(SY6522_AY8910* pMB)
 	pMB->nTimerStatus = 0;
 	g_bMBTimerIrqActive = false;
 	g_nMBTimerDevice = TIMERDEVICE_INVALID;
+#if 1 // APPLE2IX
+	timing_cancelEvent(TIMING_EVENT_MB_TIMER);
+#endif
 }
 
 //-----------------------------------------------------------------------------
@@ -938,6 +977,124 @@ static void Votrax_Write(uint8_t nDevice, uint8_t nValue)
 }
 #endif
 
+#if 1 // APPLE2IX
+// Voice mixing : each side sums its 3 slot4 + 3 slot5 AY voices (Phasor attenuated to 2/3), clamps, then applies the
+// volume scale.  The integer (2*x)/3 truncates identically to the original (int)((double)x * 2.0/3.0) for all 16-bit x
+
+static inline int _mb_attenuate(int dat, bool phasor) {
+    return phasor ? (dat * 2) / 3 : dat;
+}
+
+static void _mb_mixVoicesScalar(short **voices, unsigned int start, unsigned int count, bool phasor, float scale, short *out) {
+    for (unsigned int i = start; i < start + count; i++) {
+        int nDataL = 0, nDataR = 0;
+        for (unsigned int j=0; j<NUM_VOICES_PER_AY8910; j++) {
+            nDataL += _mb_attenuate(voices[0*NUM_VOICES_PER_AY8910+j][i], phasor) + _mb_attenuate(voices[2*NUM_VOICES_PER_AY8910+j][i], phasor);
+            nDataR += _mb_attenuate(voices[1*NUM_VOICES_PER_AY8910+j][i], phasor) + _mb_attenuate(voices[3*NUM_VOICES_PER_AY8910+j][i], phasor);
+        }
+
+        nDataL = MIN(MAX(nDataL, nWaveDataMin), nWaveDataMax);
+        nDataR = MIN(MAX(nDataR, nWaveDataMin), nWaveDataMax);
+
+        out[i*g_nMB_NumChannels+0] = (short)nDataL * scale;
+        out[i*g_nMB_NumChannels+1] = (short)nDataR * scale;
+    }
+}
+
+#   if MB_MIX_SSE2
+// 8 lanes of trunc(2*x/3) : floor(|x| * 43691 / 65536) is exact for |x| <= 32768
+static inline __m128i _mb_attenuateSSE2(__m128i dat) {
+    __m128i sign = _mm_srai_epi16(dat, 15);
+    __m128i mag = _mm_sub_epi16(_mm_xor_si128(dat, sign), sign);
+    __m128i quot = _mm_mulhi_epu16(mag, _mm_set1_epi16((short)43691));
+    return _mm_sub_epi16(_mm_xor_si128(quot, sign), sign);
+}
+
+static inline __m128i _mb_scaleSSE2(__m128i dat, __m128 scale) {
+    __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(dat, dat), 16);
+    __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(dat, dat), 16);
+    lo = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+    hi = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    return _mm_packs_epi32(lo, hi);
+}
+#   elif MB_MIX_NEON
+static inline int16x8_t _mb_attenuateNEON(int16x8_t dat) {
+    int16x8_t sign = vshrq_n_s16(dat, 15);
+    uint16x8_t mag = vreinterpretq_u16_s16(vabsq_s16(dat));
+    uint16x4_t qlo = vshrn_n_u32(vmull_n_u16(vget_low_u16(mag), 43691), 16);
+    uint16x4_t qhi = vshrn_n_u32(vmull_n_u16(vget_high_u16(mag), 43691), 16);
+    int16x8_t quot = vreinterpretq_s16_u16(vcombine_u16(qlo, qhi));
+    return vsubq_s16(veorq_s16(quot, sign), sign);
+}
+
+static inline int16x8_t _mb_scaleNEON(int16x8_t dat, float scale) {
+    int32x4_t lo = vcvtq_s32_f32(vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(dat))), scale));
+    int32x4_t hi = vcvtq_s32_f32(vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(dat))), scale));
+    return vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi));
+}
+#   endif
+
+static void _mb_mixVoices(short **voices, unsigned int numSamples, bool phasor, float scale, short *out) {
+    unsigned int i = 0;
+#   if MB_MIX_SSE2
+    const __m128 vscale = _mm_set1_ps(scale);
+    for (; i + 8 <= numSamples; i += 8) {
+        __m128i sum[2][2] = { { _mm_setzero_si128(), _mm_setzero_si128() }, { _mm_setzero_si128(), _mm_setzero_si128() } };
+        for (unsigned int v=0; v<NUM_VOICES; v++) {
+            __m128i dat = _mm_loadu_si128((const __m128i *)(voices[v] + i));
+            if (phasor) {
+                dat = _mb_attenuateSSE2(dat);
+            }
+            // voice banks 0,2 are L, 1,3 are R ... widen to 32bits so the sum clamps like the scalar path
+            unsigned int side = (v / NUM_VOICES_PER_AY8910) & 0x1;
+            sum[side][0] = _mm_add_epi32(sum[side][0], _mm_srai_epi32(_mm_unpacklo_epi16(dat, dat), 16));
+            sum[side][1] = _mm_add_epi32(sum[side][1], _mm_srai_epi32(_mm_unpackhi_epi16(dat, dat), 16));
+        }
+        __m128i datL = _mm_packs_epi32(sum[0][0], sum[0][1]);
+        __m128i datR = _mm_packs_epi32(sum[1][0], sum[1][1]);
+        if (scale != 1.f) {
+            datL = _mb_scaleSSE2(datL, vscale);
+            datR = _mb_scaleSSE2(datR, vscale);
+        }
+        _mm_storeu_si128((__m128i *)(out + i*g_nMB_NumChannels + 0), _mm_unpacklo_epi16(datL, datR));
+        _mm_storeu_si128((__m128i *)(out + i*g_nMB_NumChannels + 8), _mm_unpackhi_epi16(datL, datR));
+    }
+#   elif MB_MIX_NEON
+    for (; i + 8 <= numSamples; i += 8) {
+        int32x4_t sum[2][2] = { { vdupq_n_s32(0), vdupq_n_s32(0) }, { vdupq_n_s32(0), vdupq_n_s32(0) } };
+        for (unsigned int v=0; v<NUM_VOICES; v++) {
+            int16x8_t dat = vld1q_s16(voices[v] + i);
+            if (phasor) {
+                dat = _mb_attenuateNEON(dat);
+            }
+            unsigned int side = (v / NUM_VOICES_PER_AY8910) & 0x1;
+            sum[side][0] = vaddw_s16(sum[side][0], vget_low_s16(dat));
+            sum[side][1] = vaddw_s16(sum[side][1], vget_high_s16(dat));
+        }
+        int16x8x2_t datLR;
+        datLR.val[0] = vcombine_s16(vqmovn_s32(sum[0][0]), vqmovn_s32(sum[0][1]));
+        datLR.val[1] = vcombine_s16(vqmovn_s32(sum[1][0]), vqmovn_s32(sum[1][1]));
+        if (scale != 1.f) {
+            datLR.val[0] = _mb_scaleNEON(datLR.val[0], scale);
+            datLR.val[1] = _mb_scaleNEON(datLR.val[1], scale);
+        }
+        vst2q_s16(out + i*g_nMB_NumChannels, datLR);
+    }
+#   endif
+    _mb_mixVoicesScalar(voices, i, numSamples - i, phasor, scale, out);
+}
+
+#   if TESTING
+void _mb_testMixVoices(short **voices, unsigned int numSamples, bool phasor, float scale, short *out, bool scalar) {
+    if (scalar) {
+        _mb_mixVoicesScalar(voices, 0, numSamples, phasor, scale, out);
+    } else {
+        _mb_mixVoices(voices, numSamples, phasor, scale, out);
+    }
+}
+#   endif
+#endif
+
 //===========================================================================
 
 static void MB_Update()
@@ -1130,6 +1287,9 @@ static void MB_Update()
         }
 #endif
 
+#if !MB_TRACING // APPLE2IX
+        _mb_mixVoices(ppAYVoiceBuffer, (unsigned int)nNumSamples, g_bPhasorEnable, samplesScale, g_nMixBuffer);
+#else
 	const double fAttenuation = g_bPhasorEnable ? 2.0/3.0 : 1.0;
 
 	for(int i=0; i<nNumSamples; i++)
@@ -1205,6 +1365,7 @@ static void MB_Update()
 		g_nMixBuffer[i*g_nMB_NumChannels+0] = (short)nDataL * samplesScale;	// L
 		g_nMixBuffer[i*g_nMB_NumChannels+1] = (short)nDataR * samplesScale;	// R
 	}
+#endif
 
 	//
 
@@ -2827,7 +2988,9 @@ static bool _ssi263_loadState(StateHelper_s *helper, SSI263A *ssi263) {
 }
 
 bool mb_saveState(StateHelper_s *helper) {
-    LOG("SAVE mockingboard state ...");
+    if (!helper->isRewind) {
+        LOG("SAVE mockingboard state ...");
+    }
     int fd = helper->fd;
 
     bool saved = false;
@@ -90,9 +90,9 @@ typedef struct
 } SS_CARD_MOCKINGBOARD;
 #endif
 
-extern bool       g_bMBTimerIrqActive;
+extern VM_LOCAL bool g_bMBTimerIrqActive;
 #ifdef _DEBUG
-extern uint32_t	g_uTimer1IrqCount;	// DEBUG
+extern VM_LOCAL uint32_t g_uTimer1IrqCount;	// DEBUG
 #endif
 
 void	MB_Initialize(void);
@@ -118,6 +118,8 @@ bool mb_saveState(StateHelper_s *helper);
 bool mb_loadState(StateHelper_s *helper);
 #   if TESTING
 int mb_testAssertA2V2(uint8_t *exData, size_t dataSiz);
+// Mix 12 AY voice buffers into interleaved stereo with either the scalar or the SIMD mixer
+void _mb_testMixVoices(short **voices, unsigned int numSamples, bool phasor, float scale, short *out, bool scalar);
 #   endif
 #else
 void    MB_GetSnapshot_v1(struct SS_CARD_MOCKINGBOARD_v1* const pSS, const DWORD dwSlot);	// For debugger
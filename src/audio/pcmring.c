@@ -0,0 +1,57 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+#include "common.h"
+#include "pcmring.h"
+
+PCMRing_s *pcmring_create(unsigned long minSamples) {
+    PCMRing_s *ring = NULL;
+
+    do {
+        unsigned long capacity = 1;
+        while (capacity < minSamples) {
+            capacity <<= 1;
+        }
+
+        ring = CALLOC(1, sizeof(*ring));
+        if (!ring) {
+            LOG("OOPS, Not enough memory for PCMRing");
+            break;
+        }
+
+        ring->samples = CALLOC(capacity, sizeof(int16_t));
+        if (!ring->samples) {
+            LOG("OOPS, Not enough memory for %lu PCMRing samples", capacity);
+            break;
+        }
+
+        ring->capacity = capacity;
+        ring->mask = capacity-1;
+
+        return ring;
+    } while (0);
+
+    if (ring) {
+        pcmring_destroy(&ring);
+    }
+
+    return NULL;
+}
+
+void pcmring_destroy(INOUT PCMRing_s **ring) {
+    if (!*ring) {
+        return;
+    }
+    if ((*ring)->samples) {
+        FREE((*ring)->samples);
+    }
+    FREE(*ring);
+}
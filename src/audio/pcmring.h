@@ -0,0 +1,81 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+/*
+ * A single-producer/single-consumer PCM sample ring.
+ *
+ * The producer (CPU thread : speaker, mockingboard) writes samples directly into ring memory and publishes them with
+ * pcmring_commit().  The consumer (audio backend thread) reads them in place and releases them with pcmring_consume().
+ * No locks are taken : each side owns one monotonic counter and only reads the other's.
+ *
+ * WARNING : exactly one producer thread and one consumer thread per ring
+ */
+
+#ifndef _PCMRING_H_
+#define _PCMRING_H_
+
+typedef struct PCMRing_s {
+    int16_t *samples;
+    unsigned long capacity;                 // in samples (power of two)
+    unsigned long mask;
+
+    // producer-owned
+    unsigned long writeCount __attribute__((aligned(64)));
+
+    // consumer-owned
+    unsigned long readCount __attribute__((aligned(64)));
+    unsigned long underruns;
+} PCMRing_s;
+
+// create a ring holding at least minSamples samples
+PCMRing_s *pcmring_create(unsigned long minSamples);
+
+// destroy a ring object
+void pcmring_destroy(INOUT PCMRing_s **ring);
+
+// number of samples committed but not yet consumed (callable from either side)
+static inline unsigned long pcmring_occupancy(const PCMRing_s *ring) {
+    unsigned long writeCount = __atomic_load_n(&ring->writeCount, __ATOMIC_ACQUIRE);
+    unsigned long readCount = __atomic_load_n(&ring->readCount, __ATOMIC_ACQUIRE);
+    return writeCount - readCount;
+}
+
+// PRODUCER : get contiguous writable region, returns its size in samples (possibly less than total free space if the
+// region wraps)
+static inline unsigned long pcmring_writeRegion(PCMRing_s *ring, OUTPARM int16_t **samples) {
+    unsigned long writeCount = ring->writeCount;
+    unsigned long readCount = __atomic_load_n(&ring->readCount, __ATOMIC_ACQUIRE);
+    unsigned long head = writeCount & ring->mask;
+    unsigned long avail = ring->capacity - (writeCount - readCount);
+    *samples = ring->samples + head;
+    return MIN(avail, ring->capacity - head);
+}
+
+// PRODUCER : publish numSamples written into the region from pcmring_writeRegion()
+static inline void pcmring_commit(PCMRing_s *ring, unsigned long numSamples) {
+    __atomic_store_n(&ring->writeCount, ring->writeCount + numSamples, __ATOMIC_RELEASE);
+}
+
+// CONSUMER : get contiguous readable region, returns its size in samples
+static inline unsigned long pcmring_readRegion(PCMRing_s *ring, OUTPARM const int16_t **samples) {
+    unsigned long readCount = ring->readCount;
+    unsigned long writeCount = __atomic_load_n(&ring->writeCount, __ATOMIC_ACQUIRE);
+    unsigned long tail = readCount & ring->mask;
+    *samples = ring->samples + tail;
+    return MIN(writeCount - readCount, ring->capacity - tail);
+}
+
+// CONSUMER : release numSamples read from the region from pcmring_readRegion()
+static inline void pcmring_consume(PCMRing_s *ring, unsigned long numSamples) {
+    __atomic_store_n(&ring->readCount, ring->readCount + numSamples, __ATOMIC_RELEASE);
+}
+
+#endif /* whole file */
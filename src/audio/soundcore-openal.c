@@ -23,7 +23,7 @@
 #endif
 
 #include "audio/alhelpers.h"
-#include "playqueue.h"
+#include "pcmring.h"
 #include "uthash.h"
 
 #define DEBUG_OPENAL 0
@@ -34,21 +34,22 @@
 #endif
 
 #define OPENAL_NUM_BUFFERS 4
+#define OPENAL_DRAIN_PERIOD_NSECS 5000000UL // 5ms
 
 typedef struct ALVoice {
     ALuint source;
     ALuint buffers[OPENAL_NUM_BUFFERS];
 
-    // playing data
-    PlayQueue_s *playq;
-    ALint _queued_total_bytes; // a maximum estimate -- actual value depends on OpenAL query
+    // samples written by the CPU thread and drained into OpenAL by the backend thread
+    PCMRing_s *ring;
+    unsigned long playingBytes; // submitted to OpenAL but not yet played (published by backend thread)
 
-    // working data buffer
-    ALbyte *data;
-    ALsizei index;      // working buffer byte index
-    ALsizei buffersize; // working buffer size (and OpenAL buffersize)
+    // backend thread data
+    ALsizei bufferBytes[OPENAL_NUM_BUFFERS]; // bytes submitted in each OpenAL buffer (0 if not queued)
+    ALint queuedBytes;  // total bytes in queued OpenAL buffers
+    ALsizei submitSize; // preferred OpenAL buffer size in bytes
 
-    ALsizei replay_index;
+    ALsizei buffersize; // total streaming buffer size in bytes
 
     // sample parameters
     ALenum format;
@@ -66,20 +67,26 @@ typedef struct ALVoices {
 static ALVoices *voices = NULL;
 static AudioBackend_s openal_audio_backend = { { 0 } };
 
+// backend thread that moves samples from each voice ring into OpenAL
+static pthread_t drain_thread_id = 0;
+static pthread_mutex_t drain_mutex = PTHREAD_MUTEX_INITIALIZER; // guards voices list and OpenAL source state changes
+static pthread_cond_t drain_cond = PTHREAD_COND_INITIALIZER;
+static bool drain_thread_running = false;
+
 // ----------------------------------------------------------------------------
-// AudioBuffer_s processing routines
-
-static void _playq_removeNode(ALVoice *voice, PlayNode_s *playNode) {
-    long err = voice->playq->Remove(voice->playq, playNode);
-    assert(err == 0);
-    (void)err;
-    voice->_queued_total_bytes -= playNode->numBytes;
-    assert(voice->_queued_total_bytes >= 0);
+// Backend thread processing routines
+
+static int _ALBufferIndex(ALVoice *voice, ALuint bufid) {
+    for (int i=0; i<OPENAL_NUM_BUFFERS; i++) {
+        if (voice->buffers[i] == bufid) {
+            return i;
+        }
+    }
+    return -1;
 }
 
-static long _ALProcessPlayBuffers(ALVoice *voice, ALuint *bytes_queued) {
+static long _ALReclaimPlayedBuffers(ALVoice *voice) {
     long err = 0;
-    *bytes_queued = 0;
 
     do {
         ALint processed = 0;
@@ -98,137 +105,98 @@ static long _ALProcessPlayBuffers(ALVoice *voice, ALuint *bytes_queued) {
                 break;
             }
 
-            OPENAL_LOG("Attempting to dequeue %u ...", bufid);
-            PlayNode_s playNode = {
-                .nodeId = bufid,
-            };
-            err = voice->playq->Get(voice->playq, &playNode);
-            if (err) {
-                LOG("OOPS, OpenAL bufid %u not found in playlist...", bufid);
-            } else {
-                _playq_removeNode(voice, &playNode);
+            OPENAL_LOG("Dequeued %u ...", bufid);
+            int idx = _ALBufferIndex(voice, bufid);
+            if (idx < 0) {
+                LOG("OOPS, OpenAL bufid %u not found in voice...", bufid);
+                continue;
             }
-        }
-
-        ALint play_offset = 0;
-        alGetSourcei(voice->source, AL_BYTE_OFFSET, &play_offset);
-        if ((err = alGetError()) != AL_NO_ERROR) {
-            LOG("OOPS, alGetSourcei AL_BYTE_OFFSET : 0x%08lx", err);
-            break;
-        }
-        assert((play_offset >= 0)/* && (play_offset < voice->buffersize)*/);
-
-        long q = voice->_queued_total_bytes/* + voice->index*/ - play_offset;
-
-        if (q >= 0) {
-            *bytes_queued = (ALuint)q;
+            voice->queuedBytes -= voice->bufferBytes[idx];
+            voice->bufferBytes[idx] = 0;
+            assert(voice->queuedBytes >= 0);
         }
     } while (0);
 
     return err;
 }
 
-// returns queued+working sound buffer size in bytes
-static long ALGetPosition(AudioBuffer_s *_this, OUTPARM unsigned long *bytes_queued) {
-    *bytes_queued = 0;
+static long _ALSubmitFromRing(ALVoice *voice) {
     long err = 0;
 
-    do {
-        ALVoice *voice = (ALVoice*)_this->_internal;
+    for (int idx=0; idx<OPENAL_NUM_BUFFERS; idx++) {
+        if (voice->bufferBytes[idx]) {
+            continue; // still queued
+        }
 
-        ALuint queued = 0;
-        long err = _ALProcessPlayBuffers(voice, &queued);
-        if (err) {
+        const int16_t *samples = NULL;
+        unsigned long numSamples = pcmring_readRegion(voice->ring, &samples);
+        numSamples -= (numSamples % NUM_CHANNELS);
+        if (numSamples == 0) {
             break;
         }
-#if DEBUG_OPENAL
-        static int last_queued = 0;
-        if (queued != last_queued) {
-            last_queued = queued;
-            OPENAL_LOG("OpenAL bytes queued : %u", queued);
-        }
-#endif
-
-        *bytes_queued = queued + voice->index;
-    } while (0);
-
-    return err;
-}
-
-static long ALLockBuffer(AudioBuffer_s *_this, unsigned long write_bytes, INOUT int16_t **audio_ptr, OUTPARM unsigned long *audio_bytes) {
-    *audio_bytes = 0;
-    *audio_ptr = NULL;
-    long err = 0;
-
-    do {
-        ALVoice *voice = (ALVoice*)_this->_internal;
 
-        if (write_bytes == 0) {
-            write_bytes = voice->buffersize;
+        // Prefer full-sized buffers, but do not hold back data from a starving source
+        const unsigned long submitSamples = voice->submitSize / sizeof(int16_t);
+        if (numSamples > submitSamples) {
+            numSamples = submitSamples;
+        } else if ((numSamples < submitSamples) && (voice->queuedBytes >= voice->submitSize)) {
+            unsigned long occupancy = pcmring_occupancy(voice->ring);
+            if (occupancy < submitSamples) {
+                break;
+            }
+            // otherwise this is the tail end of a wrapped ring ... submit it
         }
 
-        ALuint bytes_queued = 0;
-        err = _ALProcessPlayBuffers(voice, &bytes_queued);
-        if (err) {
-            break;
-        }
+        ALsizei numBytes = (ALsizei)(numSamples * sizeof(int16_t));
+        OPENAL_LOG("Enqueing OpenAL buffer %u (%d bytes)", voice->buffers[idx], numBytes);
 
-        if ((bytes_queued == 0) && (voice->index == 0)) {
-            LOG("Buffer underrun ... queuing quiet samples ...");
-            int quiet_size = voice->buffersize>>2/* 1/4 buffer */;
-            memset(voice->data, 0x0, quiet_size);
-            voice->index += quiet_size;
-        }
-#if 0
-        else if (bytes_queued + voice->index < (voice->buffersize>>3)/* 1/8 buffer */)
-        {
-            OPENAL_LOG("Potential underrun ...");
+        // NOTE : alBufferData() copies directly from the ring into OpenAL
+        alBufferData(voice->buffers[idx], voice->format, samples, numBytes, voice->rate);
+        if ((err = alGetError()) != AL_NO_ERROR) {
+            LOG("OOPS, Error alBufferData : 0x%08lx", err);
+            break;
         }
-#endif
 
-        ALsizei remaining = voice->buffersize - voice->index;
-        if (write_bytes > remaining) {
-            write_bytes = remaining;
+        alSourceQueueBuffers(voice->source, 1, &voice->buffers[idx]);
+        if ((err = alGetError()) != AL_NO_ERROR) {
+            LOG("OOPS, Error buffering data : 0x%08lx", err);
+            break;
         }
 
-        *audio_ptr = (int16_t *)(voice->data+voice->index);
-        *audio_bytes = write_bytes;
-    } while (0);
+        pcmring_consume(voice->ring, numSamples);
+        voice->bufferBytes[idx] = numBytes;
+        voice->queuedBytes += numBytes;
+    }
 
     return err;
 }
 
-static long _ALSubmitBufferToOpenAL(ALVoice *voice) {
+static long _ALDrainVoice(ALVoice *voice) {
     long err = 0;
 
     do {
-        // Micro-manage play queue locally to understand the total bytes-in-play
-        PlayNode_s playNode = {
-            .nodeId = INVALID_NODE_ID,
-            .numBytes = voice->index,
-            .bytes = (uint8_t *)(voice->data),
-        };
-        err = voice->playq->Enqueue(voice->playq, &playNode);
+        err = _ALReclaimPlayedBuffers(voice);
         if (err) {
             break;
         }
-        voice->_queued_total_bytes += voice->index;
-        voice->index = 0;
-        assert(voice->_queued_total_bytes > 0);
 
-        OPENAL_LOG("Enqueing OpenAL buffer %ld (%lu bytes) at %p", playNode.nodeId, playNode.numBytes, playNode.bytes);
-        alBufferData(playNode.nodeId, voice->format, playNode.bytes, playNode.numBytes, voice->rate);
-        if ((err = alGetError()) != AL_NO_ERROR) {
-            _playq_removeNode(voice, &playNode);
-            LOG("OOPS, Error alBufferData : 0x%08lx", err);
+        err = _ALSubmitFromRing(voice);
+        if (err) {
             break;
         }
 
-        ALuint nodeId = (ALuint)playNode.nodeId;
-        alSourceQueueBuffers(voice->source, 1, &nodeId);
+        ALint play_offset = 0;
+        alGetSourcei(voice->source, AL_BYTE_OFFSET, &play_offset);
         if ((err = alGetError()) != AL_NO_ERROR) {
-            _playq_removeNode(voice, &playNode);
-            LOG("OOPS, Error buffering data : 0x%08lx", err);
+            LOG("OOPS, alGetSourcei AL_BYTE_OFFSET : 0x%08lx", err);
+            break;
+        }
+        assert(play_offset >= 0);
+
+        long playing = voice->queuedBytes - play_offset;
+        __atomic_store_n(&voice->playingBytes, (unsigned long)(playing > 0 ? playing : 0), __ATOMIC_RELEASE);
+
+        if (voice->queuedBytes == 0) {
             break;
         }
 
@@ -252,58 +220,81 @@ static long _ALSubmitBufferToOpenAL(ALVoice *voice) {
     return err;
 }
 
-static long ALUnlockBuffer(AudioBuffer_s *_this, unsigned long audio_bytes) {
-    long err = 0;
+static void *_openal_drainThread(void *dummyptr) {
+    LOG("OpenAL drain thread starting ...");
 
-    do {
-        ALVoice *voice = (ALVoice*)_this->_internal;
-        ALuint bytes_queued = 0;
-        err = _ALProcessPlayBuffers(voice, &bytes_queued);
-        if (err) {
-            break;
+    pthread_mutex_lock(&drain_mutex);
+    while (drain_thread_running) {
+        ALVoices *vnode = NULL;
+        ALVoices *tmp = NULL;
+        HASH_ITER(hh, voices, vnode, tmp) {
+            _ALDrainVoice(vnode->voice);
         }
 
-        voice->index += audio_bytes;
+        struct timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline = timespec_add(deadline, OPENAL_DRAIN_PERIOD_NSECS);
+        pthread_cond_timedwait(&drain_cond, &drain_mutex, &deadline);
+    }
+    pthread_mutex_unlock(&drain_mutex);
 
+    LOG("OpenAL drain thread exiting ...");
+    return NULL;
+}
 
-        if (voice->index >= voice->buffersize) {
-            assert((voice->index == voice->buffersize) && "OOPS, detected an actual overflow in queued sound data");
-        }
+// ----------------------------------------------------------------------------
+// AudioBuffer_s processing routines (CPU thread, lock-free)
 
-        if (bytes_queued >= (voice->buffersize>>2)/*quarter buffersize*/) {
-            // keep accumulating data into working buffer
-            break;
-        }
+// returns ring+playing sound buffer size in bytes
+static long ALGetPosition(AudioBuffer_s *_this, OUTPARM unsigned long *bytes_queued) {
+    ALVoice *voice = (ALVoice*)_this->_internal;
+    unsigned long playing = __atomic_load_n(&voice->playingBytes, __ATOMIC_ACQUIRE);
+    *bytes_queued = pcmring_occupancy(voice->ring) * sizeof(int16_t) + playing;
+#if DEBUG_OPENAL
+    static unsigned long last_queued = 0;
+    if (*bytes_queued != last_queued) {
+        last_queued = *bytes_queued;
+        OPENAL_LOG("OpenAL bytes queued : %lu", last_queued);
+    }
+#endif
+    return 0;
+}
 
-        if (! (voice->playq->CanEnqueue(voice->playq)) ) {
-            OPENAL_LOG("no free audio buffers"); // keep accumulating ...
-            break;
-        }
+static long ALLockBuffer(AudioBuffer_s *_this, unsigned long write_bytes, INOUT int16_t **audio_ptr, OUTPARM unsigned long *audio_bytes) {
+    ALVoice *voice = (ALVoice*)_this->_internal;
 
-        // Submit working buffer to OpenAL
+    if (write_bytes == 0) {
+        write_bytes = voice->buffersize;
+    }
 
-        err = _ALSubmitBufferToOpenAL(voice);
-    } while (0);
+    int16_t *samples = NULL;
+    unsigned long writable = pcmring_writeRegion(voice->ring, &samples);
 
-    return err;
-}
+    if ((pcmring_occupancy(voice->ring) == 0) && (__atomic_load_n(&voice->playingBytes, __ATOMIC_ACQUIRE) == 0)) {
+        LOG("Buffer underrun ... queuing quiet samples ...");
+        unsigned long quiet_samples = MIN(writable, (voice->buffersize>>2/* 1/4 buffer */) / sizeof(int16_t));
+        memset(samples, 0x0, quiet_samples * sizeof(int16_t));
+        pcmring_commit(voice->ring, quiet_samples);
+        writable = pcmring_writeRegion(voice->ring, &samples);
+    }
+
+    unsigned long writable_bytes = writable * sizeof(int16_t);
+    if (write_bytes > writable_bytes) {
+        write_bytes = writable_bytes;
+    }
+
+    *audio_ptr = samples;
+    *audio_bytes = write_bytes;
 
-#if 0
-// HACK Part I : done once for mockingboard that has semiauto repeating phonemes ...
-static long ALUnlockStaticBuffer(AudioBuffer_s *_this, unsigned long audio_bytes) {
-    ALVoice *voice = (ALVoice*)_this->_internal;
-    voice->replay_index = (ALsizei)audio_bytes;
     return 0;
 }
 
-// HACK Part II : replay mockingboard phoneme ...
-static long ALReplay(AudioBuffer_s *_this) {
+static long ALUnlockBuffer(AudioBuffer_s *_this, unsigned long audio_bytes) {
     ALVoice *voice = (ALVoice*)_this->_internal;
-    voice->index = voice->replay_index;
-    long err = _ALSubmitBufferToOpenAL(voice);
-    return err;
+    assert((audio_bytes % sizeof(int16_t)) == 0);
+    pcmring_commit(voice->ring, audio_bytes / sizeof(int16_t));
+    return 0;
 }
-#endif
 
 static long ALGetStatus(AudioBuffer_s *_this, OUTPARM unsigned long *status) {
     *status = -1;
@@ -337,18 +328,12 @@ static void _openal_destroyVoice(ALVoice *voice) {
         LOG("OOPS, Failed to delete source");
     }
 
-    if (voice->data) {
-        FREE(voice->data);
-    }
-
-    for (unsigned int i=0; i<OPENAL_NUM_BUFFERS; i++) {
-        alDeleteBuffers(1, voice->buffers);
-        if (alGetError() != AL_NO_ERROR) {
-            LOG("OOPS, Failed to delete object IDs");
-        }
+    alDeleteBuffers(OPENAL_NUM_BUFFERS, voice->buffers);
+    if (alGetError() != AL_NO_ERROR) {
+        LOG("OOPS, Failed to delete object IDs");
     }
 
-    playq_destroyPlayQueue(&(voice->playq));
+    pcmring_destroy(&(voice->ring));
 
     memset(voice, 0, sizeof(*voice));
     FREE(voice);
@@ -401,16 +386,6 @@ static ALVoice *_openal_createVoice(unsigned long numChannels) {
         }
 #endif
 
-        unsigned int bufs[OPENAL_NUM_BUFFERS];
-        for (unsigned int i=0; i<OPENAL_NUM_BUFFERS; i++) {
-            bufs[i] = voice->buffers[i];
-        }
-        voice->playq = playq_createPlayQueue(bufs, OPENAL_NUM_BUFFERS);
-        if (!voice->playq) {
-            LOG("OOPS, Not enough memory for PlayQueue");
-            break;
-        }
-
         voice->rate = (ALuint)openal_audio_backend.systemSettings.sampleRateHz;
 
         // Emulator supports only mono and stereo
@@ -420,20 +395,25 @@ static ALVoice *_openal_createVoice(unsigned long numChannels) {
             voice->format = AL_FORMAT_MONO16;
         }
 
-        /* Allocate enough space for the temp buffer, given the format */
+        /* Allocate enough space for the ring buffer, given the format */
         assert(numChannels == 1 || numChannels == 2);
         unsigned long maxSamples = openal_audio_backend.systemSettings.monoBufferSizeSamples * numChannels;
         voice->buffersize = (ALsizei)maxSamples * (ALsizei)openal_audio_backend.systemSettings.bytesPerSample;
 
-        voice->data = CALLOC(1, voice->buffersize);
-        if (voice->data == NULL) {
-            LOG("OOPS, Error allocating %d bytes", voice->buffersize);
+        // OpenAL buffers are kept small for latency, the ring absorbs the burstiness of the CPU thread
+        voice->submitSize = voice->buffersize / (OPENAL_NUM_BUFFERS*2);
+        voice->submitSize -= voice->submitSize % (ALsizei)(numChannels * sizeof(int16_t));
+
+        voice->ring = pcmring_create(maxSamples);
+        if (voice->ring == NULL) {
+            LOG("OOPS, Error allocating %lu samples", maxSamples);
             break;
         }
 
         LOG("\tRate     : 0x%08x", voice->rate);
         LOG("\tFormat   : 0x%08x", voice->format);
         LOG("\tbuffersize : %d", voice->buffersize);
+        LOG("\tsubmitSize : %d", voice->submitSize);
 
         return voice;
 
@@ -459,14 +439,15 @@ static long openal_destroySoundBuffer(const struct AudioContext_s *sound_system,
     ALVoice *voice = (ALVoice *)((*soundbuf_struct)->_internal);
     ALint source = voice->source;
 
-    _openal_destroyVoice(voice);
-
+    pthread_mutex_lock(&drain_mutex);
     ALVoices *vnode = NULL;
     HASH_FIND_INT(voices, &source, vnode);
     if (vnode) {
         HASH_DEL(voices, vnode);
         FREE(vnode);
     }
+    _openal_destroyVoice(voice);
+    pthread_mutex_unlock(&drain_mutex);
 
     FREE(*soundbuf_struct);
     return 0;
@@ -489,20 +470,25 @@ static long openal_createSoundBuffer(const AudioContext_s *audio_context, INOUT
             break;
         }
 
+        if ((*soundbuf_struct = CALLOC(1, sizeof(AudioBuffer_s))) == NULL) {
+            LOG("OOPS, Not enough memory");
+            break;
+        }
+
         ALVoices immutableNode = { /*const*/.source = voice->source };
         ALVoices *vnode = CALLOC(1, sizeof(ALVoices));
         if (!vnode) {
             LOG("OOPS, Not enough memory");
+            FREE(*soundbuf_struct);
             break;
         }
         memcpy(vnode, &immutableNode, sizeof(ALVoices));
         vnode->voice = voice;
-        HASH_ADD_INT(voices, source, vnode);
 
-        if ((*soundbuf_struct = CALLOC(1, sizeof(AudioBuffer_s))) == NULL) {
-            LOG("OOPS, Not enough memory");
-            break;
-        }
+        // voice becomes visible to the drain thread
+        pthread_mutex_lock(&drain_mutex);
+        HASH_ADD_INT(voices, source, vnode);
+        pthread_mutex_unlock(&drain_mutex);
 
         (*soundbuf_struct)->_internal          = voice;
         (*soundbuf_struct)->GetCurrentPosition = &ALGetPosition;
@@ -516,9 +502,7 @@ static long openal_createSoundBuffer(const AudioContext_s *audio_context, INOUT
         return 0;
     } while(0);
 
-    if (*soundbuf_struct) {
-        openal_destroySoundBuffer(audio_context, soundbuf_struct);
-    } else if (voice) {
+    if (voice) {
         _openal_destroyVoice(voice);
     }
 
@@ -534,6 +518,15 @@ static long openal_systemShutdown(INOUT AudioContext_s **audio_context) {
     assert(ctx != NULL);
     (void)ctx;
 
+    if (drain_thread_id) {
+        pthread_mutex_lock(&drain_mutex);
+        drain_thread_running = false;
+        pthread_cond_signal(&drain_cond);
+        pthread_mutex_unlock(&drain_mutex);
+        pthread_join(drain_thread_id, NULL);
+        drain_thread_id = 0;
+    }
+
     (*audio_context)->_internal = NULL;
     FREE(*audio_context);
 
@@ -583,6 +576,15 @@ static long openal_systemSetup(INOUT AudioContext_s **audio_context) {
         (*audio_context)->CreateSoundBuffer = &openal_createSoundBuffer;
         (*audio_context)->DestroySoundBuffer = &openal_destroySoundBuffer;
 
+        drain_thread_running = true;
+        if (TEMP_FAILURE_RETRY(pthread_create(&drain_thread_id, NULL, &_openal_drainThread, NULL))) {
+            LOG("OOPS, Could not create OpenAL drain thread");
+            drain_thread_running = false;
+            drain_thread_id = 0;
+            FREE(*audio_context);
+            break;
+        }
+
         result = 0;
     } while(0);
 
@@ -604,6 +606,7 @@ static long openal_systemPause(AudioContext_s *audio_context) {
     ALVoices *tmp = NULL;
     long err = 0;
 
+    pthread_mutex_lock(&drain_mutex);
     HASH_ITER(hh, voices, vnode, tmp) {
         alSourcePause(vnode->source);
         err = alGetError();
@@ -611,6 +614,7 @@ static long openal_systemPause(AudioContext_s *audio_context) {
             LOG("OOPS, Failed to pause source : 0x%08lx", err);
         }
     }
+    pthread_mutex_unlock(&drain_mutex);
 
     return 0;
 }
@@ -620,6 +624,7 @@ static long openal_systemResume(AudioContext_s *audio_context) {
     ALVoices *tmp = NULL;
     long err = 0;
 
+    pthread_mutex_lock(&drain_mutex);
     HASH_ITER(hh, voices, vnode, tmp) {
         alSourcePlay(vnode->source);
         err = alGetError();
@@ -627,6 +632,7 @@ static long openal_systemResume(AudioContext_s *audio_context) {
             LOG("OOPS, Failed to pause source : 0x%08lx", err);
         }
     }
+    pthread_mutex_unlock(&drain_mutex);
 
     return 0;
 }
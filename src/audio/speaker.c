@@ -12,6 +12,8 @@
 /* Apple //e speaker support. Source inspired/derived from AppleWin.
  *
  *  - ~23 //e cycles per PC sample (played back at 44.100kHz)
+ *  - Speaker toggles are either box-filtered per CPU cycle (legacy) or logged with their cycle timestamps and rendered
+ *    as band-limited steps (BLEP) at flush time, see PREF_SPEAKER_QUALITY
  *
  * The soundcard output drives how much 6502 emulation is done in real-time.  If the soundcard buffer is running out of
  * sample-data, then more 6502 cycles need to be executed to top-up the buffer, and vice-versa.
@@ -34,36 +36,69 @@
 // TODO FIXME : still need to investigate better way to fix audio glitches when fast-loading (auto-adjusting speed) ...
 #define HACKISHLY_REDUCE_AUDIO_GLITCHES_FOR_FAST_LOADING 1
 
-static unsigned long bufferTotalSize = 0;
-static unsigned long bufferSizeIdealMin = 0;
-static unsigned long bufferSizeIdealMax = 0;
-static unsigned long channelsSampleRateHz = 0;
+#define SPEAKER_TOGGLE_LOG_MAX 4096 // toggles buffered between renders
 
-static bool speaker_isAvailable = false;
+#define BLEP_PHASES 32              // sub-sample step positions
+#define BLEP_TAPS_MAX 32
+#define BLEP_PENDING_SIZE 64        // power of two >= BLEP_TAPS_MAX
+#define BLEP_CUTOFF 0.45            // fraction of the output sample rate
 
-static int16_t *samples_buffer = NULL; // holds max 1 second of samples
-static int16_t *remainder_buffer = NULL; // holds enough to create one sample (averaged)
-static unsigned long samples_buffer_idx = 0;
-static unsigned int remainder_buffer_size = 0;
-static unsigned long remainder_buffer_size_max = 0;
-static unsigned int remainder_buffer_idx = 0;
+typedef struct speaker_toggle_s {
+    unsigned long cycles;
+    int16_t level;
+} speaker_toggle_s;
+
+static VM_LOCAL unsigned long bufferTotalSize = 0;
+static VM_LOCAL unsigned long bufferSizeIdealMin = 0;
+static VM_LOCAL unsigned long bufferSizeIdealMax = 0;
+static VM_LOCAL unsigned long channelsSampleRateHz = 0;
+
+static VM_LOCAL bool speaker_isAvailable = false;
+
+static VM_LOCAL int16_t *samples_buffer = NULL; // holds max 1 second of samples
+static VM_LOCAL int16_t *remainder_buffer = NULL; // holds enough to create one sample (averaged)
+static VM_LOCAL unsigned long samples_buffer_idx = 0;
+static VM_LOCAL unsigned int remainder_buffer_size = 0;
+static VM_LOCAL unsigned long remainder_buffer_size_max = 0;
+static VM_LOCAL unsigned int remainder_buffer_idx = 0;
+
+static VM_LOCAL int16_t *render_span = NULL; // backend buffer region rendered into directly by speaker_flush()
+static VM_LOCAL unsigned long render_span_size = 0;
+static VM_LOCAL unsigned long render_span_idx = 0;
 
 static long speaker_volume = 0;
 static int16_t speaker_amplitude = SPKR_DATA_INIT;
-static int16_t speaker_data = 0;
+static VM_LOCAL int16_t speaker_data = 0;
+
+static VM_LOCAL double cycles_per_sample = 0.0;
+static VM_LOCAL unsigned long cycles_last_update = 0;
+static VM_LOCAL unsigned long cycles_quiet_time = 0;
 
-static double cycles_per_sample = 0.0;
-static unsigned long cycles_last_update = 0;
-static unsigned long cycles_quiet_time = 0;
+static VM_LOCAL bool speaker_accessed_since_last_flush = false;
+static VM_LOCAL bool speaker_recently_active = false;
 
-static bool speaker_accessed_since_last_flush = false;
-static bool speaker_recently_active = false;
+static VM_LOCAL bool speaker_going_silent = false;
 
-static bool speaker_going_silent = false;
+static VM_LOCAL int samples_adjustment_counter = 0;
 
-static int samples_adjustment_counter = 0;
+static VM_LOCAL AudioBuffer_s *speakerBuffer = NULL;
 
-static AudioBuffer_s *speakerBuffer = NULL;
+static VM_LOCAL long speaker_quality = SPEAKER_QUALITY_BLEP_FAST;
+static VM_LOCAL long speaker_quality_active = SPEAKER_QUALITY_BOXCAR;
+
+// band-limited step tables : per-output-sample deltas of a windowed-sinc step, for each sub-sample phase
+static const unsigned int blep_taps[NUM_SPEAKER_QUALITY] = { 0, 8, BLEP_TAPS_MAX };
+static float blep_tables[NUM_SPEAKER_QUALITY][BLEP_PHASES][BLEP_TAPS_MAX] = { { { 0 } } };
+
+static VM_LOCAL speaker_toggle_s toggle_log[SPEAKER_TOGGLE_LOG_MAX];
+static VM_LOCAL unsigned int toggle_log_count = 0;
+
+static VM_LOCAL float blep_pending[BLEP_PENDING_SIZE] = { 0 }; // deltas for the next output samples
+static VM_LOCAL unsigned int blep_pending_head = 0;
+static VM_LOCAL unsigned int blep_settle = 0;                  // samples until the last step is fully integrated
+static VM_LOCAL float blep_level = 0.f;                        // integrated output level
+static VM_LOCAL int16_t blep_target = 0;                       // output level once all steps are integrated
+static VM_LOCAL double blep_phase = 0.0;                       // sub-sample position past the last output sample
 
 #if SPEAKER_TRACING
 static FILE *speaker_trace_fp = NULL;
@@ -83,9 +118,47 @@ static void speaker_prefsChanged(const char *domain) {
     }
     float samplesScale = speaker_volume/10.f;
     speaker_amplitude = (int16_t)(SPKR_DATA_INIT * samplesScale);
+
+    speaker_quality = prefs_parseLongValue(domain, PREF_SPEAKER_QUALITY, &lVal, /*base:*/10) ? lVal : SPEAKER_QUALITY_BLEP_FAST;
+    if (speaker_quality < SPEAKER_QUALITY_BOXCAR || speaker_quality >= NUM_SPEAKER_QUALITY) {
+        speaker_quality = SPEAKER_QUALITY_BLEP_FAST;
+    }
+}
+
+// Builds the BLEP table for a kernel of the given number of taps.  A Blackman-windowed sinc impulse is integrated into a
+// step, and each row holds the per-sample increments of that step when it begins at the row's sub-sample phase.
+static void _speaker_initBlepTable(float table[BLEP_PHASES][BLEP_TAPS_MAX], unsigned int taps) {
+    const unsigned int len = BLEP_PHASES * taps;
+    double step[BLEP_PHASES * BLEP_TAPS_MAX + 1];
+
+    step[0] = 0.0;
+    for (unsigned int i=0; i<len; i++) {
+        double t = ((double)i + 0.5) / (double)len;
+        double x = 2.0 * M_PI * BLEP_CUTOFF * (((double)i + 0.5) / BLEP_PHASES - taps/2.0);
+        double window = 0.42 - 0.5*cos(2.0*M_PI*t) + 0.08*cos(4.0*M_PI*t);
+        step[i+1] = step[i] + (sin(x) / x) * window;
+    }
+
+    for (unsigned int p=0; p<BLEP_PHASES; p++) {
+        double row_sum = 0.0;
+        double prev = 0.0;
+        for (unsigned int j=0; j<taps; j++) {
+            int k = (int)((j+1) * BLEP_PHASES) - (int)p;
+            double curr = (k <= 0) ? 0.0 : step[k];
+            table[p][j] = (float)(curr - prev);
+            row_sum += curr - prev;
+            prev = curr;
+        }
+        for (unsigned int j=0; j<taps; j++) {
+            table[p][j] = (float)(table[p][j] / row_sum);
+        }
+    }
 }
 
 static __attribute__((constructor)) void _init_speaker(void) {
+    for (unsigned int q=SPEAKER_QUALITY_BLEP_FAST; q<NUM_SPEAKER_QUALITY; q++) {
+        _speaker_initBlepTable(blep_tables[q], blep_taps[q]);
+    }
     prefs_registerListener(PREF_DOMAIN_AUDIO, &speaker_prefsChanged);
 }
 
@@ -133,8 +206,27 @@ static void _speaker_init_timing(void) {
     }
 }
 
+// Appends a sample to all channels : into the backend buffer region while rendering directly, then into samples_buffer
+static inline void _speaker_putSample(int16_t sample) {
+    if (render_span_idx < render_span_size) {
+        render_span[render_span_idx++] = sample;
+        if (NUM_CHANNELS == 2) {
+            render_span[render_span_idx++] = sample;
+        }
+    } else if (samples_buffer_idx < channelsSampleRateHz) {
+        samples_buffer[samples_buffer_idx++] = sample;
+        if (NUM_CHANNELS == 2) {
+            samples_buffer[samples_buffer_idx++] = sample;
+        }
+    }
+}
+
+static inline bool _speaker_outputFull(void) {
+    return (render_span_idx >= render_span_size) && (samples_buffer_idx >= channelsSampleRateHz);
+}
+
 /*
- * Adds to the samples_buffer the number of samples since the last invocation of this function.
+ * Adds to the output (see _speaker_putSample()) the number of samples since the last invocation of this function.
  *
  * Speaker output square wave example:
  *        _______             ____      _____________________!        . +speaker_amplitude
@@ -187,12 +279,7 @@ static void _speaker_update(/*bool toggled*/) {
                 assert(remainder_buffer_size > 0);
                 sample_mean /= (int)remainder_buffer_size;
 
-                if (samples_buffer_idx < channelsSampleRateHz) {
-                    samples_buffer[samples_buffer_idx++] = (int16_t)sample_mean;
-                    if (NUM_CHANNELS == 2) {
-                        samples_buffer[samples_buffer_idx++] = (int16_t)sample_mean;
-                    }
-                }
+                _speaker_putSample((int16_t)sample_mean);
             }
         }
 
@@ -200,12 +287,9 @@ static void _speaker_update(/*bool toggled*/) {
         unsigned long num_samples = samples_count;
         const unsigned long cycles_remainder = (unsigned long)((double)cycles_diff - (double)num_samples * cycles_per_sample);
 
-        // populate samples_buffer with whole samples
-        while (num_samples && (samples_buffer_idx < channelsSampleRateHz)) {
-            samples_buffer[samples_buffer_idx++] = speaker_data;
-            if (NUM_CHANNELS == 2) {
-                samples_buffer[samples_buffer_idx++] = speaker_data;
-            }
+        // output whole samples
+        while (num_samples && !_speaker_outputFull()) {
+            _speaker_putSample(speaker_data);
 #if HACKISHLY_REDUCE_AUDIO_GLITCHES_FOR_FAST_LOADING
             if (speaker_going_silent && speaker_data) {
                 if (speaker_data < 0) {
@@ -242,6 +326,127 @@ static void _speaker_update(/*bool toggled*/) {
     cycles_last_update = cycles_count_total;
 }
 
+static void _speaker_blepReset(void) {
+    toggle_log_count = 0;
+    memset(blep_pending, 0x0, sizeof(blep_pending));
+    blep_pending_head = 0;
+    blep_settle = 0;
+    blep_level = speaker_data;
+    blep_target = speaker_data;
+    blep_phase = 0.0;
+}
+
+// Advances the output by the given (fractional) number of samples, integrating pending step deltas into each sample
+static void _speaker_blepAdvance(double num_samples_frac) {
+    blep_phase += num_samples_frac;
+    unsigned long num_samples = (unsigned long)blep_phase;
+    blep_phase -= (double)num_samples;
+
+    while (num_samples) {
+        if (blep_settle) {
+            blep_level += blep_pending[blep_pending_head];
+            blep_pending[blep_pending_head] = 0.f;
+            blep_pending_head = (blep_pending_head + 1) & (BLEP_PENDING_SIZE-1);
+            if (--blep_settle == 0) {
+                blep_level = blep_target; // drop accumulated rounding error
+            }
+        }
+#if HACKISHLY_REDUCE_AUDIO_GLITCHES_FOR_FAST_LOADING
+        else if (speaker_going_silent && blep_target) {
+            int16_t step = (blep_target < 0) ? SPKR_SILENT_STEP : -SPKR_SILENT_STEP;
+            blep_target += step;
+            speaker_data = blep_target;
+            blep_level = blep_target;
+        }
+#endif
+
+        if (!_speaker_outputFull()) {
+            _speaker_putSample((int16_t)lrintf(blep_level));
+        } else if (!blep_settle && (!speaker_going_silent || !blep_target)) {
+            break; // buffer full and output is steady
+        }
+        --num_samples;
+    }
+}
+
+// Adds a band-limited step to the output at the current sub-sample position
+static void _speaker_blepStep(int16_t level) {
+    const float delta = (float)(level - blep_target);
+    if (delta == 0.f) {
+        return;
+    }
+    blep_target = level;
+
+    const unsigned int taps = blep_taps[speaker_quality_active];
+    const float *row = blep_tables[speaker_quality_active][(unsigned int)(blep_phase * BLEP_PHASES)];
+    for (unsigned int j=0; j<taps; j++) {
+        blep_pending[(blep_pending_head + j) & (BLEP_PENDING_SIZE-1)] += delta * row[j];
+    }
+    blep_settle = taps;
+}
+
+// Renders the logged toggles between cycles_last_update and the given cycle count, emptying the log
+static void _speaker_blepRenderLog(unsigned long cycles_to) {
+    unsigned long cycles_from = cycles_last_update;
+    for (unsigned int i=0; i<toggle_log_count; i++) {
+        _speaker_blepAdvance((double)(toggle_log[i].cycles - cycles_from) / cycles_per_sample);
+        _speaker_blepStep(toggle_log[i].level);
+        cycles_from = toggle_log[i].cycles;
+    }
+    toggle_log_count = 0;
+
+    _speaker_blepAdvance((double)(cycles_to - cycles_from) / cycles_per_sample);
+}
+
+/*
+ * Renders the logged speaker toggles since the last invocation as band-limited steps into the samples_buffer.  Cost is
+ * O(samples + toggles*taps), independent of the number of elapsed CPU cycles.
+ */
+static void _speaker_renderBlep(void) {
+
+    do {
+        if (is_fullspeed) {
+            _speaker_blepReset();
+            break;
+        }
+
+        if (UNLIKELY(cycles_last_update > cycles_count_total)) {
+            LOG("ignoring cycles_count_total overflow ...");
+            _speaker_blepReset();
+            break; // ignore cycles_count_total overflow ...
+        }
+
+        _speaker_blepRenderLog(cycles_count_total);
+    } while (0);
+
+    cycles_last_update = cycles_count_total;
+}
+
+static inline void _speaker_logToggle(void) {
+    if (UNLIKELY(toggle_log_count == SPEAKER_TOGGLE_LOG_MAX)) {
+        _speaker_renderBlep();
+    }
+    toggle_log[toggle_log_count].cycles = cycles_count_total;
+    toggle_log[toggle_log_count].level = speaker_data;
+    ++toggle_log_count;
+}
+
+// Renders pending output with the active synthesis method, switching to the configured method afterwards
+static void _speaker_render(void) {
+    if (speaker_quality_active == SPEAKER_QUALITY_BOXCAR) {
+        _speaker_update(/*toggled:false*/);
+    } else {
+        _speaker_renderBlep();
+    }
+
+    if (speaker_quality_active != speaker_quality) {
+        SPEAKER_LOG("switching speaker quality %ld -> %ld", speaker_quality_active, speaker_quality);
+        speaker_quality_active = speaker_quality;
+        remainder_buffer_idx = 0;
+        _speaker_blepReset();
+    }
+}
+
 /*
  * Submits "quiet" samples to the audio system backend when CPU thread is running fullspeed, to keep the audio streaming
  * topped up.
@@ -286,24 +491,9 @@ static void _submit_samples_buffer_fullspeed(void) {
     speakerBuffer->Unlock(speakerBuffer, system_buffer_size);
 }
 
-// Submits samples from the samples_buffer to the audio system backend when running at a normal scaled-speed.  This also
-// generates cycles feedback to the main CPU timing routine depending on the needs of the streaming audio (more or less
-// data).
-static unsigned long _submit_samples_buffer(const unsigned long num_channel_samples) {
-
-    assert(num_channel_samples);
-
-    unsigned long bytes_queued = 0;
-    long err = speakerBuffer->GetCurrentPosition(speakerBuffer, &bytes_queued);
-    if (err) {
-        return num_channel_samples;
-    }
-    ////assert(bytes_queued <= bufferTotalSize);  -- this is failing on desktop FIXME TODO ...
-
-    //
-    // calculate CPU cycles feedback adjustment to prevent system audio buffer under/overflow
-    //
-
+// Generates cycles feedback to the main CPU timing routine depending on the needs of the streaming audio (more or less
+// data) to prevent system audio buffer under/overflow
+static void _speaker_updateFeedback(unsigned long bytes_queued) {
     if (bytes_queued < bufferSizeIdealMin) {
         samples_adjustment_counter += SOUNDCORE_ERROR_INC; // need moar data
     } else if (bytes_queued > bufferSizeIdealMax) {
@@ -321,6 +511,21 @@ static unsigned long _submit_samples_buffer(const unsigned long num_channel_samp
     cycles_speaker_feedback = (int)(samples_adjustment_counter * cycles_per_sample);
 
     //SPEAKER_LOG("feedback:%d samples_adjustment_counter:%d bytes_queued:%lu", cycles_speaker_feedback, samples_adjustment_counter, bytes_queued);
+}
+
+// Submits samples left over in the samples_buffer to the audio system backend when running at a normal scaled-speed
+static unsigned long _submit_samples_buffer(const unsigned long num_channel_samples) {
+
+    assert(num_channel_samples);
+
+    unsigned long bytes_queued = 0;
+    long err = speakerBuffer->GetCurrentPosition(speakerBuffer, &bytes_queued);
+    if (err) {
+        return num_channel_samples;
+    }
+    ////assert(bytes_queued <= bufferTotalSize);  -- this is failing on desktop FIXME TODO ...
+
+    _speaker_updateFeedback(bytes_queued);
 
     //
     // copy samples to audio system backend
@@ -372,6 +577,43 @@ static unsigned long _submit_samples_buffer(const unsigned long num_channel_samp
     return requested_samples;
 }
 
+// Renders pending output straight into the audio system backend buffer when running at a normal scaled-speed.  Only
+// samples that do not fit the writable region are left in samples_buffer, for _submit_samples_buffer() on a later flush.
+static void _speaker_renderDirect(void) {
+    assert(!samples_buffer_idx);
+
+    unsigned long bytes_queued = 0;
+    long err = speakerBuffer->GetCurrentPosition(speakerBuffer, &bytes_queued);
+    if (err) {
+        _speaker_render();
+        samples_buffer_idx = 0;
+        return;
+    }
+
+    _speaker_updateFeedback(bytes_queued);
+
+    unsigned long span_bytes = 0;
+    if ((bytes_queued < bufferTotalSize) && !speakerBuffer->Lock(speakerBuffer, bufferTotalSize - bytes_queued, &render_span, &span_bytes)) {
+        render_span_size = (span_bytes / sizeof(int16_t)) & ~(unsigned long)(NUM_CHANNELS-1);
+    } else {
+        render_span = NULL;
+        render_span_size = 0;
+    }
+    render_span_idx = 0;
+
+    _speaker_render();
+
+    if (render_span) {
+        err = speakerBuffer->Unlock(speakerBuffer, render_span_idx * sizeof(int16_t));
+        if (err) {
+            LOG("Problem unlocking speaker buffer");
+        }
+    }
+    render_span = NULL;
+    render_span_size = 0;
+    render_span_idx = 0;
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // speaker public API functions
 
@@ -488,7 +730,12 @@ void speaker_flush(void) {
             }
         }
     }
-    _speaker_update(/*toggled:false*/);
+    if (!is_fullspeed && !samples_buffer_idx) {
+        _speaker_renderDirect();
+        return;
+    }
+
+    _speaker_render();
 
     unsigned long samples_used = 0;
     if (is_fullspeed) {
@@ -516,6 +763,55 @@ double speaker_cyclesPerSample(void) {
     return cycles_per_sample;
 }
 
+#if TESTING
+unsigned long _speaker_testRenderBlep(long quality, double cyclesPerSample, const unsigned long *toggles, unsigned int numToggles, unsigned long cyclesTotal, int16_t *samples, unsigned long maxSamples) {
+    assert(quality > SPEAKER_QUALITY_BOXCAR && quality < NUM_SPEAKER_QUALITY);
+    assert(numToggles <= SPEAKER_TOGGLE_LOG_MAX);
+
+    int16_t *savedSamplesBuffer = samples_buffer;
+    unsigned long savedSamplesBufferIdx = samples_buffer_idx;
+    unsigned long savedChannelsSampleRateHz = channelsSampleRateHz;
+    double savedCyclesPerSample = cycles_per_sample;
+    unsigned long savedCyclesLastUpdate = cycles_last_update;
+    long savedQualityActive = speaker_quality_active;
+    int16_t savedData = speaker_data;
+    bool savedGoingSilent = speaker_going_silent;
+
+    samples_buffer = samples;
+    samples_buffer_idx = 0;
+    channelsSampleRateHz = maxSamples;
+    cycles_per_sample = cyclesPerSample;
+    cycles_last_update = 0;
+    speaker_quality_active = quality;
+    speaker_data = 0;
+    speaker_going_silent = false;
+    _speaker_blepReset();
+
+    // toggled the same way as speaker_toggle(), starting from a quiet speaker
+    int16_t level = 0;
+    for (unsigned int i=0; i<numToggles; i++) {
+        level = (level == SPKR_DATA_INIT) ? -SPKR_DATA_INIT : SPKR_DATA_INIT;
+        toggle_log[i].cycles = toggles[i];
+        toggle_log[i].level = level;
+    }
+    toggle_log_count = numToggles;
+    _speaker_blepRenderLog(cyclesTotal);
+    unsigned long numSamples = samples_buffer_idx;
+
+    samples_buffer = savedSamplesBuffer;
+    samples_buffer_idx = savedSamplesBufferIdx;
+    channelsSampleRateHz = savedChannelsSampleRateHz;
+    cycles_per_sample = savedCyclesPerSample;
+    cycles_last_update = savedCyclesLastUpdate;
+    speaker_quality_active = savedQualityActive;
+    speaker_data = savedData;
+    speaker_going_silent = savedGoingSilent;
+    _speaker_blepReset();
+
+    return numSamples;
+}
+#endif
+
 // --------------------------------------------------------------------------------------------------------------------
 // VM system entry point
 
@@ -545,7 +841,7 @@ uint8_t speaker_toggle(void) {
         is_fullspeed = false;
     }
 
-    if (speaker_isAvailable) {
+    if (speaker_isAvailable && (speaker_quality_active == SPEAKER_QUALITY_BOXCAR)) {
         _speaker_update(/*toggled:true*/);
     }
 
@@ -555,6 +851,9 @@ uint8_t speaker_toggle(void) {
         } else {
             speaker_data = speaker_amplitude;
         }
+        if (speaker_isAvailable && (speaker_quality_active != SPEAKER_QUALITY_BOXCAR)) {
+            _speaker_logToggle();
+        }
     }
 #endif
 
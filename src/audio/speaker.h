@@ -16,6 +16,14 @@
 // between speaker and mockingboard
 #define SPKR_DATA_INIT (SHRT_MAX>>3) // 0x0FFF
 
+// speaker synthesis quality (PREF_SPEAKER_QUALITY)
+typedef enum speaker_quality_t {
+    SPEAKER_QUALITY_BOXCAR = 0,     // per-cycle remainder averaging (legacy)
+    SPEAKER_QUALITY_BLEP_FAST,      // band-limited steps, short kernel
+    SPEAKER_QUALITY_BLEP_BEST,      // band-limited steps, long kernel
+    NUM_SPEAKER_QUALITY,
+} speaker_quality_t;
+
 void speaker_init(void) CALL_ON_CPU_THREAD;
 void speaker_destroy(void) CALL_ON_CPU_THREAD;
 void speaker_reset(void);
@@ -29,6 +37,12 @@ uint8_t speaker_toggle(void) CALL_ON_CPU_THREAD;
  */
 double speaker_cyclesPerSample(void);
 
+#if TESTING
+// Render toggles (CPU cycle timestamps) from a quiet speaker with a BLEP quality into interleaved samples, returns the
+// number of samples written
+unsigned long _speaker_testRenderBlep(long quality, double cyclesPerSample, const unsigned long *toggles, unsigned int numToggles, unsigned long cyclesTotal, int16_t *samples, unsigned long maxSamples);
+#endif
+
 #if SPEAKER_TRACING
 void speaker_traceBegin(const char *trace_file);
 void speaker_traceFlush(void);
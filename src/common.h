@@ -26,6 +26,15 @@
 #define PUBLIC
 #define READONLY
 
+// Emulated machine state.  When built with VM_MULTI_INSTANCE=1 this state is thread-local and each headless CPU thread
+// drives an independent //e (see vm-pool.h).  ROMs, fonts, lookup tables and configuration remain process-wide.
+// NOTE : such builds are headless-only, the interactive UI/CPU threads expect to share a single machine
+#if VM_MULTI_INSTANCE
+#   define VM_LOCAL __thread
+#else
+#   define VM_LOCAL
+#endif
+
 #define CALL_ON_UI_THREAD   // function should only be called on UI thread
 #define ASSERT_ON_UI_THREAD() \
     assert(video_isRenderThread())
@@ -73,11 +82,13 @@
 #include "display.h"
 #include "video/video.h"
 #include "disk.h"
+#include "hdd.h"
 #include "keys.h"
 #include "joystick.h"
 #include "glue.h"
 #include "prefs.h"
 #include "zlib-helpers.h"
+#include "vm-pool.h"
 
 #include "meta/systrace.h"
 
@@ -94,6 +105,8 @@
 
 #include "meta/log.h"
 #include "meta/debug.h"
+#include "meta/profiler.h"
+#include "meta/replay.h"
 
 #include "audio/soundcore.h"
 #include "audio/speaker.h"
@@ -22,15 +22,21 @@
 
 #include "common.h"
 
-cpu65_run_args_s run_args = { 0 };
+#if CPU_TRACING
+#   include "meta/cputrace.h"
+#endif
+
+VM_LOCAL cpu65_run_args_s run_args = { 0 };
 
 static pthread_mutex_t irq_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 uint8_t cpu65_flags_encode[256] = { 0 };
 uint8_t cpu65_flags_decode[256] = { 0 };
 
-void *cpu65_vmem_r[256] = { 0 };
-void *cpu65_vmem_w[256] = { 0 };
+VM_LOCAL void *cpu65_vmem_r[256] = { 0 };
+VM_LOCAL void *cpu65_vmem_w[256] = { 0 };
+VM_LOCAL uint8_t cpu65_vmem_rbase[256] = { 0 };
+VM_LOCAL uint8_t cpu65_vmem_wbase[256] = { 0 };
 
 #if CPU_TRACING
 static int8_t opargs[3] = { 0 };
@@ -42,6 +48,7 @@ static FILE *cpu_trace_fp = NULL;
 // ----------------------------------------------------------------------------
 // 65c02 Opcode Jump Table
 
+#if !CPU_PORTABLE
 extern void op_BRK(void), op_ORA_ind_x(void), op_UNK_65c02(void), op_TSB_zpage(void), op_ORA_zpage(void), op_ASL_zpage(void), op_RMB0_65c02(void), op_PHP(void), op_ORA_imm(void), op_ASL_acc(void), op_TSB_abs(void), op_ORA_abs(void), op_ASL_abs(void), op_BBR0_65c02(void), op_BPL(void), op_ORA_ind_y(void), op_ORA_ind_zpage(void), op_TRB_zpage(void), op_ORA_zpage_x(void), op_ASL_zpage_x(void), op_RMB1_65c02(void), op_CLC(void), op_ORA_abs_y(void), op_INA(void), op_TRB_abs(void), op_ORA_abs_x(void), op_ASL_abs_x(void), op_BBR1_65c02(void), op_JSR(void), op_AND_ind_x(void), op_BIT_zpage(void), op_AND_zpage(void), op_ROL_zpage(void), op_RMB2_65c02(void), op_PLP(void), op_AND_imm(void), op_ROL_acc(void), op_BIT_abs(void), op_AND_abs(void), op_ROL_abs(void), op_BBR2_65c02(void), op_BMI(void), op_AND_ind_y(void), op_AND_ind_zpage(void), op_BIT_zpage_x(void), op_AND_zpage_x(void), op_ROL_zpage_x(void), op_RMB3_65c02(void), op_SEC(void), op_AND_abs_y(void), op_DEA(void), op_BIT_abs_x(void), op_AND_abs_x(void), op_ROL_abs_x(void), op_BBR3_65c02(void), op_RTI(void), op_EOR_ind_x(void), op_EOR_zpage(void), op_LSR_zpage(void), op_RMB4_65c02(void), op_PHA(void), op_EOR_imm(void), op_LSR_acc(void), op_JMP_abs(void), op_EOR_abs(void), op_LSR_abs(void), op_BBR4_65c02(void), op_BVC(void), op_EOR_ind_y(void), op_EOR_ind_zpage(void), op_EOR_zpage_x(void), op_LSR_zpage_x(void), op_RMB5_65c02(void), op_CLI(void), op_EOR_abs_y(void), op_PHY(void), op_EOR_abs_x(void), op_LSR_abs_x(void), op_BBR5_65c02(void), op_RTS(void), op_ADC_ind_x(void), op_STZ_zpage(void), op_ADC_zpage(void), op_ROR_zpage(void), op_RMB6_65c02(void), op_PLA(void), op_ADC_imm(void), op_ROR_acc(void), op_JMP_ind(void), op_ADC_abs(void), op_ROR_abs(void), op_BBR6_65c02(void), op_BVS(void), op_ADC_ind_y(void), op_ADC_ind_zpage(void), op_STZ_zpage_x(void), op_ADC_zpage_x(void), op_ROR_zpage_x(void), op_RMB7_65c02(void), op_SEI(void), op_ADC_abs_y(void), op_PLY(void), op_JMP_abs_ind_x(void), op_ADC_abs_x(void), op_ROR_abs_x(void), op_BBR7_65c02(void), op_BRA(void), op_STA_ind_x(void), op_STY_zpage(void), op_STA_zpage(void), op_STX_zpage(void), op_SMB0_65c02(void), op_DEY(void), op_BIT_imm(void), op_TXA(void), op_STY_abs(void), op_STA_abs(void), op_STX_abs(void), op_BBS0_65c02(void), op_BCC(void), op_STA_ind_y(void), op_STA_ind_zpage(void), op_STY_zpage_x(void), op_STA_zpage_x(void), op_STX_zpage_y(void), op_SMB1_65c02(void), op_TYA(void), op_STA_abs_y(void), op_TXS(void), op_STZ_abs(void), op_STA_abs_x(void), op_STZ_abs_x(void), op_BBS1_65c02(void), op_LDY_imm(void), op_LDA_ind_x(void), op_LDX_imm(void), op_LDY_zpage(void), op_LDA_zpage(void), op_LDX_zpage(void), op_SMB2_65c02(void), op_TAY(void), op_LDA_imm(void), op_TAX(void), op_LDY_abs(void), op_LDA_abs(void), op_LDX_abs(void), op_BBS2_65c02(void), op_BCS(void), op_LDA_ind_y(void), op_LDA_ind_zpage(void), op_LDY_zpage_x(void), op_LDA_zpage_x(void), op_LDX_zpage_y(void), op_SMB3_65c02(void), op_CLV(void), op_LDA_abs_y(void), op_TSX(void), op_LDY_abs_x(void), op_LDA_abs_x(void), op_LDX_abs_y(void), op_BBS3_65c02(void), op_CPY_imm(void), op_CMP_ind_x(void), op_CPY_zpage(void), op_CMP_zpage(void), op_DEC_zpage(void), op_SMB4_65c02(void), op_INY(void), op_CMP_imm(void), op_DEX(void), op_WAI_65c02(void), op_CPY_abs(void), op_CMP_abs(void), op_DEC_abs(void), op_BBS4_65c02(void), op_BNE(void), op_CMP_ind_y(void), op_CMP_ind_zpage(void), op_CMP_zpage_x(void), op_DEC_zpage_x(void), op_SMB5_65c02(void), op_CLD(void), op_CMP_abs_y(void), op_PHX(void), op_STP_65c02(void), op_CMP_abs_x(void), op_DEC_abs_x(void), op_BBS5_65c02(void), op_CPX_imm(void), op_SBC_ind_x(void), op_CPX_zpage(void), op_SBC_zpage(void), op_INC_zpage(void), op_SMB6_65c02(void), op_INX(void), op_SBC_imm(void), op_NOP(void), op_CPX_abs(void), op_SBC_abs(void), op_INC_abs(void), op_BBS6_65c02(void), op_BEQ(void), op_SBC_ind_y(void), op_SBC_ind_zpage(void), op_SBC_zpage_x(void), op_INC_zpage_x(void), op_SMB7_65c02(void), op_SED(void), op_SBC_abs_y(void), op_PLX(void), op_SBC_abs_x(void), op_INC_abs_x(void), op_BBS7_65c02(void);
 
 void *cpu65__opcodes[256] = {
@@ -302,6 +309,7 @@ void *cpu65__opcodes[256] = {
     op_INC_abs_x,
     op_BBS7_65c02
 };
+#endif
 
 // ----------------------------------------------------------------------------
 // Base values for opcode cycle counts
@@ -565,6 +573,27 @@ uint8_t cpu65__opcycles[256] = {
     5  // op_BBS7_65c02
 };
 
+// Count of operand bytes each opcode fetches from the instruction stream (immediate operands are read through the
+// effective address instead).  Used to stage cpu65_operand when an instruction cannot be fetched directly.
+uint8_t cpu65__opbytes[256] = {
+    0, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 2, 2, 2, 0, // 00
+    1, 1, 1, 0, 1, 1, 1, 0, 0, 2, 0, 0, 2, 2, 2, 0, // 10
+    2, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 2, 2, 2, 0, // 20
+    1, 1, 1, 0, 1, 1, 1, 0, 0, 2, 0, 0, 2, 2, 2, 0, // 30
+    0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 2, 2, 2, 0, // 40
+    1, 1, 1, 0, 0, 1, 1, 0, 0, 2, 0, 0, 0, 2, 2, 0, // 50
+    0, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 2, 2, 2, 0, // 60
+    1, 1, 1, 0, 1, 1, 1, 0, 0, 2, 0, 0, 2, 2, 2, 0, // 70
+    1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 2, 2, 2, 0, // 80
+    1, 1, 1, 0, 1, 1, 1, 0, 0, 2, 0, 0, 2, 2, 2, 0, // 90
+    0, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 2, 2, 2, 0, // A0
+    1, 1, 1, 0, 1, 1, 1, 0, 0, 2, 0, 0, 2, 2, 2, 0, // B0
+    0, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 2, 2, 2, 0, // C0
+    1, 1, 1, 0, 0, 1, 1, 0, 0, 2, 0, 0, 0, 2, 2, 0, // D0
+    0, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 2, 2, 2, 0, // E0
+    1, 1, 1, 0, 0, 1, 1, 0, 0, 2, 0, 0, 0, 2, 2, 0  // F0
+};
+
 // NOTE: currently this is a conversion table between i386 flags <-> 6502 P register
 static void init_flags_conversion_tables(void) {
     for (unsigned int i = 0; i < 256; i++) {
@@ -607,15 +636,18 @@ static void init_flags_conversion_tables(void) {
     }
 }
 
-static __attribute__((constructor)) void __init_cpu65(void) {
-    // emulator_registerStartupCallback(CTOR_PRIORITY_LATE, &_init_cpu65); -- 2018/01/15 NOTE : too late for testcpu.c
-
+static void _init_run_args(void) {
     run_args.cpu65_vmem_r = &cpu65_vmem_r[0];
     run_args.cpu65_vmem_w = &cpu65_vmem_w[0];
     run_args.cpu65_flags_encode = &cpu65_flags_encode[0];
     run_args.cpu65_flags_decode = &cpu65_flags_decode[0];
+#if !CPU_PORTABLE
     run_args.cpu65__opcodes = &cpu65__opcodes[0];
+#endif
     run_args.cpu65__opcycles = &cpu65__opcycles[0];
+    run_args.cpu65_vmem_rbase = &cpu65_vmem_rbase[0];
+    run_args.cpu65_vmem_wbase = &cpu65_vmem_wbase[0];
+    run_args.cpu65__opbytes = &cpu65__opbytes[0];
 
     run_args.interrupt_vector = 0xFFFE;
     run_args.reset_vector = 0xFFFC;
@@ -632,12 +664,20 @@ static __attribute__((constructor)) void __init_cpu65(void) {
 #endif
 
 #ifndef NDEBUG
-    extern uint8_t (*debug_illegal_bcd)(uint16_t);
-    run_args.debug_illegal_bcd = debug_illegal_bcd;
+    extern void debug_illegal_bcd(uint16_t, uint8_t);
+    run_args.debug_illegal_bcd = (uint8_t (*)(uint16_t))debug_illegal_bcd;
 #endif
 }
 
+static __attribute__((constructor)) void __init_cpu65(void) {
+    // emulator_registerStartupCallback(CTOR_PRIORITY_LATE, &_init_cpu65); -- 2018/01/15 NOTE : too late for testcpu.c
+    _init_run_args();
+}
+
 void cpu65_init(void) {
+#if VM_MULTI_INSTANCE
+    _init_run_args(); // run_args is per-thread, the ctor only initialized the main thread's copy
+#endif
     init_flags_conversion_tables();
     run_args.cpu65__signal = 0;
     run_args.cpu65_pc = 0x0;
@@ -662,8 +702,8 @@ void cpu65_uninterrupt(int reason) {
 }
 
 void cpu65_reboot(void) {
-    run_args.joy_button0 = 0xff; // OpenApple -- should be balanced by joystick_reset() triggers on CPU thread
-    cpu65_interrupt(ResetSig);
+    replay_input(REPLAY_INPUT_BUTTON0, 0xff); // OpenApple -- should be balanced by joystick_reset() triggers on CPU thread
+    replay_input(REPLAY_INPUT_RESET, 0);
 }
 
 bool cpu65_saveState(StateHelper_s *helper) {
@@ -751,6 +791,15 @@ bool cpu65_loadState(StateHelper_s *helper) {
     return loaded;
 }
 
+/* -------------------------------------------------------------------------
+    CPU profiling hook (see meta/profiler.h)
+   ------------------------------------------------------------------------- */
+
+GLUE_C_WRITE(cpu65_profile_sample)
+{
+    profiler_sample(b);
+}
+
 #if CPU_TRACING
 extern const struct opcode_struct_s opcodes_65c02[256];
 extern const uint8_t opcodes_65c02_numargs[256];
@@ -759,28 +808,212 @@ extern const uint8_t opcodes_65c02_numargs[256];
     CPU Tracing routines
    ------------------------------------------------------------------------- */
 
+// Binary trace : records are staged by the CPU thread in a large single-producer/single-consumer ring and written out
+// in bulk by a flusher thread.  The CPU thread only blocks (and only takes the mutex) when the ring is full or a flush
+// chunk has filled up.
+
+#define CPUTRACE_RING_RECORDS (1<<20)
+#define CPUTRACE_FLUSH_RECORDS (1<<16)
+
+static struct {
+    cputrace_record_s *ring;
+    unsigned long head; // advanced only by the CPU thread
+    unsigned long tail; // advanced only by the flusher thread
+    unsigned long cycles;
+    int fd;
+    bool stopping;
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    pthread_cond_t drainedCond;
+} cputrace = {
+    .fd = -1,
+    .mutex = PTHREAD_MUTEX_INITIALIZER,
+    .cond = PTHREAD_COND_INITIALIZER,
+    .drainedCond = PTHREAD_COND_INITIALIZER,
+};
+
+static bool _cputrace_write(int fd, const uint8_t *buf, size_t len) {
+    ssize_t outlen = 0;
+    while (len > 0) {
+        if (TEMP_FAILURE_RETRY(outlen = write(fd, buf, len)) == -1) {
+            LOG("OOPS, error writing binary CPU trace (%s)", strerror(errno));
+            return false;
+        }
+        buf += outlen;
+        len -= outlen;
+    }
+    return true;
+}
+
+static void *_cputrace_flushThread(void *ctx) {
+    (void)ctx;
+
+    bool ok = true;
+    pthread_mutex_lock(&cputrace.mutex);
+    do {
+        unsigned long head = 0;
+        while (((head = __atomic_load_n(&cputrace.head, __ATOMIC_ACQUIRE)) - cputrace.tail < CPUTRACE_FLUSH_RECORDS) && !cputrace.stopping) {
+            pthread_cond_wait(&cputrace.cond, &cputrace.mutex);
+        }
+        bool stopping = cputrace.stopping;
+        pthread_mutex_unlock(&cputrace.mutex);
+
+        while (cputrace.tail != head) {
+            unsigned long idx = cputrace.tail & (CPUTRACE_RING_RECORDS-1);
+            unsigned long count = MIN(head - cputrace.tail, CPUTRACE_RING_RECORDS - idx);
+            if (ok) {
+                ok = _cputrace_write(cputrace.fd, (const uint8_t *)&cputrace.ring[idx], count * sizeof(cputrace_record_s));
+            }
+            __atomic_store_n(&cputrace.tail, cputrace.tail + count, __ATOMIC_RELEASE);
+        }
+
+        pthread_mutex_lock(&cputrace.mutex);
+        pthread_cond_broadcast(&cputrace.drainedCond);
+        if (stopping) {
+            break;
+        }
+    } while (1);
+    pthread_mutex_unlock(&cputrace.mutex);
+
+    return NULL;
+}
+
+static inline cputrace_record_s *_cputrace_reserve(void) {
+    unsigned long head = cputrace.head;
+    if (UNLIKELY(head - __atomic_load_n(&cputrace.tail, __ATOMIC_ACQUIRE) >= CPUTRACE_RING_RECORDS)) {
+        pthread_mutex_lock(&cputrace.mutex);
+        pthread_cond_signal(&cputrace.cond);
+        while (head - __atomic_load_n(&cputrace.tail, __ATOMIC_ACQUIRE) >= CPUTRACE_RING_RECORDS) {
+            pthread_cond_wait(&cputrace.drainedCond, &cputrace.mutex);
+        }
+        pthread_mutex_unlock(&cputrace.mutex);
+    }
+
+    return &cputrace.ring[head & (CPUTRACE_RING_RECORDS-1)];
+}
+
+static inline void _cputrace_commit(cputrace_record_s *rec) {
+    // NOTE : stamped after the record is filled since sampling the video scanner checkpoints cycles_count_total
+    rec->cyclesDelta = (uint32_t)(cycles_count_total - cputrace.cycles);
+    cputrace.cycles = cycles_count_total;
+
+    unsigned long head = cputrace.head + 1;
+    __atomic_store_n(&cputrace.head, head, __ATOMIC_RELEASE);
+    if (UNLIKELY((head & (CPUTRACE_FLUSH_RECORDS-1)) == 0)) {
+        pthread_mutex_lock(&cputrace.mutex);
+        pthread_cond_signal(&cputrace.cond);
+        pthread_mutex_unlock(&cputrace.mutex);
+    }
+}
+
+static void _cputrace_fillRecord(cputrace_record_s *rec) {
+    rec->type = CPUTRACE_OPCODE;
+    rec->pc = current_pc;
+    rec->ea = run_args.cpu65_ea;
+    rec->opcode = run_args.cpu65_opcode;
+    rec->arg1 = (uint8_t)opargs[1];
+    rec->arg2 = (uint8_t)opargs[2];
+    rec->a = run_args.cpu65_a;
+    rec->x = run_args.cpu65_x;
+    rec->y = run_args.cpu65_y;
+    rec->f = run_args.cpu65_f;
+    rec->sp = run_args.cpu65_sp;
+    rec->opcycles = run_args.cpu65_opcycles;
+    rec->vidAddr = video_scannerAddress(NULL);
+    rec->vidData = apple_ii_64k[0][rec->vidAddr];
+}
+
 void cpu65_trace_begin(const char *trace_file) {
     if (trace_file) {
         cpu_trace_fp = fopen(trace_file, "w");
     }
 }
 
+void cpu65_trace_beginBinary(const char *trace_file) {
+    if (!trace_file || cputrace.ring) {
+        return;
+    }
+
+    do {
+        TEMP_FAILURE_RETRY(cputrace.fd = open(trace_file, O_WRONLY|O_CREAT|O_TRUNC, S_IRUSR|S_IWUSR|S_IRGRP|S_IROTH));
+        if (cputrace.fd < 0) {
+            LOG("OOPS, could not open binary CPU trace %s (%s)", trace_file, strerror(errno));
+            break;
+        }
+
+        cputrace_header_s header = {
+            .version = CPUTRACE_VERSION,
+            .recordSize = sizeof(cputrace_record_s),
+            .cyclesBase = cycles_count_total,
+        };
+        memcpy(header.magick, CPUTRACE_MAGICK, CPUTRACE_MAGICK_LEN);
+        if (!_cputrace_write(cputrace.fd, (const uint8_t *)&header, sizeof(header))) {
+            break;
+        }
+
+        cputrace.ring = CALLOC(CPUTRACE_RING_RECORDS, sizeof(cputrace_record_s));
+        if (!cputrace.ring) {
+            LOG("OOPS, not enough memory for binary CPU trace ring");
+            break;
+        }
+        cputrace.head = 0;
+        cputrace.tail = 0;
+        cputrace.cycles = cycles_count_total;
+        cputrace.stopping = false;
+
+        int err = TEMP_FAILURE_RETRY(pthread_create(&cputrace.thread, NULL, &_cputrace_flushThread, NULL));
+        if (err) {
+            LOG("OOPS, could not create binary CPU trace thread (%d)", err);
+            FREE(cputrace.ring);
+            break;
+        }
+
+        return;
+    } while (0);
+
+    if (cputrace.fd >= 0) {
+        TEMP_FAILURE_RETRY(close(cputrace.fd));
+        cputrace.fd = -1;
+    }
+}
+
 void cpu65_trace_end(void) {
     if (cpu_trace_fp) {
         fflush(cpu_trace_fp);
         fclose(cpu_trace_fp);
         cpu_trace_fp = NULL;
     }
+
+    if (cputrace.ring) {
+        pthread_mutex_lock(&cputrace.mutex);
+        cputrace.stopping = true;
+        pthread_cond_signal(&cputrace.cond);
+        pthread_mutex_unlock(&cputrace.mutex);
+        pthread_join(cputrace.thread, NULL);
+
+        FREE(cputrace.ring);
+        TEMP_FAILURE_RETRY(close(cputrace.fd));
+        cputrace.fd = -1;
+    }
 }
 
 void cpu65_trace_toggle(const char *trace_file) {
-    if (cpu_trace_fp) {
+    if (cpu_trace_fp || cputrace.ring) {
         cpu65_trace_end();
     } else {
         cpu65_trace_begin(trace_file);
     }
 }
 
+void cpu65_trace_toggleBinary(const char *trace_file) {
+    if (cpu_trace_fp || cputrace.ring) {
+        cpu65_trace_end();
+    } else {
+        cpu65_trace_beginBinary(trace_file);
+    }
+}
+
 GLUE_C_WRITE(cpu65_trace_prologue)
 {
     nargs = 0;
@@ -795,10 +1028,7 @@ GLUE_C_WRITE(cpu65_trace_arg)
 
 GLUE_C_WRITE(cpu65_trace_epilogue)
 {
-    int8_t arg1 = opargs[1];
-    int8_t arg2 = opargs[2];
-
-    if (!cpu_trace_fp) {
+    if (!cpu_trace_fp && !cputrace.ring) {
         return;
     }
 
@@ -808,123 +1038,31 @@ GLUE_C_WRITE(cpu65_trace_epilogue)
         assert(false && "OOPS, most likely some cpu.S routine is not properly setting the arg value");
     }
 
-    switch (opcodes_65c02[run_args.cpu65_opcode].mode) {
-        case addr_implied:
-        case addr_accumulator:
-            fprintf(cpu_trace_fp, "%04X:%02X    ", current_pc, run_args.cpu65_opcode);
-            break;
-        case addr_immediate:
-        case addr_zeropage:
-        case addr_zeropage_x:
-        case addr_zeropage_y:
-        case addr_indirect:
-        case addr_indirect_x:
-        case addr_indirect_y:
-        case addr_relative:
-            fprintf(cpu_trace_fp, "%04X:%02X%02X  ", current_pc, run_args.cpu65_opcode, (uint8_t)arg1);
-            break;
-        case addr_absolute:
-        case addr_absolute_x:
-        case addr_absolute_y:
-        case addr_j_indirect:
-        case addr_j_indirect_x:
-            fprintf(cpu_trace_fp, "%04X:%02X%02X%02X", current_pc, run_args.cpu65_opcode, (uint8_t)arg1, (uint8_t)arg2);
-            break;
-        default:
-            fprintf(cpu_trace_fp, "invalid opcode mode");
-            break;
-    }
-
-    fprintf(cpu_trace_fp, " SP:%02X X:%02X Y:%02X A:%02X", run_args.cpu65_sp, run_args.cpu65_x, run_args.cpu65_y, run_args.cpu65_a);
-
-#define FLAGS_BUFSZ 9
-    char flags_buf[FLAGS_BUFSZ];
-    memset(flags_buf, '-', FLAGS_BUFSZ);
-    if (run_args.cpu65_f & C_Flag_6502) {
-        flags_buf[0]='C';
-    }
-    if (run_args.cpu65_f & X_Flag_6502) {
-        flags_buf[1]='X';
-    }
-    if (run_args.cpu65_f & I_Flag_6502) {
-        flags_buf[2]='I';
-    }
-    if (run_args.cpu65_f & V_Flag_6502) {
-        flags_buf[3]='V';
-    }
-    if (run_args.cpu65_f & B_Flag_6502) {
-        flags_buf[4]='B';
-    }
-    if (run_args.cpu65_f & D_Flag_6502) {
-        flags_buf[5]='D';
-    }
-    if (run_args.cpu65_f & Z_Flag_6502) {
-        flags_buf[6]='Z';
-    }
-    if (run_args.cpu65_f & N_Flag_6502) {
-        flags_buf[7]='N';
-    }
-    flags_buf[8] = '\0';
-
-    char fmt[64];
-    if (UNLIKELY(run_args.cpu65_opcycles >= 10)) {
-        // occurs rarely for interrupt + opcode
-        snprintf(fmt, 64, "%s", " %s CY:%u");
-    } else {
-        snprintf(fmt, 64, "%s", " %s CYC:%u");
+    if (cputrace.ring) {
+        cputrace_record_s *rec = _cputrace_reserve();
+        _cputrace_fillRecord(rec);
+        _cputrace_commit(rec);
+        return;
     }
-    fprintf(cpu_trace_fp, fmt, flags_buf, run_args.cpu65_opcycles);
-
-    uint16_t vidAddr = video_scannerAddress(NULL);
-    uint8_t vidData = apple_ii_64k[0][vidAddr];
-    fprintf(cpu_trace_fp, " VID:%04X:%02X", vidAddr, vidData);
 
+    cputrace_record_s rec = { 0 };
+    _cputrace_fillRecord(&rec);
 #if CPU_TRACING_SHOW_EA
-    fprintf(cpu_trace_fp, " EA:%04X", run_args.cpu65_ea);
+    cputrace_printRecord(cpu_trace_fp, &rec, cycles_count_total, /*showEA:*/true);
+#else
+    cputrace_printRecord(cpu_trace_fp, &rec, cycles_count_total, /*showEA:*/false);
 #endif
-
-    fprintf(cpu_trace_fp, " CY+%lu", (cycles_count_total + run_args.cpu65_opcycles));
-
-    sprintf(fmt, " %s %s", opcodes_65c02[run_args.cpu65_opcode].mnemonic, disasm_templates[opcodes_65c02[run_args.cpu65_opcode].mode]);
-
-    switch (opcodes_65c02[run_args.cpu65_opcode].mode) {
-        case addr_implied:
-        case addr_accumulator:
-            fprintf(cpu_trace_fp, "%s", fmt);
-            break;
-        case addr_immediate:
-        case addr_zeropage:
-        case addr_zeropage_x:
-        case addr_zeropage_y:
-        case addr_indirect:
-        case addr_indirect_x:
-        case addr_indirect_y:
-            fprintf(cpu_trace_fp, fmt, (uint8_t)arg1);
-            break;
-        case addr_absolute:
-        case addr_absolute_x:
-        case addr_absolute_y:
-        case addr_j_indirect:
-        case addr_j_indirect_x:
-            fprintf(cpu_trace_fp, fmt, (uint8_t)arg2, (uint8_t)arg1);
-            break;
-        case addr_relative:
-            if (arg1 < 0) {
-                fprintf(cpu_trace_fp, fmt, current_pc + arg1 + 2, '-', (uint8_t)(-arg1));
-            } else {
-                fprintf(cpu_trace_fp, fmt, current_pc + arg1 + 2, '+', (uint8_t)arg1);
-            }
-            break;
-        default:
-            break;
-    }
-
-    fprintf(cpu_trace_fp, "%s", "\n");
 }
 
 GLUE_C_WRITE(cpu65_trace_irq)
 {
-    if (cpu_trace_fp) {
+    if (cputrace.ring) {
+        cputrace_record_s *rec = _cputrace_reserve();
+        memset(rec, 0x0, sizeof(*rec));
+        rec->type = CPUTRACE_IRQ;
+        rec->opcode = run_args.cpu65__signal;
+        _cputrace_commit(rec);
+    } else if (cpu_trace_fp) {
         fprintf(cpu_trace_fp, "IRQ:%02X\n", run_args.cpu65__signal);
     }
 }
@@ -30,7 +30,7 @@
 #define MEM_READ_FLAG  (1<<0)
 #define MEM_WRITE_FLAG (1<<1)
 
-extern cpu65_run_args_s run_args;
+extern VM_LOCAL cpu65_run_args_s run_args;
 
 /* Set up the processor for a new run. Sets up opcode table. */
 extern void cpu65_init(void);
@@ -47,16 +47,26 @@ extern bool cpu65_loadState(StateHelper_s *helper);
 
 extern void cpu65_direct_write(int ea,int data);
 
-extern void *cpu65_vmem_r[256];
-extern void *cpu65_vmem_w[256];
+extern VM_LOCAL void *cpu65_vmem_r[256];
+extern VM_LOCAL void *cpu65_vmem_w[256];
+
+// Per-page offset of the run_args base pointer that backs a plain RAM/ROM cpu65_vmem_r page (0 : handler-only page).
+// Instructions and data on such pages are read directly from host memory rather than through the read handler.
+extern VM_LOCAL uint8_t cpu65_vmem_rbase[256];
+
+// Likewise for plain RAM cpu65_vmem_w pages.  A NULL base pointer (e.g. language card write-protected) drops the write.
+extern VM_LOCAL uint8_t cpu65_vmem_wbase[256];
 
 extern uint8_t cpu65_flags_encode[256];
 extern uint8_t cpu65_flags_decode[256];
 
 #if CPU_TRACING
 void cpu65_trace_begin(const char *trace_file);
+// trace in the compact binary format of meta/cputrace.h (decode with cputrace_decode)
+void cpu65_trace_beginBinary(const char *trace_file);
 void cpu65_trace_end(void);
 void cpu65_trace_toggle(const char *trace_file);
+void cpu65_trace_toggleBinary(const char *trace_file);
 void cpu65_trace_checkpoint(void);
 #endif
 
@@ -69,11 +79,50 @@ void cpu65_trace_checkpoint(void);
 #define IRQMouse        0x40
 #define IRQGeneric      0x80
 
+/*
+ * Debugger halt map (run_args.cpu65_haltmap) : 64K-bit maps of the addresses that stop cpu65_run() once an instruction
+ * has executed and the next PC (exec), the last effective read (read) or write (write) address is set, followed by a
+ * map of opcodes.  Bit n lives in byte n>>3, bit n&7.  The ARM core does not check the map (debugger single-steps).
+ */
+#define HALTMAP_EXEC    0x0000
+#define HALTMAP_READ    0x2000
+#define HALTMAP_WRITE   0x4000
+#define HALTMAP_OPCODE  0x6000
+#define HALTMAP_SIZ     0x6020
+
+#if CPU_PORTABLE || defined(__i386__) || defined(__x86_64__)
+#   define CPU65_HALTMAP_INLINE 1
+#endif
+
+/*
+ * Profiler hook (run_args.cpu65_profile) : called after each instruction with the cycles it took and run_args.cpu65_pc
+ * set to the next PC, or with one of these markers once the core has vectored to the IRQ or reset handler.  The ARM
+ * core does not call the hook.
+ */
+#define PROFILE_IRQ     0x00
+#define PROFILE_RESET   0xFF
+
+#if CPU_PORTABLE || defined(__i386__) || defined(__x86_64__)
+#   define CPU65_PROFILE_HOOK 1
+#endif
+
 /* Note: These are *not* the bit positions used for the flags in the P
  * register of a real 65c02. Rather, they have been distorted so that C,
  * N, Z, etc match the analogous flags in the host flags register.
  */
-#if defined(__i386__) || defined(__x86_64__)
+#if CPU_PORTABLE
+/*
+ * Portable C core : flags are kept in 6502 P register order (flags encode/decode tables are the identity).
+ */
+#   define C_Flag          0x1             /* 6502 Carry              */
+#   define Z_Flag          0x2             /* 6502 Zero               */
+#   define I_Flag          0x4             /* 6502 Interrupt disable  */
+#   define D_Flag          0x8             /* 6502 Decimal mode       */
+#   define B_Flag          0x10            /* 6502 Break              */
+#   define X_Flag          0x20            /* 6502 Xtra               */
+#   define V_Flag          0x40            /* 6502 oVerflow           */
+#   define N_Flag          0x80            /* 6502 Negative           */
+#elif defined(__i386__) || defined(__x86_64__)
 /*
  * x86 NOTE: V matches the position of the overflow flag in the high byte
  * of the 80386 register.
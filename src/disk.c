@@ -23,6 +23,10 @@
 
 #define READONLY_FD 0x00DEADFD
 
+#define TRACK_BIT(trk) (1ULL << (trk))
+
+#define DISK_MOTOR_SPINDOWN_CYCLES 1000000UL // the motor keeps spinning ~1 second after it is switched off (as in AppleWin)
+
 #if DISK_TRACING
 static FILE *test_read_fp = NULL;
 static FILE *test_write_fp = NULL;
@@ -30,12 +34,17 @@ static FILE *test_write_fp = NULL;
 
 extern uint8_t slot6_rom[256];
 
-drive_t disk6 = { { 0 } };
+VM_LOCAL drive_t disk6 = {
+    .disk = {
+        { .fd = -1, .raw_image_data = MAP_FAILED },
+        { .fd = -1, .raw_image_data = MAP_FAILED },
+    },
+};
 
-static uint8_t disk_a[NIB_SIZE] = { 0 };
-static uint8_t disk_a_raw[NIB_SIZE] = { 0 };
-static uint8_t disk_b[NIB_SIZE] = { 0 };
-static uint8_t disk_b_raw[NIB_SIZE] = { 0 };
+static VM_LOCAL uint8_t disk_a[NIB_SIZE] = { 0 };
+static VM_LOCAL uint8_t disk_a_raw[NIB_SIZE] = { 0 };
+static VM_LOCAL uint8_t disk_b[NIB_SIZE] = { 0 };
+static VM_LOCAL uint8_t disk_b_raw[NIB_SIZE] = { 0 };
 
 #if TESTING
 #   define STATIC
@@ -43,11 +52,15 @@ static uint8_t disk_b_raw[NIB_SIZE] = { 0 };
 #   define STATIC static
 #endif
 
-STATIC int stepper_phases = 0; // state bits for stepper magnet phases 0-3
+STATIC VM_LOCAL int stepper_phases = 0; // state bits for stepper magnet phases 0-3
 
 STATIC int skew_table_6_po[16] = { 0x00,0x08,0x01,0x09,0x02,0x0A,0x03,0x0B, 0x04,0x0C,0x05,0x0D,0x06,0x0E,0x07,0x0F }; // ProDOS order
 STATIC int skew_table_6_do[16] = { 0x00,0x07,0x0E,0x06,0x0D,0x05,0x0C,0x04, 0x0B,0x03,0x0A,0x02,0x09,0x01,0x08,0x0F }; // DOS order
 
+// Inverse of the skew tables : DOS logical sector (resp. ProDOS half-block) to physical sector
+static int physical_sector_do[NUM_SECTORS] = { 0 };
+static int physical_sector_po[NUM_SECTORS] = { 0 };
+
 static pthread_mutex_t insertion_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 static uint8_t translate_table_6[0x40] = {
@@ -89,6 +102,10 @@ static uint8_t translate_table_6[0x40] = {
 
 static uint8_t rev_translate_table_6[0x80] = { 0x01 };
 
+static uintptr_t page_mask = 0; // msync() alignment of write-back regions
+
+static void disk6_prefsChanged(const char *domain);
+
 static void _init_disk6(void) {
     LOG("Disk ][ emulation module early setup");
     memset(&disk6, 0x0, sizeof(disk6));
@@ -100,6 +117,15 @@ static void _init_disk6(void) {
     for (unsigned int i=0; i<0x40; i++) {
         rev_translate_table_6[translate_table_6[i]-0x80] = i << 2;
     }
+
+    for (unsigned int phys=0; phys<NUM_SECTORS; phys++) {
+        physical_sector_do[skew_table_6_do[phys]] = phys;
+        physical_sector_po[skew_table_6_po[phys]] = phys;
+    }
+
+    page_mask = ~(uintptr_t)(sysconf(_SC_PAGESIZE) - 1);
+
+    prefs_registerListener(PREF_DOMAIN_INTERFACE, &disk6_prefsChanged);
 }
 
 static __attribute__((constructor)) void __init_disk6(void) {
@@ -120,6 +146,20 @@ static inline bool is_nib(const char * const name) {
     return strncmp(name+len-_NIBLEN, DISK_EXT_NIB, _NIBLEN) == 0;
 }
 
+static inline bool is_woz(const char * const name) {
+    size_t len = strlen(name);
+    if (len <= _WOZLEN) {
+        return false;
+    }
+    if (is_gz(name)) {
+        if (len <= _WOZLEN+_GZLEN) {
+            return false;
+        }
+        len -= _GZLEN;
+    }
+    return strncmp(name+len-_WOZLEN, DISK_EXT_WOZ, _WOZLEN) == 0;
+}
+
 static inline bool is_po(const char * const name) {
     size_t len = strlen( name );
     if (len <= _POLEN) {
@@ -267,7 +307,7 @@ static void denibblize_sector(const uint8_t * const src, uint8_t * const out) {
 #define CODE44A(a) ((((a)>> 1) & 0x55) | 0xAA)
 #define CODE44B(b) (((b) & 0x55) | 0xAA)
 
-static unsigned long nibblize_track(const uint8_t * const buf, int drive, uint8_t *output) {
+static unsigned long nibblize_track(const uint8_t * const buf, int drive, unsigned int track, uint8_t *output) {
     SCOPE_TRACE_DISK("nibblize_track");
 
     uint8_t * const begin_track = output;
@@ -299,7 +339,6 @@ static unsigned long nibblize_track(const uint8_t * const buf, int drive, uint8_
         *(output)++ = CODE44B(DSK_VOLUME);
 
         // Track    (4-and-4 encoded)
-        int track = (disk6.disk[drive].phase>>1);
         *(output)++ = CODE44A(track);
         *(output)++ = CODE44B(track);
 
@@ -357,7 +396,7 @@ static unsigned long nibblize_track(const uint8_t * const buf, int drive, uint8_
     return output - begin_track;
 }
 
-static void denibblize_track(const uint8_t * const src, int drive, uint8_t * const dst) {
+static void denibblize_track(const uint8_t * const src, unsigned int trackwidth, const int * const skew_table, uint8_t * const dst) {
     SCOPE_TRACE_DISK("denibblize_track");
 
     // Searches through the track data for each sector and decodes it
@@ -372,8 +411,6 @@ static void denibblize_track(const uint8_t * const src, int drive, uint8_t * con
     unsigned int offset = 0;
     int sector = -1;
 
-    const unsigned int trackwidth = disk6.disk[drive].track_width;
-
     // iterate over 2x sectors (accounting for header and data sections)
     for (unsigned int sct2=0; sct2<(NUM_SECTORS<<1)+1; sct2++) {
         uint8_t prologue[3] = {0,0,0}; // D5AA..
@@ -418,62 +455,208 @@ static void denibblize_track(const uint8_t * const src, int drive, uint8_t * con
             offset = (offset+1) % trackwidth;
         }
         assert(sector >= 0 && sector < 16 && "invalid previous nibblization");
-        int sec_off = 256 * disk6.disk[drive].skew_table[ sector ];
+        int sec_off = 256 * skew_table[ sector ];
         denibblize_sector(work_buf, dst+sec_off);
         sector = -1;
     }
 }
 
-static unsigned int load_track_data(int drive) {
+static unsigned int load_track_data(int drive, unsigned int trk) {
     SCOPE_TRACE_DISK("load_track_data");
 
     unsigned int expected = 0;
 
     if (disk6.disk[drive].nibblized) {
         expected = NIB_TRACK_SIZE;
+    } else if (disk6.disk[drive].tracks_nibblized & TRACK_BIT(trk)) {
+        // track already built (and possibly written) ...
+        expected = disk6.disk[drive].track_width;
     } else {
         // .dsk, .do, .po images
-        unsigned int trk = (disk6.disk[drive].phase >> 1);
         uintptr_t dskoff = DSK_TRACK_SIZE * trk;
         uintptr_t niboff = NIB_TRACK_SIZE * trk;
-        unsigned long ex0 = nibblize_track(disk6.disk[drive].raw_image_data+dskoff, drive, disk6.disk[drive].nib_image_data+niboff);
+        unsigned long ex0 = nibblize_track(disk6.disk[drive].raw_image_data+dskoff, drive, trk, disk6.disk[drive].nib_image_data+niboff);
         expected = (unsigned int)ex0;
         if (UNLIKELY(ex0 > UINT_MAX)) {
             assert(false);
         }
+        disk6.disk[drive].tracks_nibblized |= TRACK_BIT(trk);
     }
 
     return expected;
 }
 
-static void save_track_data(int drive) {
+// ----------------------------------------------------------------------------
+// Asynchronous write-back : tracks leaving the head dirty (or still dirty when the motor is switched off) are snapshot
+// by the CPU thread into a single-producer/single-consumer ring, and a background writer denibblizes them into the
+// mmap()'d image and msync()s them.  The CPU thread only blocks if the ring is full.  The writer is started on demand and
+// is drained and joined on eject.
+
+#define WRITEBACK_SLOTS 16
+
+typedef struct writeback_job_t {
+    uint8_t *dst;                       // track in the mmap()'d image
+    unsigned int len;
+    bool denibblize;                    // DSK/DO/PO : decode nib into dst (NIB images are written in place)
+    const int *skew_table;
+    unsigned int track_width;
+    uint8_t nib[NIB_TRACK_SIZE];
+} writeback_job_t;
+
+#if VM_MULTI_INSTANCE
+// single producer only : headless VM threads write back synchronously
+static VM_LOCAL writeback_job_t writeback_job = { 0 };
+#else
+static writeback_job_t writeback_queue[WRITEBACK_SLOTS] = { { 0 } };
+static unsigned long writeback_head = 0; // advanced only by the producer
+static unsigned long writeback_tail = 0; // advanced only by the writer thread
+static pthread_t writeback_thread = 0;
+static bool writeback_stopping = false;
+static pthread_mutex_t writeback_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t writeback_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t writeback_drained_cond = PTHREAD_COND_INITIALIZER;
+#endif
+
+static void _disk6_writebackRun(writeback_job_t *job) {
+    SCOPE_TRACE_DISK("writeback");
+
+    if (job->denibblize) {
+        denibblize_track(/*src:*/job->nib, job->track_width, job->skew_table, /*dst:*/job->dst);
+    }
+
+    uintptr_t base = (uintptr_t)job->dst & page_mask;
+
+    int ret = -1;
+    TEMP_FAILURE_RETRY(ret = msync((void *)base, ((uintptr_t)job->dst + job->len) - base, MS_SYNC));
+    if (ret) {
+        LOG("Error syncing disk image track (%s)", strerror(errno));
+    }
+}
+
+#if !VM_MULTI_INSTANCE
+static void *_disk6_writebackThread(void *ctx) {
+    (void)ctx;
+    LOG("disk write-back thread ...");
+
+    pthread_mutex_lock(&writeback_mutex);
+    do {
+        unsigned long head = 0;
+        while (((head = __atomic_load_n(&writeback_head, __ATOMIC_ACQUIRE)) == writeback_tail) && !writeback_stopping) {
+            pthread_cond_wait(&writeback_cond, &writeback_mutex);
+        }
+        if (head == writeback_tail) {
+            break; // stopping with nothing left to write
+        }
+        pthread_mutex_unlock(&writeback_mutex);
+
+        _disk6_writebackRun(&writeback_queue[writeback_tail % WRITEBACK_SLOTS]);
+        __atomic_store_n(&writeback_tail, writeback_tail + 1, __ATOMIC_RELEASE);
+
+        pthread_mutex_lock(&writeback_mutex);
+        pthread_cond_broadcast(&writeback_drained_cond);
+    } while (1);
+    pthread_mutex_unlock(&writeback_mutex);
+
+    return NULL;
+}
+
+static void _disk6_writebackWait(unsigned long pending) {
+    pthread_mutex_lock(&writeback_mutex);
+    while (writeback_head - __atomic_load_n(&writeback_tail, __ATOMIC_ACQUIRE) > pending) {
+        pthread_cond_wait(&writeback_drained_cond, &writeback_mutex);
+    }
+    pthread_mutex_unlock(&writeback_mutex);
+}
+#endif
+
+// wait for all queued tracks to be written to the image
+static void _disk6_writebackDrain(void) {
+#if !VM_MULTI_INSTANCE
+    if (writeback_head != __atomic_load_n(&writeback_tail, __ATOMIC_ACQUIRE)) {
+        _disk6_writebackWait(0);
+    }
+#endif
+}
+
+// write out all queued tracks and end the writer thread
+static void _disk6_writebackStop(void) {
+#if !VM_MULTI_INSTANCE
+    if (!writeback_thread) {
+        return;
+    }
+
+    pthread_mutex_lock(&writeback_mutex);
+    writeback_stopping = true;
+    pthread_cond_signal(&writeback_cond);
+    pthread_mutex_unlock(&writeback_mutex);
+
+    int err = pthread_join(writeback_thread, NULL);
+    if (err) {
+        LOG("OOPS, pthread_join of disk write-back thread (%d)", err);
+    }
+    writeback_thread = 0;
+    writeback_stopping = false;
+#endif
+}
+
+static writeback_job_t *_disk6_writebackReserve(void) {
+#if VM_MULTI_INSTANCE
+    return &writeback_job;
+#else
+    if (UNLIKELY(writeback_head - __atomic_load_n(&writeback_tail, __ATOMIC_ACQUIRE) >= WRITEBACK_SLOTS)) {
+        LOG("disk write-back queue full, waiting ...");
+        _disk6_writebackWait(WRITEBACK_SLOTS-1);
+    }
+    return &writeback_queue[writeback_head % WRITEBACK_SLOTS];
+#endif
+}
+
+static void _disk6_writebackCommit(void) {
+#if VM_MULTI_INSTANCE
+    _disk6_writebackRun(&writeback_job);
+#else
+    if (UNLIKELY(!writeback_thread)) {
+        int err = TEMP_FAILURE_RETRY(pthread_create(&writeback_thread, NULL, &_disk6_writebackThread, NULL));
+        if (err) {
+            LOG("OOPS, could not create disk write-back thread (%d), writing synchronously", err);
+            _disk6_writebackRun(&writeback_queue[writeback_head % WRITEBACK_SLOTS]);
+            return;
+        }
+    }
+
+    __atomic_store_n(&writeback_head, writeback_head + 1, __ATOMIC_RELEASE); // publish job contents with the slot
+
+    pthread_mutex_lock(&writeback_mutex);
+    pthread_cond_signal(&writeback_cond);
+    pthread_mutex_unlock(&writeback_mutex);
+#endif
+}
+
+static void save_track_data(int drive, unsigned int trk) {
     SCOPE_TRACE_DISK("save_track_data");
 
-    unsigned int trk = (disk6.disk[drive].phase >> 1);
+    diskette_t *disk = &disk6.disk[drive];
     uintptr_t niboff = NIB_TRACK_SIZE * trk;
 
-    if (disk6.disk[drive].nibblized) {
-        /*
-        int ret = -1;
-        TEMP_FAILURE_RETRY(ret = msync(disk6.disk[drive].raw_image_data+niboff, NIB_TRACK_SIZE, MS_SYNC));
-        if (ret) {
-            LOG("Error syncing file %s", disk6.disk[drive].file_name);
-        }
-        */
+    writeback_job_t *job = _disk6_writebackReserve();
+    if (disk->nibblized) {
+        // writes already landed in the mmap()'d image, only need syncing
+        job->dst = disk->raw_image_data+niboff;
+        job->len = NIB_TRACK_SIZE;
+        job->denibblize = false;
     } else {
-        // .dsk, .do, .po images
+        // .dsk, .do, .po images : snapshot the track so the CPU thread can carry on writing it
         uintptr_t dskoff = DSK_TRACK_SIZE * trk;
-        denibblize_track(/*src:*/disk6.disk[drive].nib_image_data+niboff, drive, /*dst:*/disk6.disk[drive].raw_image_data+dskoff);
-        /*
-        int ret = -1;
-        TEMP_FAILURE_RETRY(ret = msync(disk6.disk[drive].raw_image_data+dskoff, DSK_TRACK_SIZE, MS_SYNC));
-        if (ret) {
-            LOG("Error syncing file %s", disk6.disk[drive].file_name);
-        }
-        */
+        memcpy(job->nib, disk->nib_image_data+niboff, NIB_TRACK_SIZE);
+        job->dst = disk->raw_image_data+dskoff;
+        job->len = DSK_TRACK_SIZE;
+        job->denibblize = true;
+        job->skew_table = disk->skew_table;
+        job->track_width = disk->track_width;
     }
+    _disk6_writebackCommit();
 
-    disk6.disk[drive].track_dirty = false;
+    disk->tracks_dirty &= ~TRACK_BIT(trk);
 }
 
 static inline void animate_disk_track_sector(void) {
@@ -493,10 +676,252 @@ static inline void animate_disk_track_sector(void) {
     }
 }
 
+// ----------------------------------------------------------------------------
+// WOZ 1/2 bit-stream images : see https://applesaucefdc.com/woz/reference2/
+
+#define WOZ_HEADER_SIZE     12
+#define WOZ_CHUNK_HEADER    8
+#define WOZ_MAX_SIZE        (16*1024*1024)
+
+#define WOZ_INFO_DISK_TYPE  1           // 1 : 5.25 diskette
+#define WOZ_INFO_BIT_TIMING 39          // WOZ2 only
+
+#define WOZ1_TRK_SIZE       6656
+#define WOZ1_BITS_SIZE      6646
+#define WOZ1_BYTES_USED     6646
+#define WOZ1_BIT_COUNT      6648
+
+#define WOZ2_TRK_SIZE       8
+#define WOZ2_BLOCK_SIZE     512
+
+#define WOZ_NO_TRACK        0xFF
+#define WOZ_LATCH_HOLD_BITS 2           // bit cells a complete nibble stays in the data latch
+#define WOZ_MAX_ELAPSED     (1024*1024) // cap on cycles accounted per access (about 5 revolutions)
+
+static inline uint16_t _woz_le16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t _woz_le32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Locate the INFO/TMAP/TRKS chunks of the WOZ image in raw_image_data.  Track bit streams are left in place
+static const char *_woz_parse(diskette_t *disk) {
+    const uint8_t *img = disk->raw_image_data;
+    const uint32_t len = disk->whole_len;
+
+    if (len < WOZ_HEADER_SIZE) {
+        return ERR_WOZ_IMAGE_INVALID;
+    }
+
+    unsigned int version = 0;
+    if (memcmp(img, "WOZ1", 4) == 0) {
+        version = 1;
+    } else if (memcmp(img, "WOZ2", 4) == 0) {
+        version = 2;
+    } else {
+        return ERR_WOZ_IMAGE_INVALID;
+    }
+    if (img[4] != 0xFF || img[5] != 0x0A || img[6] != 0x0D || img[7] != 0x0A) {
+        return ERR_WOZ_IMAGE_INVALID; // mangled by a text-mode transfer
+    }
+
+    memset(disk->woz_tmap, WOZ_NO_TRACK, sizeof(disk->woz_tmap));
+    memset(disk->woz_bits, 0x0, sizeof(disk->woz_bits));
+    memset(disk->woz_bit_count, 0x0, sizeof(disk->woz_bit_count));
+    disk->woz_bit_timing = WOZ_BIT_TIMING;
+
+    bool has_tmap = false;
+    bool has_trks = false;
+
+    uint32_t off = WOZ_HEADER_SIZE;
+    while (len - off >= WOZ_CHUNK_HEADER) {
+        const uint8_t *id = img + off;
+        const uint32_t size = _woz_le32(img + off + 4);
+        off += WOZ_CHUNK_HEADER;
+        if (size > len - off) {
+            return ERR_WOZ_IMAGE_INVALID;
+        }
+        const uint8_t *chunk = img + off;
+
+        if (memcmp(id, "INFO", 4) == 0) {
+            if (size <= WOZ_INFO_DISK_TYPE || chunk[WOZ_INFO_DISK_TYPE] != 1) {
+                LOG("WOZ image is not a 5.25 diskette");
+                return ERR_WOZ_IMAGE_INVALID;
+            }
+            if (version >= 2 && size > WOZ_INFO_BIT_TIMING && chunk[WOZ_INFO_BIT_TIMING]) {
+                disk->woz_bit_timing = chunk[WOZ_INFO_BIT_TIMING];
+            }
+        } else if (memcmp(id, "TMAP", 4) == 0) {
+            if (size < WOZ_NUM_QTRACKS) {
+                return ERR_WOZ_IMAGE_INVALID;
+            }
+            memcpy(disk->woz_tmap, chunk, WOZ_NUM_QTRACKS);
+            has_tmap = true;
+        } else if (memcmp(id, "TRKS", 4) == 0) {
+            if (version == 1) {
+                unsigned int num_tracks = size / WOZ1_TRK_SIZE;
+                if (num_tracks > WOZ_MAX_TRACKS) {
+                    num_tracks = WOZ_MAX_TRACKS;
+                }
+                for (unsigned int i=0; i<num_tracks; i++) {
+                    const uint8_t *trk = chunk + (WOZ1_TRK_SIZE * i);
+                    uint16_t bytes_used = _woz_le16(trk + WOZ1_BYTES_USED);
+                    uint16_t bit_count = _woz_le16(trk + WOZ1_BIT_COUNT);
+                    if (bytes_used > WOZ1_BITS_SIZE || bit_count > (bytes_used << 3)) {
+                        return ERR_WOZ_IMAGE_INVALID;
+                    }
+                    disk->woz_bits[i] = trk;
+                    disk->woz_bit_count[i] = bit_count;
+                }
+            } else {
+                if (size < WOZ2_TRK_SIZE * WOZ_MAX_TRACKS) {
+                    return ERR_WOZ_IMAGE_INVALID;
+                }
+                for (unsigned int i=0; i<WOZ_MAX_TRACKS; i++) {
+                    const uint8_t *trk = chunk + (WOZ2_TRK_SIZE * i);
+                    uint32_t start = _woz_le16(trk) * WOZ2_BLOCK_SIZE;
+                    uint32_t blocks = _woz_le16(trk + 2);
+                    uint32_t bit_count = _woz_le32(trk + 4);
+                    if (!blocks) {
+                        continue;
+                    }
+                    if (start > len || (blocks * WOZ2_BLOCK_SIZE) > len - start || bit_count > (blocks * WOZ2_BLOCK_SIZE) << 3) {
+                        return ERR_WOZ_IMAGE_INVALID;
+                    }
+                    disk->woz_bits[i] = img + start;
+                    disk->woz_bit_count[i] = bit_count;
+                }
+            }
+            has_trks = true;
+        }
+
+        off += size;
+    }
+
+    if (!has_tmap || !has_trks) {
+        return ERR_WOZ_IMAGE_INVALID;
+    }
+
+    for (unsigned int qtrk=0; qtrk<WOZ_NUM_QTRACKS; qtrk++) {
+        uint8_t idx = disk->woz_tmap[qtrk];
+        if (idx != WOZ_NO_TRACK && (idx >= WOZ_MAX_TRACKS || !disk->woz_bit_count[idx])) {
+            disk->woz_tmap[qtrk] = WOZ_NO_TRACK;
+        }
+    }
+
+    LOG("WOZ%u image, bit timing %u", version, disk->woz_bit_timing);
+
+    return NULL;
+}
+
+// Advance the head through the WOZ track bit stream by the bit cells elapsed since the last access, shifting each bit
+// through a simplified read sequencer : leading zeros are dropped, and a nibble is complete once its high bit reaches
+// the top of the shift register.  The complete nibble stays latched for a couple of bit cells before the next one
+// starts showing, as on the real Logic State Sequencer.
+static void _disk_readWriteBits(void) {
+    diskette_t *disk = &disk6.disk[disk6.drive];
+
+    timing_checkpointCycles();
+    unsigned long elapsed = cycles_count_total - disk->bit_cycles;
+    disk->bit_cycles = cycles_count_total;
+    if (elapsed > WOZ_MAX_ELAPSED) {
+        elapsed = WOZ_MAX_ELAPSED;
+    }
+
+    if (!disk6.ddrw && !disk6.motor_spinning) {
+        disk6.disk_byte = 0xFF;
+        return;
+    }
+
+    const uint8_t idx = disk->woz_tmap[disk->phase << 1];
+    if (idx == WOZ_NO_TRACK) {
+        // unformatted : no flux transitions, nothing ever latches
+        disk->woz_track = -1;
+        disk->shift_reg = 0;
+        disk->latch_hold = 0;
+        if (!disk6.ddrw) {
+            disk6.disk_byte = 0x00;
+        }
+        return;
+    }
+
+    const uint32_t bit_count = disk->woz_bit_count[idx];
+    if (idx != disk->woz_track) {
+        if (disk->woz_track >= 0) {
+            // track lengths differ slightly, so preserve the angular position across the step
+            disk->bit_pos = (uint32_t)(((uint64_t)disk->bit_pos * bit_count) / disk->woz_bit_count[disk->woz_track]);
+        }
+        disk->bit_pos %= bit_count;
+        disk->woz_track = idx;
+    }
+
+    unsigned long eighths = (elapsed << 3) + disk->bit_frac;
+    unsigned long bits = eighths / disk->woz_bit_timing;
+    disk->bit_frac = (unsigned int)(eighths % disk->woz_bit_timing);
+
+    uint32_t pos = disk->bit_pos;
+    if (disk6.ddrw) {
+        // writes are dropped (image is write protected), the diskette just spins under the head
+        pos = (uint32_t)((pos + bits) % bit_count);
+        disk->shift_reg = 0;
+        disk->latch_hold = 0;
+    } else {
+        if (bits > bit_count) {
+            // idle for more than a revolution : only the last bits matter
+            pos = (uint32_t)((pos + bits - 16) % bit_count);
+            bits = 16;
+            disk->shift_reg = 0;
+            disk->latch_hold = 0;
+        }
+
+        const uint8_t *stream = disk->woz_bits[idx];
+        uint8_t shift = disk->shift_reg;
+        uint8_t hold = disk->latch_hold;
+        for (unsigned long i=0; i<bits; i++) {
+            uint8_t bit = (stream[pos >> 3] >> (7 - (pos & 7))) & 1;
+            if (++pos >= bit_count) {
+                pos = 0;
+            }
+            if (hold) {
+                --hold;
+            }
+            if (shift || bit) {
+                shift = (uint8_t)((shift << 1) | bit);
+            }
+            if (shift & 0x80) {
+                disk->latch = shift;
+                shift = 0;
+                hold = WOZ_LATCH_HOLD_BITS;
+            }
+        }
+        disk->shift_reg = shift;
+        disk->latch_hold = hold;
+
+        disk6.disk_byte = hold ? disk->latch : shift;
+#if DISK_TRACING
+        if (test_read_fp && hold) {
+            fprintf(test_read_fp, "%02X", disk6.disk_byte);
+        }
+#endif
+    }
+    disk->bit_pos = pos;
+
+    disk->run_byte = (int)(pos >> 3);
+    disk->track_width = (bit_count + 7) >> 3;
+    animate_disk_track_sector();
+}
+
 // ----------------------------------------------------------------------------
 // Emulator hooks
 
 static void _disk_readWriteByte(void) {
+    if (disk6.disk[disk6.drive].woz) {
+        _disk_readWriteBits();
+        return;
+    }
+
     do {
         if (disk6.disk[disk6.drive].fd < 0) {
             ////ERRLOG_THROTTLE("OOPS, attempt to read byte from NULL image in drive (%d)", disk6.drive+1);
@@ -505,11 +930,8 @@ static void _disk_readWriteByte(void) {
         }
 
         if (!disk6.disk[disk6.drive].track_valid) {
-            assert(!disk6.disk[disk6.drive].track_dirty);
-            // TODO FIXME ... methinks we shouldn't need to reload, but :
-            //  * testing shows different intermediate results (SIXBITNIBS, etc)
-            //  * could be instability between the {de,}nibblize routines
-            size_t track_width = load_track_data(disk6.drive);
+            // tracks are nibblized on first access and retained (along with any writes) until ejected
+            size_t track_width = load_track_data(disk6.drive, disk6.disk[disk6.drive].phase >> 1);
             if (track_width != disk6.disk[disk6.drive].track_width) {
                 ////ERRLOG_THROTTLE("OOPS, problem loading track data");
                 disk6.disk_byte = 0xFF;
@@ -538,17 +960,12 @@ static void _disk_readWriteByte(void) {
 #endif
 
             disk6.disk[disk6.drive].nib_image_data[track_idx] = disk6.disk_byte;
-            disk6.disk[disk6.drive].track_dirty = true;
+            disk6.disk[disk6.drive].tracks_dirty |= TRACK_BIT(disk6.disk[disk6.drive].phase >> 1);
         } else {
 
-            if (disk6.motor_off) { // !!! FIXME TODO ... introduce a proper spin-down, cribbing from AppleWin
-                if (disk6.motor_off > 99) {
-                    ////ERRLOG_THROTTLE("OOPS, potential disk motor issue");
-                    disk6.disk_byte = 0xFF;
-                    break;
-                } else {
-                    disk6.motor_off++;
-                }
+            if (!disk6.motor_spinning) {
+                disk6.disk_byte = 0xFF;
+                break;
             }
 
             disk6.disk_byte = disk6.disk[disk6.drive].nib_image_data[track_idx];
@@ -627,13 +1044,14 @@ static void _disk6_phaseChange(uint16_t ea) {
             next_phase = 0;
         }
 
-        if (next_phase > 69) { // AppleWin uses 79 (extra tracks/phases)?
-            next_phase = 69;
+        int max_phase = disk6.disk[disk6.drive].woz ? ((WOZ_NUM_QTRACKS >> 1) - 1) : 69; // AppleWin uses 79 (extra tracks/phases)?
+        if (next_phase > max_phase) {
+            next_phase = max_phase;
         }
 
         if ((cur_phase >> 1) != (next_phase >> 1)) {
-            if (disk6.disk[disk6.drive].track_dirty) {
-                save_track_data(disk6.drive);
+            if (disk6.disk[disk6.drive].tracks_dirty & TRACK_BIT(cur_phase >> 1)) {
+                save_track_data(disk6.drive, cur_phase >> 1);
             }
             disk6.disk[disk6.drive].track_valid = false;
         }
@@ -653,10 +1071,29 @@ static void _disk6_phaseChange(uint16_t ea) {
     }
 }
 
+static void _disk6_motorStopped(void) {
+    if (disk6.motor_off) { // ignore a stale deadline from before a state load
+        disk6.motor_spinning = false;
+    }
+}
+
 static void _disk6_motorControl(uint16_t ea) {
     clock_gettime(CLOCK_MONOTONIC, &disk6.motor_time);
     int turnOn = (ea & 0x1);
-    disk6.motor_off = turnOn ? 0 : 1;
+    if (turnOn) {
+        timing_cancelEvent(TIMING_EVENT_DISK_MOTOR);
+        disk6.motor_off = 0;
+        disk6.motor_spinning = true;
+    } else if (!disk6.motor_off) {
+        // bound the write-back latency of the track under the head to the end of the current operation
+        int trk = disk6.disk[disk6.drive].phase >> 1;
+        if (disk6.disk[disk6.drive].tracks_dirty & TRACK_BIT(trk)) {
+            save_track_data(disk6.drive, trk);
+        }
+        disk6.motor_off = 1;
+        timing_checkpointCycles();
+        timing_scheduleEvent(TIMING_EVENT_DISK_MOTOR, cycles_count_total + DISK_MOTOR_SPINDOWN_CYCLES, &_disk6_motorStopped);
+    }
 }
 
 static void _disk6_driveSelect(uint16_t ea) {
@@ -749,6 +1186,254 @@ void disk6_ioWrite(uint16_t ea, uint8_t b) {
     }
 }
 
+// ----------------------------------------------------------------------------
+// Accelerated disk I/O : DOS 3.3 RWTS and ProDOS Disk ][ driver calls are serviced whole-sector/block straight from
+// the DSK/DO/PO image, bypassing the nibble-level emulation.  NIB images (possibly copy-protected) and any call that
+// doesn't look like a standard read/write of an inserted slot 6 disk fall through to the real code.
+
+#define RWTS_ENTRY          0xBD00 // DOS 3.3 RWTS : STY $48 / STA $49 ...
+#define RWTS_TRAP           0xBD04 // ... trapped once the IOB pointer is stashed in $48/$49
+#define RWTS_IOB_PTR        0x48
+
+#define IOB_TYPE            0x00
+#define IOB_SLOT16          0x01
+#define IOB_DRIVE           0x02
+#define IOB_VOLUME          0x03
+#define IOB_TRACK           0x04
+#define IOB_SECTOR          0x05
+#define IOB_BUFFER          0x08
+#define IOB_COMMAND         0x0C
+#define IOB_ERROR           0x0D
+#define IOB_VOLUME_FOUND    0x0E
+#define IOB_LAST_SLOT16     0x0F
+#define IOB_LAST_DRIVE      0x10
+
+#define RWTS_CMD_READ       0x01
+#define RWTS_CMD_WRITE      0x02
+#define RWTS_ERR_WRITE_PROT 0x10
+
+#define PRODOS_MLI          0xBF00 // JMP to MLI when ProDOS is resident
+#define PRODOS_DEVADR       0xBF10 // driver address per slot, drive 2 at +$10
+#define PRODOS_DRIVER_PAGE  0xD0   // stock Disk ][ driver lives in the language card at $D000
+#define PRODOS_ZP_COMMAND   0x42
+#define PRODOS_ZP_UNIT      0x43
+#define PRODOS_ZP_BUFFER    0x44
+#define PRODOS_ZP_BLOCK     0x46
+
+#define PRODOS_CMD_READ     0x01
+#define PRODOS_CMD_WRITE    0x02
+#define PRODOS_ERR_IO       0x27
+#define PRODOS_ERR_WRITE_PROT 0x2B
+
+#define PRODOS_BLOCKS       (NUM_TRACKS * 8)
+
+#define DISK6_SLOT          6
+
+static VM_LOCAL bool accelerated_io = false;
+static VM_LOCAL bool disk6_initialized = false;
+
+// RWTS/ProDOS driver calls serviced from the image since startup
+static VM_LOCAL unsigned long accelerated_calls = 0;
+
+// Return sequence (LDA #err : CLC/SEC : RTS) fed to the CPU at the trapped entry point in place of the real code
+static VM_LOCAL struct {
+    uint16_t ea;
+    uint8_t code[4];
+    uint8_t next; // offset of the next byte the CPU will read from the sequence
+    bool active;
+} trap_return = { 0 };
+
+static bool _disk6_canAccelerate(int drive) {
+    diskette_t *disk = &disk6.disk[drive];
+    return (disk->raw_image_data != MAP_FAILED) && disk->raw_image_data && !disk->nibblized && !disk->woz && disk->skew_table;
+}
+
+static void _disk6_transferSector(int drive, unsigned int trk, unsigned int phys, uint16_t buf, bool write) {
+    diskette_t *disk = &disk6.disk[drive];
+
+    // bring the image up to date with any nibble-level writes to this track
+    if (disk->tracks_dirty & TRACK_BIT(trk)) {
+        save_track_data(drive, trk);
+    }
+    _disk6_writebackDrain();
+
+    uint8_t *sec = disk->raw_image_data + (DSK_TRACK_SIZE * trk) + (256 * disk->skew_table[phys]);
+    if (write) {
+        for (unsigned int i=0; i<256; i++) {
+            sec[i] = vm_readByte(buf+i);
+        }
+        // track will be re-nibblized on next access
+        disk->tracks_nibblized &= ~TRACK_BIT(trk);
+        if (trk == (unsigned int)(disk->phase >> 1)) {
+            disk->track_valid = false;
+        }
+    } else {
+        for (unsigned int i=0; i<256; i++) {
+            vm_writeByte(buf+i, sec[i]);
+        }
+    }
+}
+
+static bool _disk6_serviceRWTS(OUTPARM uint8_t *err, OUTPARM bool *failed) {
+    for (unsigned int i=0; i<4; i++) {
+        static const uint8_t prologue[4] = { 0x84, RWTS_IOB_PTR, 0x85, RWTS_IOB_PTR+1 };
+        if (vm_readByte(RWTS_ENTRY+i) != prologue[i]) {
+            return false;
+        }
+    }
+
+    uint16_t iob = vm_readByte(RWTS_IOB_PTR) | (vm_readByte(RWTS_IOB_PTR+1) << 8);
+    uint8_t type    = vm_readByte(iob+IOB_TYPE);
+    uint8_t slot16  = vm_readByte(iob+IOB_SLOT16);
+    uint8_t drive   = vm_readByte(iob+IOB_DRIVE);
+    uint8_t volume  = vm_readByte(iob+IOB_VOLUME);
+    uint8_t trk     = vm_readByte(iob+IOB_TRACK);
+    uint8_t sector  = vm_readByte(iob+IOB_SECTOR);
+    uint8_t command = vm_readByte(iob+IOB_COMMAND);
+    uint16_t buf    = vm_readByte(iob+IOB_BUFFER) | (vm_readByte(iob+IOB_BUFFER+1) << 8);
+
+    if (type != 1 || slot16 != (DISK6_SLOT<<4) || (drive != 1 && drive != 2)) {
+        return false;
+    }
+    if (command != RWTS_CMD_READ && command != RWTS_CMD_WRITE) {
+        return false; // seek/format need the real head movement
+    }
+    if (trk >= NUM_TRACKS || sector >= NUM_SECTORS || (volume != 0 && volume != DSK_VOLUME)) {
+        return false;
+    }
+    --drive;
+    if (!_disk6_canAccelerate(drive)) {
+        return false;
+    }
+
+    *err = 0;
+    if (command == RWTS_CMD_WRITE && disk6.disk[drive].is_protected) {
+        *err = RWTS_ERR_WRITE_PROT;
+    } else {
+        _disk6_transferSector(drive, trk, physical_sector_do[sector], buf, command == RWTS_CMD_WRITE);
+    }
+    *failed = (*err != 0);
+
+    vm_writeByte(iob+IOB_ERROR, *err);
+    vm_writeByte(iob+IOB_VOLUME_FOUND, DSK_VOLUME);
+    vm_writeByte(iob+IOB_LAST_SLOT16, slot16);
+    vm_writeByte(iob+IOB_LAST_DRIVE, drive+1);
+
+    return true;
+}
+
+static bool _disk6_serviceProDOS(uint16_t ea, OUTPARM uint8_t *err, OUTPARM bool *failed) {
+    if (vm_readByte(PRODOS_MLI) != 0x4C) {
+        return false;
+    }
+
+    uint8_t unit = vm_readByte(PRODOS_ZP_UNIT);
+    uint8_t slot = (unit >> 4) & 0x7;
+    uint8_t drive = (unit >> 7);
+    if (slot != DISK6_SLOT) {
+        return false;
+    }
+
+    uint16_t devadr = PRODOS_DEVADR + (drive << 4) + (slot << 1);
+    if ((vm_readByte(devadr) | (vm_readByte(devadr+1) << 8)) != ea) {
+        return false;
+    }
+
+    uint8_t command = vm_readByte(PRODOS_ZP_COMMAND);
+    if (command != PRODOS_CMD_READ && command != PRODOS_CMD_WRITE) {
+        return false; // status/format handled by the real driver
+    }
+    if (!_disk6_canAccelerate(drive)) {
+        return false;
+    }
+
+    uint16_t buf   = vm_readByte(PRODOS_ZP_BUFFER) | (vm_readByte(PRODOS_ZP_BUFFER+1) << 8);
+    uint16_t block = vm_readByte(PRODOS_ZP_BLOCK)  | (vm_readByte(PRODOS_ZP_BLOCK+1) << 8);
+
+    *err = 0;
+    if (block >= PRODOS_BLOCKS) {
+        *err = PRODOS_ERR_IO;
+    } else if (command == PRODOS_CMD_WRITE && disk6.disk[drive].is_protected) {
+        *err = PRODOS_ERR_WRITE_PROT;
+    } else {
+        unsigned int trk = block >> 3;
+        unsigned int half = (block & 0x7) << 1;
+        _disk6_transferSector(drive, trk, physical_sector_po[half+0], buf+0x000, command == PRODOS_CMD_WRITE);
+        _disk6_transferSector(drive, trk, physical_sector_po[half+1], buf+0x100, command == PRODOS_CMD_WRITE);
+    }
+    *failed = (*err != 0);
+
+    return true;
+}
+
+GLUE_C_READ(disk6_readTrap)
+{
+    // only opcode fetches enter a trap, data reads have already flagged the access
+    const bool fetch = !(run_args.cpu65_rw & MEM_READ_FLAG);
+
+    // the return sequence is served strictly in instruction order : its opcodes to opcode fetches and the LDA operand
+    // (read as data) to the read right after the LDA fetch.  Any other read of these addresses sees real memory
+    if (trap_return.active) {
+        const uint8_t next = trap_return.next;
+        if ((ea == (uint16_t)(trap_return.ea + next)) && (fetch || (next == 1))) {
+            trap_return.next = next + 1;
+            trap_return.active = (trap_return.next < sizeof(trap_return.code));
+            return trap_return.code[next];
+        }
+    }
+
+    uint8_t b = vm_readByte(ea);
+    if (!fetch || !accelerated_io) {
+        return b;
+    }
+
+    uint8_t err = 0;
+    bool failed = false;
+    bool serviced = false;
+    if (ea == RWTS_TRAP) {
+        serviced = _disk6_serviceRWTS(&err, &failed);
+    } else if ((ea >> 8) == PRODOS_DRIVER_PAGE) {
+        serviced = _disk6_serviceProDOS(ea, &err, &failed);
+    }
+
+    if (!serviced) {
+        return b;
+    }
+
+    trap_return.ea = ea;
+    trap_return.code[0] = 0xA9;                  // LDA #err
+    trap_return.code[1] = err;
+    trap_return.code[2] = failed ? 0x38 : 0x18;  // SEC/CLC
+    trap_return.code[3] = 0x60;                  // RTS
+    trap_return.next = 1;
+    trap_return.active = true;
+    ++accelerated_calls;
+
+    return trap_return.code[0];
+}
+
+// (Re)install or remove the traps.  VM table initialization restores the default page handlers, so this runs on every
+// disk6_init() as well as on preference changes.  A disk6_init() ahead of the first VM initialization has no tables to
+// patch, vm_initialize() calls it again
+static void _disk6_installTraps(void) {
+    if (!disk6_initialized || !vm_tablesInitialized()) {
+        return;
+    }
+    void *handler = accelerated_io ? (void *)disk6_readTrap : NULL;
+    vm_setReadHandler(RWTS_ENTRY >> 8, handler);
+    vm_setReadHandler(PRODOS_DRIVER_PAGE, handler);
+}
+
+unsigned long disk6_acceleratedCalls(void) {
+    return accelerated_calls;
+}
+
+static void disk6_prefsChanged(const char *domain) {
+    bool bVal = false;
+    accelerated_io = prefs_parseBoolValue(domain, PREF_DISK_ACCELERATED_IO, &bVal) ? bVal : false;
+    _disk6_installTraps();
+}
+
 // ----------------------------------------------------------------------------
 
 void disk6_init(void) {
@@ -764,18 +1449,22 @@ void disk6_init(void) {
     disk6.disk[0].phase = disk6.disk[1].phase = 0;
     disk6.disk[0].run_byte = disk6.disk[1].run_byte = 0;
     disk6.disk[0].track_valid = disk6.disk[1].track_valid = false;
-    disk6.disk[0].track_dirty = disk6.disk[1].track_dirty = false;
     disk6.motor_time = (struct timespec){ 0 };
     disk6.motor_off = 1;
+    disk6.motor_spinning = false;
     disk6.drive = 0;
     disk6.ddrw = 0;
     disk6.disk_byte = 0;
+
+    trap_return.active = false;
+    disk6_initialized = true;
+    _disk6_installTraps();
 }
 
 const char *disk6_eject(int drive) {
 
 #if !TESTING
-    assert(cpu_isPaused() && "CPU must be paused for disk ejection");
+    assert((cpu_isPaused() || timing_isCPUThread()) && "CPU must be paused for disk ejection");
 #endif
     assert(drive == 0 || drive == 1);
 
@@ -783,8 +1472,13 @@ const char *disk6_eject(int drive) {
 
     pthread_mutex_lock(&insertion_mutex);
 
+    if (disk6.disk[drive].file_name != NULL) {
+        replay_diskEjected(drive);
+    }
+
     if ((disk6.disk[drive].fd > 0) && !disk6.disk[drive].is_protected) {
         disk6_flush(drive);
+        _disk6_writebackStop();
 
         int ret = -1;
         off_t compressed_size = -1;
@@ -838,6 +1532,10 @@ const char *disk6_eject(int drive) {
         }
     }
 
+    if (disk6.disk[drive].woz && disk6.disk[drive].raw_image_data != MAP_FAILED) {
+        FREE(disk6.disk[drive].raw_image_data);
+    }
+
     FREE(disk6.disk[drive].file_name);
 
     pthread_mutex_unlock(&insertion_mutex);
@@ -849,9 +1547,12 @@ const char *disk6_eject(int drive) {
     disk6.disk[drive].nibblized = false;
     disk6.disk[drive].is_protected = false;
     disk6.disk[drive].track_valid = false;
-    disk6.disk[drive].track_dirty = false;
+    disk6.disk[drive].tracks_nibblized = 0;
+    disk6.disk[drive].tracks_dirty = 0;
     disk6.disk[drive].skew_table = NULL;
     disk6.disk[drive].track_width = 0;
+    disk6.disk[drive].woz = false;
+    disk6.disk[drive].woz_track = -1;
     // WARNING DO NOT RESET certain disk parameters on simple eject.  We need to retain state in the case where an image
     // was "re-inserted" ... e.g. Drol load screen)
     //disk6.disk[drive].phase = 0;
@@ -865,10 +1566,68 @@ const char *disk6_eject(int drive) {
     return err;
 }
 
+// WOZ images are held whole in memory (the bit streams are read in place) and are always write protected
+static const char *_disk6_insertWoz(int fd, int drive) {
+    diskette_t *disk = &disk6.disk[drive];
+
+    disk->woz = true;
+    disk->is_protected = true;
+    disk->nibblized = false;
+
+    struct stat stat_buf;
+    if (fstat(fd, &stat_buf) == -1) {
+        LOG("OOPS, could not stat WOZ image %s (%s)", disk->file_name, strerror(errno));
+        return ERR_WOZ_IMAGE_INVALID;
+    }
+
+    off_t len = stat_buf.st_size;
+    if (is_gz(disk->file_name)) {
+        // uncompressed size from the gzip ISIZE trailer
+        uint8_t isize[4] = { 0 };
+        ssize_t got = -1;
+        if (len > (off_t)sizeof(isize)) {
+            TEMP_FAILURE_RETRY(got = pread(fd, isize, sizeof(isize), len - sizeof(isize)));
+        }
+        len = (got == sizeof(isize)) ? _woz_le32(isize) : -1;
+    }
+    if (len < WOZ_HEADER_SIZE || len > WOZ_MAX_SIZE) {
+        LOG("OOPS, unexpected WOZ image size %lld", (long long)len);
+        return ERR_WOZ_IMAGE_INVALID;
+    }
+
+    disk->fd = READONLY_FD;
+    disk->whole_len = (unsigned int)len;
+    disk->raw_image_data = MALLOC(disk->whole_len);
+    if (!disk->raw_image_data) {
+        disk->raw_image_data = MAP_FAILED;
+        return ERR_WOZ_IMAGE_INVALID;
+    }
+
+    const char *err = zlib_inflate_to_buffer(fd, disk->whole_len, disk->raw_image_data);
+    if (err) {
+        return err;
+    }
+
+    err = _woz_parse(disk);
+    if (err) {
+        return err;
+    }
+
+    disk->woz_track = -1;
+    disk->bit_pos = 0;
+    disk->bit_cycles = cycles_count_total;
+    disk->bit_frac = 0;
+    disk->shift_reg = 0;
+    disk->latch = 0;
+    disk->latch_hold = 0;
+
+    return NULL;
+}
+
 const char *disk6_insert(int fd, int drive, const char * const file_name, int readonly) {
 
 #if !TESTING
-    assert(cpu_isPaused() && "CPU must be paused for disk insertion");
+    assert((cpu_isPaused() || timing_isCPUThread()) && "CPU must be paused for disk insertion");
 #endif
     assert(drive == 0 || drive == 1);
 
@@ -876,6 +1635,16 @@ const char *disk6_insert(int fd, int drive, const char * const file_name, int re
 
     disk6.disk[drive].file_name = STRDUP(file_name);
 
+    if (is_woz(disk6.disk[drive].file_name)) {
+        pthread_mutex_lock(&insertion_mutex);
+        const char *err = _disk6_insertWoz(fd, drive);
+        pthread_mutex_unlock(&insertion_mutex);
+        if (err) {
+            disk6_eject(drive);
+        }
+        return err;
+    }
+
     unsigned int expected = NIB_SIZE;
     disk6.disk[drive].nibblized = true;
     if (!is_nib(disk6.disk[drive].file_name)) {
@@ -928,43 +1697,31 @@ const char *disk6_insert(int fd, int drive, const char * const file_name, int re
         disk6.disk[drive].nib_image_data = disk6.disk[drive].raw_image_data;
         disk6.disk[drive].track_width = NIB_TRACK_SIZE;
 
-        int lastphase = disk6.disk[drive].phase;
-
         if (!disk6.disk[drive].nibblized) {
-            // DSK/DO/PO require nibblizing on read (and denibblizing on write) ...
+            // DSK/DO/PO require nibblizing on read (and denibblizing on write) ... tracks are nibblized lazily on first
+            // access, so only build the track under the head here to establish the track width
 
             disk6.disk[drive].nib_image_data = (drive==0) ? &disk_a[0] : &disk_b[0];
             disk6.disk[drive].track_width = 0;
+            disk6.disk[drive].tracks_nibblized = 0;
 
-            for (unsigned int trk=0; trk<NUM_TRACKS; trk++) {
-
-                disk6.disk[drive].phase = (trk<<1); // HACK : load_track_data()/nibblize_track() expects this set properly
-                unsigned int track_width = load_track_data(drive);
-                if (disk6.disk[drive].nibblized) {
-                    assert(track_width == NIB_TRACK_SIZE);
-                } else {
-                    assert(track_width <= NIB_TRACK_SIZE);
+            unsigned int track_width = load_track_data(drive, disk6.disk[drive].phase >> 1);
+            assert(track_width <= NIB_TRACK_SIZE);
 #if CONFORMANT_TRACKS
-                    if (track_width != NI2_TRACK_SIZE) {
-                        LOG("Invalid dsk image creation...");
-                    }
-#endif
-                    if (!disk6.disk[drive].track_width) {
-                        disk6.disk[drive].track_width = track_width;
-                    } else {
-                        assert((disk6.disk[drive].track_width == track_width) && "track width should match for all tracks");
-                    }
-                }
+            if (track_width != NI2_TRACK_SIZE) {
+                LOG("Invalid dsk image creation...");
             }
+#endif
+            disk6.disk[drive].track_width = track_width;
         }
-
-        disk6.disk[drive].phase = lastphase; // needed for some images when "re-inserted" ... e.g. Drol load screen
     } while (0);
 
     pthread_mutex_unlock(&insertion_mutex);
 
     if (err) {
         disk6_eject(drive);
+    } else {
+        replay_diskInserted(drive, file_name, readonly);
     }
 
     return err;
@@ -985,12 +1742,16 @@ void disk6_flush(int drive) {
         return;
     }
 
-    if (disk6.disk[drive].track_dirty) {
+    if (disk6.disk[drive].tracks_dirty) {
         LOG("WARNING : flushing previous session for drive (%d)...", drive+1);
-        save_track_data(drive);
+        for (unsigned int trk=0; trk<NUM_TRACKS; trk++) {
+            if (disk6.disk[drive].tracks_dirty & TRACK_BIT(trk)) {
+                save_track_data(drive, trk);
+            }
+        }
     }
 
-    __sync_synchronize();
+    _disk6_writebackDrain();
 
     LOG("FLUSHING disk image I/O");
 
@@ -1037,7 +1798,9 @@ bool disk6_saveState(StateHelper_s *helper) {
                 break;
             }
 
-            disk6_flush(i);
+            if (!helper->isRewind) {
+                disk6_flush(i);
+            }
 
             state = (uint8_t)disk6.disk[i].is_protected;
             if (!helper->save(fd, &state, 1)) {
@@ -1116,6 +1879,7 @@ static bool _disk6_loadState(StateHelper_s *helper, JSON_ref json) {
         }
 
         const bool changeState = (json == NULL);
+        const bool keepMedia = changeState && helper->isRewind;
 
         uint8_t state = 0x0;
 
@@ -1123,7 +1887,8 @@ static bool _disk6_loadState(StateHelper_s *helper, JSON_ref json) {
             break;
         }
         if (changeState) {
-            disk6.motor_off = state;
+            disk6.motor_off = state ? 1 : 0; // older state files hold a count of reads since switched off
+            disk6.motor_spinning = !disk6.motor_off; // the spin-down deadline is not saved
         }
 
         if (!helper->load(fd, &state, 1)) {
@@ -1172,7 +1937,7 @@ static bool _disk6_loadState(StateHelper_s *helper, JSON_ref json) {
             namelen |= (uint32_t)(serialized[2] <<  8);
             namelen |= (uint32_t)(serialized[3] <<  0);
 
-            if (changeState) {
+            if (changeState && !keepMedia) {
                 disk6_eject(i);
             }
 
@@ -1185,7 +1950,9 @@ static bool _disk6_loadState(StateHelper_s *helper, JSON_ref json) {
                 }
                 namebuf[namelen] = '\0';
 
-                if (changeState) {
+                if (keepMedia) {
+                    // rewinding keeps whatever image is currently inserted
+                } else if (changeState) {
                     if (disk6_insert(i == 0 ? helper->diskFdA : helper->diskFdB, /*drive:*/i, /*file_name:*/namebuf, /*readonly:*/is_protected)) {
                         LOG("OOPS loadState : proceeding despite cannot load disk : %s", namebuf);
                         //FREE(namebuf); break; -- ignore error with inserting disk and proceed
@@ -1219,6 +1986,13 @@ static bool _disk6_loadState(StateHelper_s *helper, JSON_ref json) {
                 break;
             }
             if (changeState) {
+                if (keepMedia && ((disk6.disk[i].phase >> 1) != (state >> 1))) {
+                    // head moves to another track of the kept image
+                    if (disk6.disk[i].tracks_dirty & TRACK_BIT(disk6.disk[i].phase >> 1)) {
+                        save_track_data(i, disk6.disk[i].phase >> 1);
+                    }
+                    disk6.disk[i].track_valid = false;
+                }
                 disk6.disk[i].phase = state;
             }
 
@@ -1231,7 +2005,7 @@ static bool _disk6_loadState(StateHelper_s *helper, JSON_ref json) {
             }
         }
 
-        if (changeState && !loaded_drives) {
+        if (changeState && !keepMedia && !loaded_drives) {
             disk6_eject(0);
             disk6_eject(1);
             break;
@@ -21,6 +21,7 @@
 #define ERR_IMAGE_NOT_EXPECTED_SIZE "disk image is not expected size"
 #define ERR_CANNOT_DUP "could not dup() disk image file descriptor"
 #define ERR_MMAP_FAILED "disk image unreadable for mmap"
+#define ERR_WOZ_IMAGE_INVALID "WOZ disk image is malformed"
 
 #define NUM_TRACKS 35
 #define NUM_SECTORS 16
@@ -38,6 +39,10 @@
 
 #define DSK_VOLUME 254
 
+#define WOZ_NUM_QTRACKS 160     // TMAP entries (quarter tracks 0.00 - 39.75)
+#define WOZ_MAX_TRACKS 160      // TRKS entries
+#define WOZ_BIT_TIMING 32       // default bit cell of 4us, in 125ns units
+
 #define DISK_EXT_DSK ".dsk"
 #define _DSKLEN (sizeof(DISK_EXT_DSK)-1)
 #define DISK_EXT_DO  ".do"
@@ -46,6 +51,8 @@
 #define _POLEN (sizeof(DISK_EXT_PO)-1)
 #define DISK_EXT_NIB ".nib"
 #define _NIBLEN (sizeof(DISK_EXT_NIB)-1)
+#define DISK_EXT_WOZ ".woz"
+#define _WOZLEN (sizeof(DISK_EXT_WOZ)-1)
 
 typedef struct diskette_t {
     char *file_name;
@@ -55,24 +62,40 @@ typedef struct diskette_t {
     uint8_t *nib_image_data;
     bool nibblized;
     bool is_protected;
-    bool track_valid;
-    bool track_dirty;
+    bool track_valid;           // head is synced to the current track
+    uint64_t tracks_nibblized;  // DSK/DO/PO tracks built in nib_image_data (bit per track)
+    uint64_t tracks_dirty;      // tracks written in nib_image_data since last saved back (bit per track)
     int *skew_table;
     unsigned int track_width;
     int phase;
     int run_byte;
+
+    // WOZ bit-stream images (raw_image_data holds the whole file, tracks are read in place)
+    bool woz;
+    uint8_t woz_tmap[WOZ_NUM_QTRACKS];          // quarter track to TRKS index (0xFF : no track)
+    const uint8_t *woz_bits[WOZ_MAX_TRACKS];    // MSB-first bit stream per TRKS index
+    uint32_t woz_bit_count[WOZ_MAX_TRACKS];
+    unsigned int woz_bit_timing;                // bit cell in 125ns units
+    int woz_track;                              // TRKS index under the head (-1 : none)
+    uint32_t bit_pos;                           // head position in the track bit stream
+    unsigned long bit_cycles;                   // CPU cycle count when the head was last advanced
+    unsigned int bit_frac;                      // ... plus the remainder of a bit cell (125ns units)
+    uint8_t shift_reg;                          // read sequencer shift register
+    uint8_t latch;                              // last complete nibble
+    uint8_t latch_hold;                         // bit cells the last complete nibble stays latched
 } diskette_t;
 
 typedef struct drive_t {
     struct timespec motor_time;
     int motor_off;
+    bool motor_spinning;                        // motor on, or switched off and still spinning down
     int drive;
     int ddrw;
     int disk_byte;
     diskette_t disk[2];
 } drive_t;
 
-extern drive_t disk6;
+extern VM_LOCAL drive_t disk6;
 
 // initialize emulated 5.25 Disk ][ module
 extern void disk6_init(void);
@@ -92,6 +115,9 @@ extern bool disk6_saveState(StateHelper_s *helper);
 extern bool disk6_loadState(StateHelper_s *helper);
 extern bool disk6_stateExtractDiskPaths(StateHelper_s *helper, JSON_ref json);
 
+// number of RWTS/ProDOS driver calls serviced directly from the image when accelerated disk I/O is enabled
+extern unsigned long disk6_acceleratedCalls(void);
+
 // CPU thread I/O
 extern uint8_t disk6_ioRead(uint16_t ea) CALL_ON_CPU_THREAD;
 extern void disk6_ioWrite(uint16_t ea, uint8_t b) CALL_ON_CPU_THREAD;
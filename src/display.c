@@ -17,6 +17,12 @@
 #include "video/video.h"
 #include "video/ntsc.h"
 
+#if !USE_RGBA4444 && defined(__SSE2__)
+#   include <emmintrin.h>
+#elif !USE_RGBA4444 && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#   include <arm_neon.h>
+#endif
+
 /*
  * Color structure
  */
@@ -27,16 +33,16 @@ typedef struct A2Color_s {
 } A2Color_s;
 
 typedef uint8_t (*glyph_getter_fn)(uint8_t idx, unsigned int row_off);
-typedef void (*plot_fn)(color_mode_t mode, uint16_t bits14, unsigned int col, uint32_t *colors16, unsigned int fb_off);
+typedef void (*plot_fn)(color_mode_t mode, const uint16_t *bits14, unsigned int scancol, unsigned int scanend, uint32_t *colors16, unsigned int fb_off);
 typedef void (*flush_fn)(color_mode_t mode, unsigned int fb_off);
-typedef PIXEL_TYPE (*scanline_color_fn)(PIXEL_TYPE color);
 
 static A2Color_s colormap[256] = { { 0 } };
 
-static uint8_t scan_last_bit = 0x0;
+static VM_LOCAL uint8_t scan_last_bit = 0x0;
 
 static glyph_getter_fn glyph_getter[256>>5] = { NULL }; // /32 == 8 sections
-static glyph_getter_fn flash_getter = NULL;
+static uint8_t _glyph_normal(uint8_t idx, unsigned int row_off);
+static VM_LOCAL glyph_getter_fn flash_getter = &_glyph_normal;
 
 static plot_fn plot[NUM_COLOROPTS] = { NULL };
 static flush_fn flush[6][NUM_COLOROPTS] = { { NULL } }; // 0-7, 8-15, 16-23, 24-31, 32-39, 40
@@ -46,7 +52,6 @@ static uint8_t interface_font[5][0x4000] = { { 0 } }; // interface font
 
 static color_mode_t color_mode = COLOR_MODE_DEFAULT;
 static mono_mode_t mono_mode = MONO_MODE_DEFAULT;
-static scanline_color_fn scanline_color[2] = { NULL };
 static uint8_t half_scanlines = 1;
 
 // video line offsets
@@ -70,10 +75,41 @@ static PIXEL_TYPE hires40_color [4096 << 2] = { 0 };
 static PIXEL_TYPE *hires40_colors[NUM_COLOROPTS] = { 0 };
 static PIXEL_TYPE *general_colors[NUM_COLOROPTS] = { 0 };
 
+// Precalculated HIRES40 byte expansion : (previous hibit-shifted bit, byte) -> 14 bits of signal
+static uint16_t hires40_bits14[2][256] = { { 0 } };
+
 #define FB_SIZ (SCANWIDTH*SCANHEIGHT)
 
-static PIXEL_TYPE fbFull[FB_SIZ + (SCANWIDTH<<1)] = { 0 }; // HACK NOTE: extra scanlines used for sampling
-static PIXEL_TYPE fbDone[FB_SIZ] = { 0 };
+static VM_LOCAL PIXEL_TYPE fbFull[FB_SIZ + (SCANWIDTH<<1)] = { 0 }; // HACK NOTE: extra scanlines used for sampling
+
+// Completed frames are handed off to the video backend through a lock-free triple buffer : the CPU thread owns the back
+// buffer, the backend owns the front buffer, and the two exchange buffers through the "ready" slot of fbState
+#define FB_NUM_BUFFERS 3
+#define FB_STATE_INDEX 0x3
+#define FB_STATE_FRESH 0x4 // ready buffer has not yet been acquired by the backend
+
+static VM_LOCAL PIXEL_TYPE fbDone[FB_NUM_BUFFERS][FB_SIZ] = { { 0 } };
+static VM_LOCAL volatile unsigned int fbState = 1;
+static VM_LOCAL unsigned int fbBack = 0;  // CPU thread
+static VM_LOCAL unsigned int fbFront = 2; // backend
+
+// Scanlines plotted into fbFull since last frame completion, and scanlines each buffer is missing from fbFull
+static VM_LOCAL uint32_t fbFullDirty[DIRTY_SCANLINE_WORDS] = { 0 };
+static VM_LOCAL uint32_t fbStaleDirty[FB_NUM_BUFFERS][DIRTY_SCANLINE_WORDS] = { { 0 } };
+
+// Frame sequence numbers : last frame that changed each scanline, frame held in each buffer, and the frame the backend
+// last reported dirty scanlines against
+static VM_LOCAL volatile unsigned long fbScanlineSeq[SCANHEIGHT>>1] = { 0 };
+static VM_LOCAL unsigned long fbBufferSeq[FB_NUM_BUFFERS] = { 0 };
+static VM_LOCAL unsigned long fbSeq = 0;
+static VM_LOCAL unsigned long fbReportedSeq = 0;
+static VM_LOCAL bool fbFrontForced = false;
+
+static pthread_mutex_t fbReadyMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t fbReadyCond = PTHREAD_COND_INITIALIZER;
+
+#define SCANLINE_IS_DIRTY(bitmap, scanrow) ((bitmap)[(scanrow)>>5] & (1U << ((scanrow) & 0x1F)))
+#define SCANLINE_SET_DIRTY(bitmap, scanrow) ((bitmap)[(scanrow)>>5] |= (1U << ((scanrow) & 0x1F)))
 
 // ----------------------------------------------------------------------------
 // Initialization routines
@@ -314,6 +350,24 @@ static void _initialize_color_values(PIXEL_TYPE *color_pixels, PIXEL_TYPE *inter
     }
 }
 
+static void _initialize_hires_values(void) {
+    // each data bit is doubled, hibit delays the byte by one pixel (half a color cycle) and extends the last bit of the
+    // previous byte
+    for (unsigned int last_bit = 0; last_bit < 2; last_bit++) {
+        for (unsigned int b = 0; b < 256; b++) {
+            uint8_t shift = (b & 0x80) >> 7;
+            uint16_t bits14 = 0;
+            for (unsigned int i=0; i<7; i++) {
+                uint16_t bit = b & (1 << i);
+                bits14 |= (bit << (i+0));
+                bits14 |= (bit << (i+1));
+            }
+            bits14 = (bits14 << shift) | (last_bit >> (1-shift));
+            hires40_bits14[last_bit][b] = bits14 & 0x3FFF;
+        }
+    }
+}
+
 static void _initialize_display(void) {
 
     // screen addresses ...
@@ -344,6 +398,7 @@ static void _initialize_display(void) {
     _initialize_colormap();
     _initialize_color_values(general_color, general_interp, /*adjustHIRES40:*/false);
     _initialize_color_values(hires40_color, hires40_interp, /*adjustHIRES40:*/true);
+    _initialize_hires_values();
 }
 
 static uint8_t _glyph_normal(uint8_t idx, unsigned int row_off) {
@@ -386,25 +441,33 @@ void display_loadFont(const uint8_t first, const uint8_t quantity, const uint8_t
 // ----------------------------------------------------------------------------
 // common plotting and filtering routines
 
-static PIXEL_TYPE _color_half_scanline(PIXEL_TYPE color0) {
-    PIXEL_TYPE color1 = ((color0 & 0xFEFEFEFE) >> 1) | (0xFF << SHIFT_A);
-    return color1;
-}
-
-static PIXEL_TYPE _color_full_scanline(PIXEL_TYPE color0) {
-    return color0;
+#define HALF_MASK(half)  ((half) ? 0xFEFEFEFE : 0xFFFFFFFF)
+#define HALF_ALPHA(half) ((half) ? (0xFFU << SHIFT_A) : 0x0)
+
+// blit a precalculated run of 4 pixels to the scanline and its (half) scanline below
+static inline void _blit_run4(PIXEL_TYPE *fb_ptr, const PIXEL_TYPE *pixels, const bool half) {
+#if !USE_RGBA4444 && defined(__SSE2__)
+    __m128i color0 = _mm_loadu_si128((const __m128i *)pixels);
+    __m128i color1 = _mm_or_si128(_mm_srli_epi32(_mm_and_si128(color0, _mm_set1_epi32((int)HALF_MASK(half))), half ? 1 : 0), _mm_set1_epi32((int)HALF_ALPHA(half)));
+    _mm_storeu_si128((__m128i *)fb_ptr, color0);
+    _mm_storeu_si128((__m128i *)(fb_ptr + SCANWIDTH), color1);
+#elif !USE_RGBA4444 && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    uint32x4_t color0 = vld1q_u32(pixels);
+    uint32x4_t color1 = vorrq_u32(vshlq_u32(vandq_u32(color0, vdupq_n_u32(HALF_MASK(half))), vdupq_n_s32(half ? -1 : 0)), vdupq_n_u32(HALF_ALPHA(half)));
+    vst1q_u32(fb_ptr, color0);
+    vst1q_u32(fb_ptr + SCANWIDTH, color1);
+#else
+    for (unsigned int j=0; j<4; j++) {
+        fb_ptr[j] = pixels[j];
+        fb_ptr[j + SCANWIDTH] = half ? (((pixels[j] & HALF_MASK(half)) >> 1) | HALF_ALPHA(half)) : pixels[j];
+    }
+#endif
 }
 
-static void _plot_oldschool(color_mode_t mode, uint16_t bits14, unsigned int col, PIXEL_TYPE *colors, unsigned int fb_off) {
+static void _plot_oldschool(color_mode_t mode, const uint16_t *bits14, unsigned int scancol, unsigned int scanend, PIXEL_TYPE *colors, unsigned int fb_off) {
     (void)mode;
 
-    uint8_t shift = 0x8 | ((col & 0x1) << 1);
-    uint16_t mask = ~(0xFF << shift); // 0xFF or 0x3FF
-    unsigned int off = ((shift & 0x8) >> 1) + (shift & 0x2); // 4 or 6
-
-    PIXEL_TYPE *fb_ptr = (&fbFull[0]) + fb_off - off;
-
-    extern unsigned int ntsc_signal_bits; // HACK ...
+    extern VM_LOCAL unsigned int ntsc_signal_bits; // HACK ...
 
     // 00BB,BBBB BAAA,AAAA dddd,dddc
     //                     -1 -> AAAA,dddd,dddc (redo 4 prior bits)
@@ -420,35 +483,43 @@ static void _plot_oldschool(color_mode_t mode, uint16_t bits14, unsigned int col
     //                      5 -> DDDD,DDDC,CCCC
     //                      6 -> aaaa,DDDD,DDDC xxx
     // -> 16bits rendered  (28bits total)
-    uint32_t scanbits32 = (bits14 << shift) | (ntsc_signal_bits & mask);
 
     static unsigned int last_col_shift[6] = { 0, 0, 0, 0, 0, 1 };
-    unsigned int count = 3 + (((shift >> 1) & 0x1) << last_col_shift[(col + 1) >> 3]);
-    assert(count == 3 || count == 4 || count == 5);
-    for (unsigned int i=0; i<count; i++) {
-        uint16_t idx = (scanbits32 >> (4 * i)) & 0xFFF;
 
-        idx <<= (PIXEL_STRIDE>>1);
-        PIXEL_TYPE *pixels = &colors[idx];
+    const bool half = half_scanlines;
+    unsigned int signal_bits = ntsc_signal_bits;
+    PIXEL_TYPE *col_ptr = (&fbFull[0]) + fb_off;
+
+    for (unsigned int col = scancol; col < scanend; col++, col_ptr += FONT_WIDTH_PIXELS) {
+        uint8_t shift = 0x8 | ((col & 0x1) << 1);
+        uint16_t mask = ~(0xFF << shift); // 0xFF or 0x3FF
+        unsigned int off = ((shift & 0x8) >> 1) + (shift & 0x2); // 4 or 6
 
-        for (unsigned int j=0; j<4; j++) {
-            fb_ptr[j] = pixels[j];
-            fb_ptr[j + SCANWIDTH] = scanline_color[half_scanlines](pixels[j]);
+        PIXEL_TYPE *fb_ptr = col_ptr - off;
+
+        uint32_t scanbits32 = (bits14[col] << shift) | (signal_bits & mask);
+
+        unsigned int count = 3 + (((shift >> 1) & 0x1) << last_col_shift[(col + 1) >> 3]);
+        assert(count == 3 || count == 4 || count == 5);
+        for (unsigned int i=0; i<count; i++) {
+            uint16_t idx = (scanbits32 >> (4 * i)) & 0xFFF;
+            idx <<= (PIXEL_STRIDE>>1);
+            _blit_run4(fb_ptr, &colors[idx], half);
+            fb_ptr += 4;
         }
 
-        fb_ptr += 4;
+        shift = ((shift & 0x8) >> 1) | (((shift >> 1) & 0x01) << 1);
+        mask = ~(0xFFFF << (14-shift));
+        signal_bits = ((bits14[col] >> shift) & mask);
     }
 
-    shift = ((shift & 0x8) >> 1) | (((shift >> 1) & 0x01) << 1);
-    mask = ~(0xFFFF << (14-shift));
-    ntsc_signal_bits = ((bits14 >> shift) & mask);
+    ntsc_signal_bits = signal_bits;
 }
 
-static void _plot_ntsc(color_mode_t mode, uint16_t bits14, unsigned int col, uint32_t *colors16, unsigned int fb_off) {
-    (void)col;
+static void _plot_ntsc(color_mode_t mode, const uint16_t *bits14, unsigned int scancol, unsigned int scanend, uint32_t *colors16, unsigned int fb_off) {
     (void)colors16;
     PIXEL_TYPE *fb_ptr = (&fbFull[0]) + fb_off;
-    ntsc_plotBits(mode, bits14, fb_ptr);
+    ntsc_plotSpan(mode, bits14 + scancol, scanend - scancol, fb_ptr);
 }
 
 static void _flush_nop(color_mode_t mode, unsigned int fb_off) {
@@ -501,6 +572,7 @@ static void _plot_char40_scanline(scan_data_t *scandata) {
     uint16_t fb_base = video_line_offset[scanrow>>3];
     unsigned int fb_row = ((row_off<<1) * SCANWIDTH);
 
+    uint16_t bits14[CYCLES_VIS];
     for (unsigned int col = scancol; col < scanend; col++)
     {
         uint16_t glyph_bits14 = 0;
@@ -514,9 +586,11 @@ static void _plot_char40_scanline(scan_data_t *scandata) {
             }
         }
 
-        plot[COLOR_MODE_MONO](COLOR_MODE_MONO, glyph_bits14, col, NULL, screen_addresses[fb_base+col] + fb_row);
+        bits14[col] = glyph_bits14;
     }
 
+    plot[COLOR_MODE_MONO](COLOR_MODE_MONO, bits14, scancol, scanend, NULL, screen_addresses[fb_base+scancol] + fb_row);
+
     int filter_idx = (scanend >> 3);
     flush[filter_idx][COLOR_MODE_MONO](COLOR_MODE_MONO, screen_addresses[fb_base] + fb_row); // flush triggers on scanline completion
 }
@@ -532,6 +606,7 @@ static void _plot_char80_scanline(scan_data_t *scandata) {
     uint16_t fb_base = video_line_offset[scanrow>>3];
     unsigned int fb_row = ((row_off<<1) * SCANWIDTH);
 
+    uint16_t bits14[CYCLES_VIS];
     for (unsigned int col = scancol; col < scanend; col++)
     {
         uint16_t glyph_bits14 = 0;
@@ -547,9 +622,11 @@ static void _plot_char80_scanline(scan_data_t *scandata) {
             glyph_bits14 |= glyph_bits7 << 7;
         }
 
-        plot[COLOR_MODE_MONO](COLOR_MODE_MONO, glyph_bits14, col, NULL, screen_addresses[fb_base+col] + fb_row);
+        bits14[col] = glyph_bits14;
     }
 
+    plot[COLOR_MODE_MONO](COLOR_MODE_MONO, bits14, scancol, scanend, NULL, screen_addresses[fb_base+scancol] + fb_row);
+
     int filter_idx = (scanend >> 3);
     flush[filter_idx][COLOR_MODE_MONO](COLOR_MODE_MONO, screen_addresses[fb_base] + fb_row); // flush triggers on scanline completion
 }
@@ -569,6 +646,7 @@ static void _plot_lores40_scanline(scan_data_t *scandata) {
     uint16_t fb_base = video_line_offset[scanrow>>3];
     unsigned int fb_row = ((row_off<<1) * SCANWIDTH);
 
+    uint16_t bits14[CYCLES_VIS];
     for (unsigned int col = scancol; col < scanend; col++)
     {
         uint8_t mbd = scanline[(col<<1)+1]; // MBD data only
@@ -576,12 +654,14 @@ static void _plot_lores40_scanline(scan_data_t *scandata) {
         uint8_t rot2 = ((col & 0x1) << 1); // 2 phases at double rotation
         val = (val >> rot2) | ((val & 0x03) << rot2);
 
-        uint16_t bits14 = val | (val << 4) | (val << 8) | (val << 12);
-        bits14 &= 0x3FFF;
+        uint16_t bits = val | (val << 4) | (val << 8) | (val << 12);
+        bits &= 0x3FFF;
 
-        plot[color_mode](color_mode, bits14, col, general_colors[color_mode], screen_addresses[fb_base+col] + fb_row);
+        bits14[col] = bits;
     }
 
+    plot[color_mode](color_mode, bits14, scancol, scanend, general_colors[color_mode], screen_addresses[fb_base+scancol] + fb_row);
+
     int filter_idx = (scanend >> 3);
     flush[filter_idx][color_mode](color_mode, screen_addresses[fb_base] + fb_row); // flush triggers on scanline completion
 }
@@ -613,9 +693,10 @@ static void _plot_lores80_scanline(scan_data_t *scandata) {
     uint16_t fb_base = video_line_offset[scanrow>>3];
     unsigned int fb_row = ((row_off<<1) * SCANWIDTH);
 
+    uint16_t bits14[CYCLES_VIS];
     for (unsigned int col = scancol; col < scanend; col++)
     {
-        uint16_t bits14;
+        uint16_t bits;
 
         {
             unsigned int idx = (col<<1)+0; // AUX
@@ -629,7 +710,7 @@ static void _plot_lores80_scanline(scan_data_t *scandata) {
                 val = (uint8_t)val16;
                 val &= 0x7F;
             }
-            bits14 = val;
+            bits = val;
         }
 
         {
@@ -643,12 +724,14 @@ static void _plot_lores80_scanline(scan_data_t *scandata) {
                 val = (uint8_t)val16;
                 val &= 0x7F;
             }
-            bits14 |= (val<<7);
+            bits |= (val<<7);
         }
 
-        plot[color_mode](color_mode, bits14, col, general_colors[color_mode], screen_addresses[fb_base+col] + fb_row);
+        bits14[col] = bits;
     }
 
+    plot[color_mode](color_mode, bits14, scancol, scanend, general_colors[color_mode], screen_addresses[fb_base+scancol] + fb_row);
+
     int filter_idx = (scanend >> 3);
     flush[filter_idx][color_mode](color_mode, screen_addresses[fb_base] + fb_row); // flush triggers on scanline completion
 }
@@ -712,11 +795,13 @@ void display_plotChar(const uint8_t col, const uint8_t row, const interface_colo
     assert(row < 24);
     unsigned int off = row * SCANWIDTH * FONT_HEIGHT_PIXELS + col * FONT80_WIDTH_PIXELS + _FB_OFF;
     _display_plotChar(fbFull+off, SCANWIDTH, cs, c);
+    memset(fbFullDirty, 0xFF, sizeof(fbFullDirty));
     video_setDirty(FB_DIRTY_FLAG);
 }
 
 void display_plotLine(const uint8_t col, const uint8_t row, const interface_colorscheme_t cs, const char *message) {
     _display_plotLine(fbFull, /*fbPixWidth:*/SCANWIDTH, /*xAdjust:*/_FB_OFF, col, row, cs, message);
+    memset(fbFullDirty, 0xFF, sizeof(fbFullDirty));
     video_setDirty(FB_DIRTY_FLAG);
 }
 #endif
@@ -747,6 +832,7 @@ static void _plot_hires80_scanline(scan_data_t *scandata) {
     // aaaaaaab bbbbbbcc cccccddd ddddeeee eeefffff ffgggggg ghhhhhhh ...
     // 01234560 12345601 23456012 34560123 45601234 56012345 60123456
 
+    uint16_t bits14[CYCLES_VIS];
     for (unsigned int col = scancol; col < scanend; col++)
     {
         uint8_t idx = (col<<1);
@@ -754,13 +840,15 @@ static void _plot_hires80_scanline(scan_data_t *scandata) {
         uint8_t aux = scanline[idx+0] & 0x7f; // AUX
         uint8_t mbd = scanline[idx+1] & 0x7f; // MBD
 
-        uint16_t bits14 = (((mbd << 7) | aux) << 1) | scan_last_bit;
+        uint16_t bits = (((mbd << 7) | aux) << 1) | scan_last_bit;
 
-        scan_last_bit = (bits14 >> 14) & 0x01;
+        scan_last_bit = (bits >> 14) & 0x01;
 
-        plot[color_mode](color_mode, bits14, col, general_colors[color_mode], screen_addresses[fb_base+col]);
+        bits14[col] = bits;
     }
 
+    plot[color_mode](color_mode, bits14, scancol, scanend, general_colors[color_mode], screen_addresses[fb_base+scancol]);
+
     int filter_idx = (scanend >> 3);
     flush[filter_idx][color_mode](color_mode, screen_addresses[fb_base]); // flush triggers on scanline completion
 }
@@ -776,28 +864,16 @@ static void _plot_hires40_scanline(scan_data_t *scandata) {
 
     uint16_t fb_base = video_line_offset[scanrow>>3] + (0x400 * (scanrow & 0x07));
 
+    uint16_t bits14[CYCLES_VIS];
     for (unsigned int col = scancol; col < scanend; col++)
     {
-        uint16_t bits14 = 0;
-        uint8_t shift;
-        {
-            uint8_t mbd = scanline[(col<<1)+1]; // MBD data only
-            shift = (mbd & 0x80) >> 7;
-
-            for (unsigned int i=0; i<7; i++) {
-                uint8_t b = mbd & (1 << i);
-                bits14 |= (b << (i+0));
-                bits14 |= (b << (i+1));
-            }
-
-            bits14 = (bits14 << shift) | (scan_last_bit >> (1-shift));
-            scan_last_bit = (mbd & 0x40) >> 6;
-            bits14 &= 0x3FFF;
-        }
-
-        plot[color_mode](color_mode, bits14, col, hires40_colors[color_mode], screen_addresses[fb_base+col]);
+        uint8_t mbd = scanline[(col<<1)+1]; // MBD data only
+        bits14[col] = hires40_bits14[scan_last_bit][mbd];
+        scan_last_bit = (mbd & 0x40) >> 6;
     }
 
+    plot[color_mode](color_mode, bits14, scancol, scanend, hires40_colors[color_mode], screen_addresses[fb_base+scancol]);
+
     int filter_idx = (scanend >> 3);
     flush[filter_idx][color_mode](color_mode, screen_addresses[fb_base]); // flush triggers on scanline completion
 }
@@ -936,13 +1012,13 @@ PIXEL_TYPE *display_waitForNextCompleteFramebuffer(void) {
     if ((err = pthread_cond_wait(&dbg_thread_cond, &interface_mutex))) {
         LOG("pthread_cond_wait : %d", err);
     }
-    return display_getCurrentFramebuffer();
+    return display_peekCurrentFramebuffer();
 }
 #endif
 
 
 void display_flashText(void) {
-    static bool flash_normal = false;
+    static VM_LOCAL bool flash_normal = false;
     flash_normal = !flash_normal;
 
     if (flash_normal) {
@@ -955,12 +1031,64 @@ void display_flashText(void) {
 }
 
 PIXEL_TYPE *display_getCurrentFramebuffer(void) {
+    // swap in the most recently completed frame (if any) ...
+    if (fbState & FB_STATE_FRESH) {
+        unsigned int state;
+        do {
+            state = fbState;
+        } while (!__sync_bool_compare_and_swap(&fbState, state, fbFront));
+        fbFront = state & FB_STATE_INDEX;
+    }
+
 #if INTERFACE_CLASSIC
     if (interface_isShowing()) {
-        memcpy(/*dst:*/fbDone, /*src:*/fbFull, sizeof(fbDone));
+        memcpy(/*dst:*/fbDone[fbFront], /*src:*/fbFull, sizeof(fbDone[0]));
+        fbFrontForced = true;
     }
 #endif
-    return fbDone;
+    return fbDone[fbFront];
+}
+
+PIXEL_TYPE *display_peekCurrentFramebuffer(void) {
+    // most recently completed frame, left in place for the backend to acquire
+    unsigned int state = fbState;
+    return fbDone[(state & FB_STATE_FRESH) ? (state & FB_STATE_INDEX) : fbFront];
+}
+
+void display_getDirtyScanlines(uint32_t *bitmap) {
+    // a scanline changed at any frame later than the last one reported may differ (conservatively includes scanlines
+    // already changed for frames not yet acquired)
+    const unsigned long reportedSeq = fbReportedSeq;
+    for (unsigned int i = 0; i < DIRTY_SCANLINE_WORDS; i++) {
+        bitmap[i] = fbFrontForced ? ~0U : 0U;
+    }
+    for (unsigned int scanrow = 0; scanrow < (SCANHEIGHT>>1); scanrow++) {
+        if (fbScanlineSeq[scanrow] > reportedSeq) {
+            SCANLINE_SET_DIRTY(bitmap, scanrow);
+        }
+    }
+    fbReportedSeq = fbBufferSeq[fbFront];
+    fbFrontForced = false;
+}
+
+bool display_waitForFrame(unsigned long nsecs) {
+    if (fbState & FB_STATE_FRESH) {
+        return true;
+    }
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline = timespec_add(deadline, nsecs);
+
+    pthread_mutex_lock(&fbReadyMutex);
+    while (!(fbState & FB_STATE_FRESH)) {
+        if (pthread_cond_timedwait(&fbReadyCond, &fbReadyMutex, &deadline)) {
+            break;
+        }
+    }
+    pthread_mutex_unlock(&fbReadyMutex);
+
+    return !!(fbState & FB_STATE_FRESH);
 }
 
 void display_flushScanline(scan_data_t *scandata) {
@@ -993,6 +1121,7 @@ void display_flushScanline(scan_data_t *scandata) {
     }
 
     plotFn(scandata);
+    SCANLINE_SET_DIRTY(fbFullDirty, scanrow);
 }
 
 void display_frameComplete(void) {
@@ -1000,9 +1129,57 @@ void display_frameComplete(void) {
 
     SCOPE_TRACE_CPU("frameComplete");
 
-    memcpy(/*dst:*/fbDone, /*src:*/fbFull, sizeof(fbDone));
+    // stamp scanlines plotted this frame and mark them stale in every buffer ...
+    ++fbSeq;
+    const unsigned int scanlines = SCANHEIGHT>>1;
+    for (unsigned int scanrow = 0; scanrow < scanlines; scanrow++) {
+        if (SCANLINE_IS_DIRTY(fbFullDirty, scanrow)) {
+            fbScanlineSeq[scanrow] = fbSeq;
+        }
+    }
+    for (unsigned int i = 0; i < DIRTY_SCANLINE_WORDS; i++) {
+        for (unsigned int j = 0; j < FB_NUM_BUFFERS; j++) {
+            fbStaleDirty[j][i] |= fbFullDirty[i];
+        }
+        fbFullDirty[i] = 0;
+    }
+
+    // bring the back buffer up to date with runs of scanlines it missed (each scanline is two framebuffer rows, plus
+    // NTSC overdraw into the neighboring rows' extra pixels) ...
+    uint32_t *staleDirty = fbStaleDirty[fbBack];
+    PIXEL_TYPE *fb = fbDone[fbBack];
+    const unsigned int rowPixels = SCANWIDTH<<1;
+    for (unsigned int scanrow = 0; scanrow < scanlines; ) {
+        if (!SCANLINE_IS_DIRTY(staleDirty, scanrow)) {
+            ++scanrow;
+            continue;
+        }
+        unsigned int first = scanrow;
+        while (scanrow < scanlines && SCANLINE_IS_DIRTY(staleDirty, scanrow)) {
+            ++scanrow;
+        }
+        unsigned int begin = first * rowPixels;
+        unsigned int end = scanrow * rowPixels;
+        begin = (begin >= _FB_WIDTH_EXTRA) ? begin - _FB_WIDTH_EXTRA : 0;
+        end = (end + _FB_WIDTH_EXTRA <= FB_SIZ) ? end + _FB_WIDTH_EXTRA : FB_SIZ;
+        memcpy(/*dst:*/fb+begin, /*src:*/fbFull+begin, (end-begin)*sizeof(PIXEL_TYPE));
+    }
+    memset(staleDirty, 0x0, sizeof(fbStaleDirty[0]));
+    fbBufferSeq[fbBack] = fbSeq;
+
+    // publish back buffer as the ready frame and take over the previous ready buffer (acquired or not) ...
+    unsigned int state;
+    do {
+        state = fbState;
+    } while (!__sync_bool_compare_and_swap(&fbState, state, fbBack | FB_STATE_FRESH));
+    fbBack = state & FB_STATE_INDEX;
+
     video_setDirty(FB_DIRTY_FLAG);
 
+    pthread_mutex_lock(&fbReadyMutex);
+    pthread_cond_signal(&fbReadyCond);
+    pthread_mutex_unlock(&fbReadyMutex);
+
 #if TESTING
     // HACK FIXME TODO ... should consolidate this into debugger ...
     int err = 0;
@@ -1058,9 +1235,6 @@ static void _init_interface(void) {
     general_colors[COLOR_MODE_COLOR]  = &general_color [0];
     general_colors[COLOR_MODE_INTERP] = &general_interp[0];
 
-    scanline_color[0] = _color_full_scanline;
-    scanline_color[1] = _color_half_scanline;
-
     flash_getter = _glyph_normal;
 
     prefs_registerListener(PREF_DOMAIN_VIDEO, &display_prefsChanged);
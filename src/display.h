@@ -218,9 +218,30 @@ uint16_t display_getVideoLineOffset(uint8_t txtRow);
 /*
  * Called by video backend to get the current complete staging framebuffer.
  *  - Framebuffer is exactly SCANWIDTH*SCANHEIGHT*sizeof(PIXEL_TYPE)
+ *  - Swaps in the most recently completed frame without copying.  The returned framebuffer is owned by the (single)
+ *    video backend and remains valid until the next call
  */
 PIXEL_TYPE *display_getCurrentFramebuffer(void) CALL_ON_UI_THREAD;
 
+/*
+ * Get the most recently completed framebuffer without swapping it out from under the video backend (for the debugger
+ * and tests).  The CPU thread should be stopped while the framebuffer is examined
+ */
+PIXEL_TYPE *display_peekCurrentFramebuffer(void);
+
+/*
+ * Called by video backend to fetch the bitmap (DIRTY_SCANLINE_WORDS words) of Apple //e scanlines (bit n & 0x1F of word
+ * n>>5) that may differ in the current framebuffer from the one current when last called.  Each scanline is two
+ * framebuffer rows.
+ */
+void display_getDirtyScanlines(OUTPARM uint32_t *bitmap) CALL_ON_UI_THREAD;
+
+/*
+ * Called by video backend to wait up to nsecs for the CPU thread to complete a frame not yet acquired with
+ * display_getCurrentFramebuffer().  Returns true if such a frame is ready.
+ */
+bool display_waitForFrame(unsigned long nsecs) CALL_ON_UI_THREAD;
+
 /*
  * Handler for toggling text flashing
  */
@@ -257,6 +278,7 @@ PIXEL_TYPE *display_waitForNextCompleteFramebuffer(void);
 
 #define _SCANWIDTH (TEXT_COLS * FONT_WIDTH_PIXELS)  // 560
 #define SCANHEIGHT (TEXT_ROWS * FONT_HEIGHT_PIXELS) // 384
+#define DIRTY_SCANLINE_WORDS ((SCANHEIGHT>>1)/32) // 192 scanlines
 
 // Extra bytes on each side of internal framebuffer to allow overdraw for NTSC modes
 #define _FB_OFF                 4
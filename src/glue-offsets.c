@@ -87,6 +87,15 @@ int main (int argc, char **argv) {
     OUTPUT_JOY_BUTTON1();
 
     OUTPUT_EMUL_REINITIALIZE();
+    OUTPUT_CPU65_HALTED();
+
+    OUTPUT_CPU65_OPERAND();
+
+    OUTPUT_CPU65_VMEM_RBASE();
+    OUTPUT_CPU65__OPBYTES();
+    OUTPUT_CPU65_VMEM_WBASE();
+    OUTPUT_CPU65_HALTMAP();
+    OUTPUT_CPU65_PROFILE();
 
     fflush(stdout);
 
@@ -201,6 +201,22 @@ typedef struct cpu65_run_args_s {
 
     uint8_t emul_reinitialize;
 #define OUTPUT_EMUL_REINITIALIZE() printf("#define EMUL_REINITIALIZE %ld\n", offsetof(cpu65_run_args_s, emul_reinitialize))
+    uint8_t cpu65_halted;    // Set when cpu65_run() returned early on a cpu65_haltmap hit
+#define OUTPUT_CPU65_HALTED() printf("#define CPU65_HALTED %ld\n", offsetof(cpu65_run_args_s, cpu65_halted))
+
+    uint16_t cpu65_operand;  // Operand byte(s) of the current instruction, staged at opcode fetch
+#define OUTPUT_CPU65_OPERAND() printf("#define CPU65_OPERAND %ld\n", offsetof(cpu65_run_args_s, cpu65_operand))
+
+    uint8_t *cpu65_vmem_rbase;
+#define OUTPUT_CPU65_VMEM_RBASE() printf("#define CPU65_VMEM_RBASE %ld\n", offsetof(cpu65_run_args_s, cpu65_vmem_rbase))
+    uint8_t *cpu65__opbytes;
+#define OUTPUT_CPU65__OPBYTES() printf("#define CPU65__OPBYTES %ld\n", offsetof(cpu65_run_args_s, cpu65__opbytes))
+    uint8_t *cpu65_vmem_wbase;
+#define OUTPUT_CPU65_VMEM_WBASE() printf("#define CPU65_VMEM_WBASE %ld\n", offsetof(cpu65_run_args_s, cpu65_vmem_wbase))
+    uint8_t *cpu65_haltmap;  // Debugger breakpoint/watchpoint bitmaps checked after each instruction (NULL : none armed)
+#define OUTPUT_CPU65_HALTMAP() printf("#define CPU65_HALTMAP %ld\n", offsetof(cpu65_run_args_s, cpu65_haltmap))
+    void (*cpu65_profile)(uint16_t, uint8_t); // Profiler sample hook called after each instruction (NULL : not profiling)
+#define OUTPUT_CPU65_PROFILE() printf("#define CPU65_PROFILE %ld\n", offsetof(cpu65_run_args_s, cpu65_profile))
 
 } cpu65_run_args_s;
 
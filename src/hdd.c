@@ -0,0 +1,380 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2018 Aaron Culliney
+ *
+ */
+
+/*
+ * ProDOS block device card for hard disk images (.hdv/.po/.2mg, up to 32MB each, two drives).
+ *
+ * The card firmware is a minimal ProDOS block driver : the boot code reads block 0 to $0800, and the driver entry
+ * point hands the request (command, unit, buffer and block in zero page $42-$47) to the emulator with a single read
+ * of the card's command register, which transfers the whole block directly between the image and memory.
+ */
+
+#include "common.h"
+
+#include <sys/mman.h>
+
+#define HDD_IO_COMMAND      0x0 // read : execute request in $42-$47, returns ProDOS error code
+#define HDD_IO_BLOCKS_LO    0x1 // read : block count of the addressed drive (status)
+#define HDD_IO_BLOCKS_HI    0x2
+
+#define PRODOS_ZP_COMMAND   0x42
+#define PRODOS_ZP_UNIT      0x43
+#define PRODOS_ZP_BUFFER    0x44
+#define PRODOS_ZP_BLOCK     0x46
+
+#define PRODOS_CMD_STATUS   0x00
+#define PRODOS_CMD_READ     0x01
+#define PRODOS_CMD_WRITE    0x02
+#define PRODOS_CMD_FORMAT   0x03
+
+#define PRODOS_ERR_NONE     0x00
+#define PRODOS_ERR_IO       0x27
+#define PRODOS_ERR_NO_DEVICE 0x28
+#define PRODOS_ERR_WRITE_PROT 0x2B
+
+#define FIRMWARE_DRIVER     0x30 // driver entry point offset within $Cn00 page
+
+#define HDR_2MG_SIZE        64
+#define HDR_2MG_FORMAT_PO   1
+#define HDR_2MG_LOCKED      0x80000000
+
+typedef struct harddisk_t {
+    char *file_name;
+    int fd;
+    uint8_t *map;               // whole image file, mmap'd
+    size_t map_len;
+    uint8_t *blocks;            // start of block data within map
+    unsigned int num_blocks;
+    bool is_protected;
+    uint8_t *dirty;             // dirty block bitmap
+    bool has_dirty;
+} harddisk_t;
+
+static VM_LOCAL harddisk_t hdd[HDD_NUM_DRIVES] = {
+    { .fd = -1, .map = MAP_FAILED },
+    { .fd = -1, .map = MAP_FAILED },
+};
+
+static uint8_t firmware[256] = { 0 };
+static VM_LOCAL uint16_t status_blocks = 0;
+
+static pthread_mutex_t insertion_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static void _init_hdd(void) {
+    LOG("ProDOS block device card setup in slot %d", HDD_SLOT);
+
+    const uint8_t slot16 = (HDD_SLOT << 4);
+    const uint8_t cn = 0xC0 | HDD_SLOT;
+    const uint8_t io = 0x80 | slot16;
+    const uint8_t code[] = {
+        // $Cn00 : ProDOS block device signature ($Cn01=$20, $Cn03=$00, $Cn05=$03, $Cn07=$3C) ...
+        0xA2, 0x20,                 // LDX #$20
+        0xA0, 0x00,                 // LDY #$00
+        0xA2, 0x03,                 // LDX #$03
+        0x86, 0x3C,                 // STX $3C
+        // ... boot : read block 0 of drive 1 to $0800
+        0xA9, PRODOS_CMD_READ,      // LDA #READ
+        0x85, PRODOS_ZP_COMMAND,    // STA $42
+        0xA9, slot16,               // LDA #$n0
+        0x85, PRODOS_ZP_UNIT,       // STA $43
+        0xA9, 0x00,                 // LDA #$00
+        0x85, PRODOS_ZP_BUFFER,     // STA $44
+        0x85, PRODOS_ZP_BLOCK,      // STA $46
+        0x85, PRODOS_ZP_BLOCK+1,    // STA $47
+        0xA9, 0x08,                 // LDA #$08
+        0x85, PRODOS_ZP_BUFFER+1,   // STA $45
+        0x20, FIRMWARE_DRIVER, cn,  // JSR driver
+        0xB0, 0x05,                 // BCS fail
+        0xA2, slot16,               // LDX #$n0
+        0x4C, 0x01, 0x08,           // JMP $0801
+        0x4C, 0x00, 0xE0,           // fail : JMP $E000
+    };
+    const uint8_t driver[] = {
+        0xAD, io|HDD_IO_COMMAND, 0xC0,   // LDA $C0n0 (execute)
+        0xAE, io|HDD_IO_BLOCKS_LO, 0xC0, // LDX $C0n1
+        0xAC, io|HDD_IO_BLOCKS_HI, 0xC0, // LDY $C0n2
+        0xC9, 0x01,                      // CMP #$01 (carry set on error)
+        0x60,                            // RTS
+    };
+    assert(sizeof(code) <= FIRMWARE_DRIVER);
+
+    memcpy(&firmware[0], code, sizeof(code));
+    memcpy(&firmware[FIRMWARE_DRIVER], driver, sizeof(driver));
+    firmware[0xFC] = 0x00; // block count from status call
+    firmware[0xFD] = 0x00;
+    firmware[0xFE] = 0x17; // 2 volumes, status/read/write
+    firmware[0xFF] = FIRMWARE_DRIVER;
+}
+
+static __attribute__((constructor)) void __init_hdd(void) {
+    emulator_registerStartupCallback(CTOR_PRIORITY_LATE, &_init_hdd);
+}
+
+static inline bool _has_extension(const char * const name, const char * const ext, size_t extlen) {
+    size_t len = strlen(name);
+    if (len <= extlen) {
+        return false;
+    }
+    return strncasecmp(name+len-extlen, ext, extlen) == 0;
+}
+
+static inline uint32_t _le32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+bool hdd_isImage(const char * const file_name, off_t size) {
+    if (_has_extension(file_name, HDD_EXT_HDV, _HDVLEN) || _has_extension(file_name, HDD_EXT_2MG, _2MGLEN)) {
+        return true;
+    }
+    return _has_extension(file_name, DISK_EXT_PO, _POLEN) && (size > DSK_SIZE);
+}
+
+// ----------------------------------------------------------------------------
+
+static uint8_t _hdd_transferBlock(uint8_t command, int drive, uint16_t buf, uint16_t block) {
+    harddisk_t *disk = &hdd[drive];
+
+    if (disk->map == MAP_FAILED) {
+        return PRODOS_ERR_NO_DEVICE;
+    }
+    if (block >= disk->num_blocks) {
+        return PRODOS_ERR_IO;
+    }
+
+    uint8_t *data = disk->blocks + (block * HDD_BLOCK_SIZE);
+    if (command == PRODOS_CMD_READ) {
+        for (unsigned int i=0; i<HDD_BLOCK_SIZE; i++) {
+            vm_writeByte(buf+i, data[i]);
+        }
+    } else {
+        if (disk->is_protected) {
+            return PRODOS_ERR_WRITE_PROT;
+        }
+        for (unsigned int i=0; i<HDD_BLOCK_SIZE; i++) {
+            data[i] = vm_readByte(buf+i);
+        }
+        disk->dirty[block >> 3] |= (1 << (block & 0x7));
+        disk->has_dirty = true;
+    }
+
+    return PRODOS_ERR_NONE;
+}
+
+uint8_t hdd_ioRead(uint16_t ea) {
+    switch (ea & 0xF) {
+        case HDD_IO_COMMAND:
+            break;
+        case HDD_IO_BLOCKS_LO:
+            return status_blocks & 0xFF;
+        case HDD_IO_BLOCKS_HI:
+            return status_blocks >> 8;
+        default:
+            return floating_bus();
+    }
+
+    uint8_t command = vm_readByte(PRODOS_ZP_COMMAND);
+    int drive = (vm_readByte(PRODOS_ZP_UNIT) >> 7);
+    uint16_t buf   = vm_readByte(PRODOS_ZP_BUFFER) | (vm_readByte(PRODOS_ZP_BUFFER+1) << 8);
+    uint16_t block = vm_readByte(PRODOS_ZP_BLOCK)  | (vm_readByte(PRODOS_ZP_BLOCK+1) << 8);
+
+    status_blocks = hdd[drive].num_blocks;
+
+    switch (command) {
+        case PRODOS_CMD_STATUS:
+            if (hdd[drive].map == MAP_FAILED) {
+                return PRODOS_ERR_NO_DEVICE;
+            }
+            return hdd[drive].is_protected ? PRODOS_ERR_WRITE_PROT : PRODOS_ERR_NONE;
+        case PRODOS_CMD_READ:
+        case PRODOS_CMD_WRITE:
+            return _hdd_transferBlock(command, drive, buf, block);
+        case PRODOS_CMD_FORMAT:
+            if (hdd[drive].map == MAP_FAILED) {
+                return PRODOS_ERR_NO_DEVICE;
+            }
+            return hdd[drive].is_protected ? PRODOS_ERR_WRITE_PROT : PRODOS_ERR_NONE;
+        default:
+            return PRODOS_ERR_IO;
+    }
+}
+
+uint8_t hdd_romRead(uint16_t ea) {
+    // card is only present (and boots ahead of the floppy) with an image mounted in drive 1
+    if (hdd[0].map == MAP_FAILED) {
+        return floating_bus();
+    }
+    return firmware[ea & 0xFF];
+}
+
+// ----------------------------------------------------------------------------
+
+unsigned int hdd_blockCount(int drive) {
+    assert(drive >= 0 && drive < HDD_NUM_DRIVES);
+    return hdd[drive].num_blocks;
+}
+
+void hdd_flush(int drive) {
+    assert(drive >= 0 && drive < HDD_NUM_DRIVES);
+
+    harddisk_t *disk = &hdd[drive];
+    if (disk->map == MAP_FAILED || !disk->has_dirty) {
+        return;
+    }
+
+    // sync runs of dirty blocks (page aligned) rather than the whole mapping
+    const uintptr_t pagemask = (uintptr_t)sysconf(_SC_PAGESIZE) - 1;
+    unsigned int block = 0;
+    while (block < disk->num_blocks) {
+        if (!(disk->dirty[block >> 3] & (1 << (block & 0x7)))) {
+            ++block;
+            continue;
+        }
+        unsigned int end = block;
+        while (end < disk->num_blocks && (disk->dirty[end >> 3] & (1 << (end & 0x7)))) {
+            disk->dirty[end >> 3] &= ~(1 << (end & 0x7));
+            ++end;
+        }
+
+        uintptr_t lo = (uintptr_t)(disk->blocks + (block * HDD_BLOCK_SIZE));
+        uintptr_t hi = (uintptr_t)(disk->blocks + (end * HDD_BLOCK_SIZE));
+        lo &= ~pagemask;
+        int ret = -1;
+        TEMP_FAILURE_RETRY(ret = msync((void *)lo, hi-lo, MS_SYNC));
+        if (ret) {
+            LOG("OOPS, error syncing hard disk image %s (%s)", disk->file_name, strerror(errno));
+        }
+
+        block = end;
+    }
+
+    disk->has_dirty = false;
+}
+
+const char *hdd_eject(int drive) {
+    assert(drive >= 0 && drive < HDD_NUM_DRIVES);
+
+    pthread_mutex_lock(&insertion_mutex);
+
+    harddisk_t *disk = &hdd[drive];
+
+    hdd_flush(drive);
+
+    if (disk->map != MAP_FAILED) {
+        int ret = -1;
+        TEMP_FAILURE_RETRY(ret = munmap(disk->map, disk->map_len));
+        if (ret) {
+            LOG("OOPS, error unmapping hard disk image %s (%s)", disk->file_name, strerror(errno));
+        }
+    }
+    if (disk->fd >= 0) {
+        TEMP_FAILURE_RETRY(close(disk->fd));
+    }
+
+    FREE(disk->file_name);
+    FREE(disk->dirty);
+    disk->fd = -1;
+    disk->map = MAP_FAILED;
+    disk->map_len = 0;
+    disk->blocks = NULL;
+    disk->num_blocks = 0;
+    disk->is_protected = false;
+    disk->has_dirty = false;
+
+    pthread_mutex_unlock(&insertion_mutex);
+
+    return NULL;
+}
+
+const char *hdd_insert(int fd, int drive, const char * const file_name, int readonly) {
+
+#if !TESTING
+    assert(cpu_isPaused() && "CPU must be paused for disk insertion");
+#endif
+    assert(drive >= 0 && drive < HDD_NUM_DRIVES);
+
+    hdd_eject(drive);
+
+    pthread_mutex_lock(&insertion_mutex);
+
+    harddisk_t *disk = &hdd[drive];
+    const char *err = NULL;
+    do {
+        struct stat stat_buf;
+        if (fstat(fd, &stat_buf) < 0 || stat_buf.st_size < HDD_BLOCK_SIZE) {
+            err = ERR_HDD_IMAGE_NOT_RECOGNIZED;
+            break;
+        }
+
+        TEMP_FAILURE_RETRY(fd = dup(fd));
+        if (fd == -1) {
+            LOG("OOPS, could not dup() file descriptor %d (%s)", fd, strerror(errno));
+            err = ERR_CANNOT_DUP;
+            break;
+        }
+        disk->fd = fd;
+        disk->file_name = STRDUP(file_name);
+        disk->is_protected = readonly;
+        disk->map_len = stat_buf.st_size;
+
+        TEMP_FAILURE_RETRY( (long)(disk->map = mmap(NULL, disk->map_len, (readonly ? PROT_READ : PROT_READ|PROT_WRITE), MAP_SHARED|MAP_FILE, disk->fd, /*offset:*/0)) );
+        if (disk->map == MAP_FAILED) {
+            LOG("OOPS, could not mmap hard disk image %s (%s)", file_name, strerror(errno));
+            err = ERR_MMAP_FAILED;
+            break;
+        }
+
+        // blocks are paged in as the guest touches them, no point reading ahead through a 32MB image
+        madvise(disk->map, disk->map_len, MADV_RANDOM);
+
+        size_t data_off = 0;
+        size_t data_len = disk->map_len;
+        if (_has_extension(file_name, HDD_EXT_2MG, _2MGLEN)) {
+            if (disk->map_len < HDR_2MG_SIZE || memcmp(disk->map, "2IMG", 4) != 0) {
+                err = ERR_HDD_IMAGE_NOT_RECOGNIZED;
+                break;
+            }
+            if (_le32(disk->map+0x0C) != HDR_2MG_FORMAT_PO) {
+                LOG("OOPS, only ProDOS-order 2MG images are supported : %s", file_name);
+                err = ERR_HDD_IMAGE_NOT_RECOGNIZED;
+                break;
+            }
+            if (_le32(disk->map+0x10) & HDR_2MG_LOCKED) {
+                disk->is_protected = true;
+            }
+            data_off = _le32(disk->map+0x18);
+            data_len = _le32(disk->map+0x1C);
+            if (!data_len) {
+                data_len = _le32(disk->map+0x14) * HDD_BLOCK_SIZE;
+            }
+            if (data_off + data_len > disk->map_len) {
+                err = ERR_IMAGE_NOT_EXPECTED_SIZE;
+                break;
+            }
+        }
+
+        disk->blocks = disk->map + data_off;
+        disk->num_blocks = MIN(data_len / HDD_BLOCK_SIZE, HDD_MAX_BLOCKS);
+        if (!disk->num_blocks) {
+            err = ERR_IMAGE_NOT_EXPECTED_SIZE;
+            break;
+        }
+        disk->dirty = CALLOC(1, (disk->num_blocks+7) >> 3);
+        disk->has_dirty = false;
+    } while (0);
+
+    pthread_mutex_unlock(&insertion_mutex);
+
+    if (err) {
+        hdd_eject(drive);
+    }
+
+    return err;
+}
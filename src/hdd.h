@@ -0,0 +1,49 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2018 Aaron Culliney
+ *
+ */
+
+#ifndef A2_HDD_H
+#define A2_HDD_H
+
+#include "common.h"
+
+#define ERR_HDD_IMAGE_NOT_RECOGNIZED "hard disk image not recognized"
+
+#define HDD_SLOT 7
+#define HDD_NUM_DRIVES 2
+#define HDD_BLOCK_SIZE 512
+#define HDD_MAX_BLOCKS 0xFFFF // 32MB ProDOS volume
+
+#define HDD_EXT_HDV ".hdv"
+#define _HDVLEN (sizeof(HDD_EXT_HDV)-1)
+#define HDD_EXT_2MG ".2mg"
+#define _2MGLEN (sizeof(HDD_EXT_2MG)-1)
+
+// Is file_name a hard disk image (.hdv/.2mg, or a .po image larger than a 5.25 diskette)?
+extern bool hdd_isImage(const char * const file_name, off_t size);
+
+// mount ProDOS-order hard disk image file (.hdv/.po/.2mg) from file descriptor (internally dup()'d so caller may
+// close() the passed fd after invocation).  The image is mmap'd, so blocks are paged in on demand.
+extern const char *hdd_insert(int fd, int drive, const char * const file_name, int readonly);
+
+// unmount hard disk image (flushing dirty blocks)
+extern const char *hdd_eject(int drive);
+
+// write back dirty blocks to the image file
+extern void hdd_flush(int drive);
+
+// number of blocks of the mounted image (0 if none)
+extern unsigned int hdd_blockCount(int drive);
+
+// CPU thread I/O : card firmware ($Cn00-$CnFF) and I/O registers ($C0n0-$C0nF)
+extern uint8_t hdd_romRead(uint16_t ea) CALL_ON_CPU_THREAD;
+extern uint8_t hdd_ioRead(uint16_t ea) CALL_ON_CPU_THREAD;
+
+#endif /* A2_HDD_H */
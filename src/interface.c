@@ -267,6 +267,10 @@ static int disk_select(const struct dirent *e) {
         return 1;
     }
 
+    if (!strncmp(p + len - 4, ".woz", 4)) {
+        return 1;
+    }
+
     return 0;
 }
 
@@ -732,7 +736,7 @@ void c_interface_parameters()
       "| F1 F2: Insert Diskette in Slot6 Disk Drive A or Drive B                      |",
       "| F5   : Show Keyboard Layout                               F7 : 6502 Debugger |",
       "| F9   : Toggle Between CPU% / ALT CPU% Speeds                                 |",
-      "| F10  : Show This Menu                                                        |",
+      "| F10  : Show This Menu                                     F6 : Rewind 5 Secs |",
       "|                                                                              |",
       "|               For interface help press '?' ... ESC exits menu                |",
       "||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||" };
@@ -1113,10 +1117,10 @@ void c_interface_parameters()
               "|                                      |",
               "| F1 F2: Slot6 Disk Drive A, Drive B   |",
               "| F5   : Show Keyboard Layout          |",
+              "| F6   : Rewind 5 Seconds              |",
               "| F7   : 6502 Debugger                 |",
               "| F9   : Toggle Emulator Speed         |",
               "| F10  : Main Menu                     |",
-              "|                                      |",
               "| Ctrl-LeftAlt-End Reboots //e         |",
               "| Pause/Brk : Pause Emulator           |",
               "||||||||||||||||||||||||||||||||||||||||" };
@@ -23,8 +23,8 @@ extern void copy_and_pad_string(char *dest, const char* src, const char c, const
 joystick_mode_t joy_mode = JOY_MODE_DEFAULT;
 
 /* parameters for generic and keyboard-simulated joysticks */
-uint16_t joy_x = HALF_JOY_RANGE;
-uint16_t joy_y = HALF_JOY_RANGE;
+VM_LOCAL uint16_t joy_x = HALF_JOY_RANGE;
+VM_LOCAL uint16_t joy_y = HALF_JOY_RANGE;
 bool joy_clip_to_radius = false;
 
 #ifdef KEYPAD_JOYSTICK
@@ -187,8 +187,8 @@ static void c_calibrate_keypad_joystick()
     submenu[9][31]  = (char)(MOUSETEXT_BEGIN + 0x15);
     submenu[10][29] = (char)(MOUSETEXT_BEGIN + 0x0a);
 
-    joy_x = HALF_JOY_RANGE;
-    joy_y = HALF_JOY_RANGE;
+    replay_input(REPLAY_INPUT_JOY_X, HALF_JOY_RANGE);
+    replay_input(REPLAY_INPUT_JOY_Y, HALF_JOY_RANGE);
 
     int ch = -1;
     uint8_t x_last=CALIBRATE_JOYMENU_W>>1, y_last=CALIBRATE_JOYMENU_H>>1;
@@ -249,8 +249,8 @@ static void c_calibrate_keypad_joystick()
             joy_auto_recenter = (joy_auto_recenter+1) % 2;
             if (joy_auto_recenter)
             {
-                joy_x = HALF_JOY_RANGE;
-                joy_y = HALF_JOY_RANGE;
+                replay_input(REPLAY_INPUT_JOY_X, HALF_JOY_RANGE);
+                replay_input(REPLAY_INPUT_JOY_Y, HALF_JOY_RANGE);
             }
         }
 
@@ -341,8 +341,8 @@ void joydriver_setClampBeyondRadius(bool clamp) {
 
 void joydriver_setAxisValue(uint8_t x, uint8_t y) {
     clampBeyondRadius(&x, &y);
-    joy_x = x;
-    joy_y = y;
+    replay_input(REPLAY_INPUT_JOY_X, x);
+    replay_input(REPLAY_INPUT_JOY_Y, y);
 }
 
 uint8_t joydriver_getAxisX(void) {
@@ -356,11 +356,11 @@ uint8_t joydriver_getAxisY(void) {
 
 // set button 0 pressed
 void joydriver_setButton0Pressed(bool pressed) {
-    run_args.joy_button0 = (pressed) ? 0x80 : 0x0;
+    replay_input(REPLAY_INPUT_BUTTON0, (pressed) ? 0x80 : 0x0);
 }
 
 // set button 1 pressed
 void joydriver_setButton1Pressed(bool pressed) {
-    run_args.joy_button1 = (pressed) ? 0x80 : 0x0;
+    replay_input(REPLAY_INPUT_BUTTON1, (pressed) ? 0x80 : 0x0);
 }
 
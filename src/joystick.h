@@ -34,8 +34,8 @@ static inline joystick_mode_t getJoyMode(long lVal) {
 
 extern joystick_mode_t joy_mode;
 
-extern uint16_t joy_x;
-extern uint16_t joy_y;
+extern VM_LOCAL uint16_t joy_x;
+extern VM_LOCAL uint16_t joy_y;
 extern bool joy_clip_to_radius;
 
 #ifdef KEYPAD_JOYSTICK
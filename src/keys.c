@@ -15,13 +15,15 @@
 
 #include "common.h"
 
-static int next_key = -1;
-static int last_scancode = -1;
+static VM_LOCAL int next_key = -1;
+static VM_LOCAL int last_scancode = -1;
 static int last_ascii    = -1;
 
 bool caps_lock = true; // default enabled because so much breaks otherwise
 bool use_system_caps_lock = false;
 
+#define REWIND_KEY_SECS 5 // F6
+
 /* ----------------------------------------------------
     //e Keymap. Mapping scancodes to Apple //e US Keyboard
    ---------------------------------------------------- */
@@ -118,7 +120,7 @@ static int apple_iie_keymap_shift_ctrl[MAP_SIZE] =
   -1, -1, -1, -1, -1, -1, -1, kPAUSE,           /* 112-119 */
   -1, -1, -1, -1, -1, -1, -1, -1 };             /* 120-127 */
 
-static char key_pressed[ 256 ] = { 0 };
+static VM_LOCAL char key_pressed[ 256 ] = { 0 };
 
 /* -------------------------------------------------------------------------
     convert ascii character to scancode
@@ -251,10 +253,10 @@ void keys_handleInput(int scancode, bool is_pressed, bool is_ascii) {
             key_pressed[ scancode ] = 1;
             switch (keymap[ scancode ]) {
                 case JB0:
-                    run_args.joy_button0 = 0xff; /* open apple */
+                    replay_input(REPLAY_INPUT_BUTTON0, 0xff); /* open apple */
                     break;
                 case JB1:
-                    run_args.joy_button1 = 0xff; /* closed apple */
+                    replay_input(REPLAY_INPUT_BUTTON1, 0xff); /* closed apple */
                     break;
                 default:
                     next_key = keymap[ scancode ];
@@ -264,10 +266,10 @@ void keys_handleInput(int scancode, bool is_pressed, bool is_ascii) {
             key_pressed[ scancode ] = 0;
             switch (keymap[ scancode ]) {
                 case JB0:
-                    run_args.joy_button0 = 0x00;
+                    replay_input(REPLAY_INPUT_BUTTON0, 0x00);
                     break;
                 case JB1:
-                    run_args.joy_button1 = 0x00;
+                    replay_input(REPLAY_INPUT_BUTTON1, 0x00);
                     break;
                 default:
                     break;
@@ -289,8 +291,7 @@ void keys_handleInput(int scancode, bool is_pressed, bool is_ascii) {
             next_key = -1;
 
             if (current_key < 0x80) {
-                apple_ii_64k[0][0xC000] = current_key | 0x80;
-                apple_ii_64k[1][0xC000] = current_key | 0x80;
+                replay_input(REPLAY_INPUT_KEY, current_key | 0x80);
                 break;
             }
 
@@ -304,6 +305,12 @@ void keys_handleInput(int scancode, bool is_pressed, bool is_ascii) {
                 }
                 break;
             }
+            if (current_key == kF6) {
+                cpu_pause();
+                emulator_rewind(REWIND_KEY_SECS);
+                cpu_resume();
+                break;
+            }
             if (current_key == kF3) {
 
                 double scale = (alt_speed_enabled ? cpu_altscale_factor : cpu_scale_factor);
@@ -373,7 +380,7 @@ void keys_handleInput(int scancode, bool is_pressed, bool is_ascii) {
 
             if (current_key == kEND) {
                 if (key_pressed[ SCODE_L_CTRL ] || key_pressed[ SCODE_R_CTRL ]) {
-                    cpu65_interrupt(ResetSig);
+                    replay_input(REPLAY_INPUT_RESET, 0);
                 }
                 break;
             }
@@ -390,6 +397,9 @@ void keys_handleInput(int scancode, bool is_pressed, bool is_ascii) {
 #ifdef KEYPAD_JOYSTICK
     // Keypad emulated joystick relies on "raw" keyboard input
     if (joy_mode == JOY_KPAD) {
+        uint16_t x = joy_x;
+        uint16_t y = joy_y;
+
         bool joy_x_axis_unpressed = !( key_pressed[SCODE_KPAD_L]  || key_pressed[SCODE_KPAD_R] ||
                                       key_pressed[SCODE_KPAD_UL] || key_pressed[SCODE_KPAD_DL] || key_pressed[SCODE_KPAD_UR] || key_pressed[SCODE_KPAD_DR] ||
                                       // and allow regular PC arrow keys to manipulate joystick...
@@ -399,8 +409,8 @@ void keys_handleInput(int scancode, bool is_pressed, bool is_ascii) {
                                      key_pressed[SCODE_U] || key_pressed[SCODE_D]);
 
         if (key_pressed[ SCODE_KPAD_C ]) {
-            joy_x = HALF_JOY_RANGE;
-            joy_y = HALF_JOY_RANGE;
+            x = HALF_JOY_RANGE;
+            y = HALF_JOY_RANGE;
         }
 
         if (joy_auto_recenter) {
@@ -409,7 +419,7 @@ void keys_handleInput(int scancode, bool is_pressed, bool is_ascii) {
                 ++x_unpressed_count;
                 if (x_unpressed_count > 2) {
                     x_unpressed_count = 0;
-                    joy_x = HALF_JOY_RANGE;
+                    x = HALF_JOY_RANGE;
                 }
             } else {
                 x_unpressed_count = 0;
@@ -419,7 +429,7 @@ void keys_handleInput(int scancode, bool is_pressed, bool is_ascii) {
                 ++y_unpressed_count;
                 if (y_unpressed_count > 2) {
                     y_unpressed_count = 0;
-                    joy_y = HALF_JOY_RANGE;
+                    y = HALF_JOY_RANGE;
                 }
             } else {
                 y_unpressed_count = 0;
@@ -427,36 +437,43 @@ void keys_handleInput(int scancode, bool is_pressed, bool is_ascii) {
         }
 
         if (key_pressed[ SCODE_KPAD_UL ] || key_pressed[ SCODE_KPAD_U ] || key_pressed[ SCODE_KPAD_UR ] ||/* regular arrow up */key_pressed[ SCODE_U ]) {
-            if (joy_y > joy_step) {
-                joy_y -= joy_step;
+            if (y > joy_step) {
+                y -= joy_step;
             } else {
-                joy_y = 0;
+                y = 0;
             }
         }
 
         if (key_pressed[ SCODE_KPAD_DL ] || key_pressed[ SCODE_KPAD_D ] || key_pressed[ SCODE_KPAD_DR ] ||/* regular arrow dn */key_pressed[ SCODE_D ]) {
-            if (joy_y < JOY_RANGE - joy_step) {
-                joy_y += joy_step;
+            if (y < JOY_RANGE - joy_step) {
+                y += joy_step;
             } else {
-                joy_y = JOY_RANGE-1;
+                y = JOY_RANGE-1;
             }
         }
 
         if (key_pressed[ SCODE_KPAD_UL ] || key_pressed[ SCODE_KPAD_L ] || key_pressed[ SCODE_KPAD_DL ] ||/* regular arrow l */key_pressed[ SCODE_L ]) {
-            if (joy_x > joy_step) {
-                joy_x -= joy_step;
+            if (x > joy_step) {
+                x -= joy_step;
             } else {
-                joy_x = 0;
+                x = 0;
             }
         }
 
         if (key_pressed[ SCODE_KPAD_UR ] || key_pressed[ SCODE_KPAD_R ] || key_pressed[ SCODE_KPAD_DR ] ||/* regular arrow r */key_pressed[ SCODE_R ]) {
-            if (joy_x < JOY_RANGE - joy_step) {
-                joy_x += joy_step;
+            if (x < JOY_RANGE - joy_step) {
+                x += joy_step;
             } else {
-                joy_x = JOY_RANGE-1;
+                x = JOY_RANGE-1;
             }
         }
+
+        if (x != joy_x) {
+            replay_input(REPLAY_INPUT_JOY_X, x);
+        }
+        if (y != joy_y) {
+            replay_input(REPLAY_INPUT_JOY_Y, y);
+        }
     }
 #endif
 }
@@ -0,0 +1,112 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+/*
+ * Renders a binary CPU trace (see meta/cputrace.h) as the text CPU trace.
+ *
+ * usage : cputrace_decode [-e] <trace.bin> [trace.txt]
+ *
+ *  -e : include the effective address of each instruction (as with CPU_TRACING_SHOW_EA)
+ */
+
+#include "common.h"
+#include "meta/cputrace.h"
+
+#define RECORDS_PER_READ 4096
+
+static void _usage(const char *argv0) {
+    fprintf(stderr, "usage : %s [-e] <trace.bin> [trace.txt]\n", argv0);
+}
+
+int main(int argc, char **argv) {
+
+    bool showEA = false;
+    int argi = 1;
+    if (argi < argc && strcmp(argv[argi], "-e") == 0) {
+        showEA = true;
+        ++argi;
+    }
+    if (argi >= argc || argc - argi > 2) {
+        _usage(argv[0]);
+        return 1;
+    }
+
+    FILE *in = NULL;
+    FILE *out = stdout;
+    cputrace_record_s *recs = NULL;
+    int ret = 1;
+
+    do {
+        in = fopen(argv[argi], "r");
+        if (!in) {
+            fprintf(stderr, "could not open %s (%s)\n", argv[argi], strerror(errno));
+            break;
+        }
+
+        if (argi + 1 < argc) {
+            out = fopen(argv[argi + 1], "w");
+            if (!out) {
+                fprintf(stderr, "could not open %s (%s)\n", argv[argi + 1], strerror(errno));
+                out = stdout;
+                break;
+            }
+        }
+
+        cputrace_header_s header = { { 0 } };
+        if (fread(&header, sizeof(header), 1, in) != 1) {
+            fprintf(stderr, "%s : short header\n", argv[argi]);
+            break;
+        }
+        if (memcmp(header.magick, CPUTRACE_MAGICK, CPUTRACE_MAGICK_LEN) != 0) {
+            fprintf(stderr, "%s : not a binary CPU trace\n", argv[argi]);
+            break;
+        }
+        if (header.version != CPUTRACE_VERSION || header.recordSize != sizeof(cputrace_record_s)) {
+            fprintf(stderr, "%s : unsupported trace version %u (record size %u)\n", argv[argi], header.version, header.recordSize);
+            break;
+        }
+
+        recs = malloc(RECORDS_PER_READ * sizeof(cputrace_record_s));
+        if (!recs) {
+            fprintf(stderr, "out of memory\n");
+            break;
+        }
+
+        unsigned long cycles = (unsigned long)header.cyclesBase;
+        size_t count = 0;
+        while ((count = fread(recs, sizeof(cputrace_record_s), RECORDS_PER_READ, in)) > 0) {
+            for (size_t i = 0; i < count; i++) {
+                cycles += recs[i].cyclesDelta;
+                cputrace_printRecord(out, &recs[i], cycles, showEA);
+            }
+        }
+        if (ferror(in)) {
+            fprintf(stderr, "%s : read error (%s)\n", argv[argi], strerror(errno));
+            break;
+        }
+
+        ret = 0;
+    } while (0);
+
+    if (recs) {
+        free(recs);
+    }
+    if (in) {
+        fclose(in);
+    }
+    if (out != stdout) {
+        if (fclose(out) != 0) {
+            ret = 1;
+        }
+    }
+
+    return ret;
+}
@@ -0,0 +1,138 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+#include "common.h"
+#include "meta/cputrace.h"
+
+extern const struct opcode_struct_s opcodes_65c02[256];
+
+void cputrace_printRecord(FILE *fp, const cputrace_record_s *rec, unsigned long cycles, bool showEA) {
+
+    if (rec->type == CPUTRACE_IRQ) {
+        fprintf(fp, "IRQ:%02X\n", rec->opcode);
+        return;
+    }
+
+    int8_t arg1 = (int8_t)rec->arg1;
+    int8_t arg2 = (int8_t)rec->arg2;
+    const struct opcode_struct_s *op = &opcodes_65c02[rec->opcode];
+
+    switch (op->mode) {
+        case addr_implied:
+        case addr_accumulator:
+            fprintf(fp, "%04X:%02X    ", rec->pc, rec->opcode);
+            break;
+        case addr_immediate:
+        case addr_zeropage:
+        case addr_zeropage_x:
+        case addr_zeropage_y:
+        case addr_indirect:
+        case addr_indirect_x:
+        case addr_indirect_y:
+        case addr_relative:
+            fprintf(fp, "%04X:%02X%02X  ", rec->pc, rec->opcode, (uint8_t)arg1);
+            break;
+        case addr_absolute:
+        case addr_absolute_x:
+        case addr_absolute_y:
+        case addr_j_indirect:
+        case addr_j_indirect_x:
+            fprintf(fp, "%04X:%02X%02X%02X", rec->pc, rec->opcode, (uint8_t)arg1, (uint8_t)arg2);
+            break;
+        default:
+            fprintf(fp, "invalid opcode mode");
+            break;
+    }
+
+    fprintf(fp, " SP:%02X X:%02X Y:%02X A:%02X", rec->sp, rec->x, rec->y, rec->a);
+
+#define FLAGS_BUFSZ 9
+    char flags_buf[FLAGS_BUFSZ];
+    memset(flags_buf, '-', FLAGS_BUFSZ);
+    if (rec->f & C_Flag_6502) {
+        flags_buf[0]='C';
+    }
+    if (rec->f & X_Flag_6502) {
+        flags_buf[1]='X';
+    }
+    if (rec->f & I_Flag_6502) {
+        flags_buf[2]='I';
+    }
+    if (rec->f & V_Flag_6502) {
+        flags_buf[3]='V';
+    }
+    if (rec->f & B_Flag_6502) {
+        flags_buf[4]='B';
+    }
+    if (rec->f & D_Flag_6502) {
+        flags_buf[5]='D';
+    }
+    if (rec->f & Z_Flag_6502) {
+        flags_buf[6]='Z';
+    }
+    if (rec->f & N_Flag_6502) {
+        flags_buf[7]='N';
+    }
+    flags_buf[8] = '\0';
+
+    char fmt[64];
+    if (UNLIKELY(rec->opcycles >= 10)) {
+        // occurs rarely for interrupt + opcode
+        snprintf(fmt, 64, "%s", " %s CY:%u");
+    } else {
+        snprintf(fmt, 64, "%s", " %s CYC:%u");
+    }
+    fprintf(fp, fmt, flags_buf, rec->opcycles);
+
+    fprintf(fp, " VID:%04X:%02X", rec->vidAddr, rec->vidData);
+
+    if (showEA) {
+        fprintf(fp, " EA:%04X", rec->ea);
+    }
+
+    fprintf(fp, " CY+%lu", (cycles + rec->opcycles));
+
+    sprintf(fmt, " %s %s", op->mnemonic, disasm_templates[op->mode]);
+
+    switch (op->mode) {
+        case addr_implied:
+        case addr_accumulator:
+            fprintf(fp, "%s", fmt);
+            break;
+        case addr_immediate:
+        case addr_zeropage:
+        case addr_zeropage_x:
+        case addr_zeropage_y:
+        case addr_indirect:
+        case addr_indirect_x:
+        case addr_indirect_y:
+            fprintf(fp, fmt, (uint8_t)arg1);
+            break;
+        case addr_absolute:
+        case addr_absolute_x:
+        case addr_absolute_y:
+        case addr_j_indirect:
+        case addr_j_indirect_x:
+            fprintf(fp, fmt, (uint8_t)arg2, (uint8_t)arg1);
+            break;
+        case addr_relative:
+            if (arg1 < 0) {
+                fprintf(fp, fmt, rec->pc + arg1 + 2, '-', (uint8_t)(-arg1));
+            } else {
+                fprintf(fp, fmt, rec->pc + arg1 + 2, '+', (uint8_t)arg1);
+            }
+            break;
+        default:
+            break;
+    }
+
+    fprintf(fp, "%s", "\n");
+}
@@ -0,0 +1,60 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+/*
+ * Binary CPU trace format (CPU_TRACING builds, see cpu65_trace_beginBinary()).
+ *
+ * A cputrace_header_s followed by fixed-size cputrace_record_s, one per executed instruction or taken IRQ, in host
+ * byte order.  The cputrace_decode tool renders a binary trace as the text trace that cpu65_trace_begin() writes.
+ */
+
+#ifndef _CPUTRACE_H_
+#define _CPUTRACE_H_
+
+#define CPUTRACE_MAGICK "A2CT"
+#define CPUTRACE_MAGICK_LEN 4
+#define CPUTRACE_VERSION 1
+
+typedef enum cputrace_type_t {
+    CPUTRACE_OPCODE = 0,
+    CPUTRACE_IRQ,
+} cputrace_type_t;
+
+typedef struct cputrace_header_s {
+    char magick[CPUTRACE_MAGICK_LEN];
+    uint16_t version;
+    uint16_t recordSize;    // sizeof(cputrace_record_s) (also detects a byte order mismatch)
+    uint64_t cyclesBase;    // cycles_count_total when the trace began
+} cputrace_header_s;
+
+typedef struct cputrace_record_s {
+    uint32_t cyclesDelta;   // advance of cycles_count_total since the previous record
+    uint16_t pc;
+    uint16_t ea;
+    uint16_t vidAddr;       // video scanner address and data at the end of the instruction
+    uint8_t vidData;
+    uint8_t type;           // cputrace_type_t
+    uint8_t opcode;         // CPUTRACE_IRQ : pending cpu65__signal
+    uint8_t arg1;
+    uint8_t arg2;
+    uint8_t a;
+    uint8_t x;
+    uint8_t y;
+    uint8_t f;              // 6502 P register
+    uint8_t sp;
+    uint8_t opcycles;
+    uint8_t pad[3];
+} cputrace_record_s;
+
+// Print record as a line of the text trace, cycles is the value of cycles_count_total at the record
+void cputrace_printRecord(FILE *fp, const cputrace_record_s *rec, unsigned long cycles, bool showEA);
+
+#endif /* whole file */
@@ -361,8 +361,8 @@ static void yynoreturn yy_fatal_error (yyconst char* msg  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 64
-#define YY_END_OF_BUFFER 65
+#define YY_NUM_RULES 69
+#define YY_END_OF_BUFFER 70
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -370,53 +370,54 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[411] =
+static yyconst flex_int16_t yy_accept[421] =
     {   0,
-        0,    0,   65,   63,   62,   63,   63,   63,   63,   63,
-       63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
-       63,   63,   63,   63,   63,    0,    0,    0,    0,    0,
-       58,    0,    0,    0,    0,    0,    6,    0,    0,    0,
-        0,    0,    0,    0,    0,   33,    0,    0,    0,    0,
-        0,    0,    0,   39,    0,    0,    0,    0,    0,   16,
-        0,    0,    0,    0,    0,    0,    0,   27,    0,    0,
-       30,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       37,    0,    0,    0,    0,    0,   53,    0,    0,    0,
-        0,    0,    0,    0,    0,   25,    0,    0,    0,    0,
-
-        0,   21,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   28,    0,    0,   55,    0,    0,    0,    0,
-        0,   31,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   70,   68,   67,   68,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,    0,    0,    0,    0,
+        0,   63,    0,    0,    0,    0,    0,    6,    0,    0,
+        0,    0,    0,    0,    0,    0,   33,    0,    0,    0,
+        0,    0,    0,    0,   39,    0,    0,    0,    0,    0,
+       16,    0,    0,    0,    0,    0,    0,    0,   27,    0,
+        0,   30,    0,    0,    0,    0,    0,    0,    0,    0,
+       37,    0,    0,    0,    0,   58,    0,    0,    0,    0,
+        0,    0,    0,    0,   25,    0,    0,    0,    0,    0,
+
+       21,    0,    0,    0,    0,    0,    0,    0,    0,   28,
+        0,   60,    0,    0,    0,    0,    0,   31,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   54,
-        0,    0,    0,    0,    0,    0,    0,   56,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   59,    0,    0,    0,    0,    0,   61,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
        44,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   22,    0,    0,    0,    0,    0,    3,
-
-        0,    0,    0,   34,    0,    0,    0,    0,    0,   40,
-        0,    0,    0,    0,    0,    0,    0,    0,   51,    0,
-        0,    0,    0,   13,    0,    0,    0,    0,    0,    0,
-       29,    0,   38,    0,    0,   60,    0,   26,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   43,    0,
-        0,   32,    0,    0,    5,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   15,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   52,    0,
-        0,    0,    0,    0,   61,    0,    0,    0,   26,    0,
-        0,    0,    0,    0,    0,    0,    1,    0,    0,    0,
-
-        9,    0,    0,   35,    0,    0,    0,    0,   41,    0,
-        0,   11,    0,    0,    0,   19,    0,    0,   57,    0,
+        0,    0,    0,    0,    0,   22,    0,    0,    0,    0,
+        0,    3,    0,    0,    0,   34,    0,    0,    0,    0,
+
+       40,    0,    0,    0,    0,    0,    0,    0,    0,   51,
+        0,    0,    0,    0,   13,    0,    0,    0,    0,    0,
+        0,   29,   38,    0,   65,    0,   26,    0,    0,    0,
+        0,    0,   56,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   43,    0,    0,   32,    0,    0,    5,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   15,    0,    0,    0,    0,    0,    0,
+        0,    0,   53,    0,    0,    0,    0,    0,    0,    0,
+        0,   54,    0,   66,    0,    0,    0,   26,    0,    0,
+        0,    0,    0,    0,    1,    0,    0,    0,    9,    0,
+
+        0,   35,    0,    0,    0,   41,    0,    0,    0,   11,
+        0,    0,    0,   19,    0,   62,    0,    0,    0,   57,
         0,    0,   45,    0,    0,    0,    0,   23,    0,    4,
-        0,    0,    0,    0,    0,    0,    0,    0,   14,    0,
-        0,    0,    0,   50,    0,    0,    0,    0,   47,    0,
-       49,    0,    0,    0,    0,    7,    0,    0,   36,    0,
-        0,   42,    0,    0,    0,    0,   17,   50,    0,    0,
-       49,    0,    2,    0,   10,    0,    0,    0,   12,    0,
-       20,    0,   46,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    8,    0,    0,    0,   18,    0,
-
-       48,    0,    0,    0,   24,    0,    0,    0,   59,    0
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   52,    0,   14,    0,    0,    0,    0,   50,    0,
+        0,    0,    0,    0,   47,    0,   49,    0,    0,    0,
+        0,    7,    0,   36,    0,   42,    0,    0,    0,    0,
+       17,   50,    0,    0,    0,   49,    0,    2,    0,   10,
+        0,    0,    0,   12,    0,   20,    0,    0,   46,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    8,    0,    0,    0,   18,    0,   55,    0,   48,
+        0,    0,   55,    0,   24,    0,    0,    0,   64,    0
     } ;
 
 static yyconst YY_CHAR yy_ec[256] =
@@ -430,11 +431,11 @@ static yyconst YY_CHAR yy_ec[256] =
         1,    1,   13,    1,   14,   15,   16,   17,   18,   19,
        20,   21,   22,    1,   23,   24,   25,   26,   27,   28,
         1,   29,   30,   31,   32,   33,   34,   35,   36,    1,
-        1,    1,    1,    1,    1,    1,   37,   38,   39,   40,
+        1,    1,    1,    1,    1,    1,   14,   15,   16,   17,
 
-       41,   42,   43,   44,   45,    1,   46,   47,   48,   49,
-       50,   51,    1,   52,   53,   54,   55,   56,   57,   58,
-       59,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       18,   19,   20,   21,   22,    1,   23,   24,   25,   26,
+       27,   28,    1,   29,   30,   31,   32,   33,   34,   35,
+       36,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -451,578 +452,1018 @@ static yyconst YY_CHAR yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static yyconst YY_CHAR yy_meta[61] =
+static yyconst YY_CHAR yy_meta[38] =
     {   0,
-        1,    2,    2,    3,    4,    5,    5,    5,    5,    5,
-        5,    6,    1,    7,    7,    7,    7,    7,    7,    1,
-        1,    1,    1,    8,    1,    1,    9,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    7,    7,    7,    7,
-        7,    7,    1,    1,    1,    1,    8,    1,    1,    9,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,   10
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_uint16_t yy_base[454] =
+static yyconst flex_uint16_t yy_base[421] =
     {   0,
-      371,    0,  338, 1976, 1976,   59,   61,  120,  179,  238,
-      297,  356,   64,   66,  415,  474,   71,   98,   37,  292,
-      533,   34,  592,   77,  651,   73,  145,   75,   65,  106,
-     1976,  269,  124,  301,  168,  315, 1976,  364,  305,   68,
-      208,  114,   59,  710,   78, 1976,  769,  370,   97,  828,
-      100,  106,  210, 1976,  424,  410,  220,  450,  458, 1976,
-      478,  115,  231,  887,  123,  512,  280, 1976,  303,  387,
-     1976,  526,  471,  390,  429,  436,  135,  243,  537,  541,
-     1976,  443,  555,  452,  560,  327, 1976,  623,  597,  601,
-      589,  546,  627,  608,  640, 1976,  946,  629,  631,  674,
-
-      657, 1976,  127, 1005,  676,  704,  171,  690,  699,  694,
-      174,  741, 1976,  706,  713, 1976,  723,  187,  746,  727,
-      789, 1976,   96,  737,  163,    0,  198,  819,  801,  212,
-      235,  838,  869,  824,  224,  294,  326,  874,  302,  231,
-      755,  832,  292,  901,  908,  312, 1064,    0,  362,  792,
-      967,  745,  977,  381,  388,  796,  810,  972,  884, 1976,
-      290,  815,  897,  834,  995,  861,  991, 1976,  980,  986,
-      313, 1000,  399, 1008, 1015,  340, 1051, 1059,  371, 1028,
-     1976,  363, 1074, 1133, 1070,  543,  899, 1104, 1128, 1081,
-      384, 1084, 1124, 1976,  272, 1135,  480,  246, 1143, 1976,
-
-      566,  495, 1137, 1976,  426,  476,  453,  475, 1150, 1976,
-      488,  506, 1153, 1173, 1161, 1163,  991,  506, 1976, 1165,
-      514,  225, 1167, 1976,  648, 1232,  661,  940,  565, 1171,
-     1976,    0, 1976,  696, 1184, 1976, 1191, 1976, 1196,  713,
-     1202, 1206,  766,  800, 1198, 1214, 1234, 1217, 1976,  851,
-     1236, 1976,  952, 1238, 1976,    0, 1240, 1276, 1279,  959,
-     1252,  975, 1257,  173, 1056,  168, 1265, 1273, 1976,    0,
-     1299, 1288, 1302, 1304, 1306, 1308, 1264,  565, 1976, 1057,
-     1324, 1312, 1068, 1328, 1976, 1335,  157, 1332, 1976, 1347,
-     1094, 1120, 1226, 1335, 1351, 1353, 1976, 1368,  141, 1374,
-
-     1976, 1355, 1358, 1976,  135, 1367,  127, 1377, 1976, 1379,
-     1383, 1976, 1384,  122, 1394, 1976, 1397, 1399, 1976, 1401,
-     1403, 1406, 1976, 1408, 1414, 1418, 1420, 1976, 1422, 1976,
-        0, 1425, 1428, 1430, 1433, 1438, 1442, 1444, 1976,    0,
-     1447, 1450, 1453, 1460, 1462, 1462,   98, 1468, 1976, 1470,
-     1473, 1487, 1481, 1484, 1492, 1976, 1494, 1498, 1976, 1503,
-     1509, 1976, 1512, 1515, 1519, 1521, 1976, 1976, 1523, 1529,
-     1976, 1532, 1976, 1534, 1976, 1533, 1536, 1543, 1976, 1546,
-     1976, 1551, 1976, 1553, 1557, 1560, 1559,   81, 1571,   67,
-     1582, 1565, 1568, 1571, 1976,    0,    0, 1585, 1976, 1587,
-
-     1976, 1593, 1595, 1597, 1976, 1599, 1602, 1605, 1976, 1976,
-     1665, 1674, 1681, 1687, 1696, 1705, 1714, 1723, 1732, 1741,
-     1747, 1753, 1759, 1765, 1774, 1783, 1792, 1798, 1804, 1810,
-     1819, 1825, 1832, 1835, 1838, 1845, 1854, 1861, 1870, 1880,
-     1890, 1899, 1908, 1914, 1920, 1926, 1932, 1938, 1947, 1956,
-     1959, 1962, 1968
+        0,   38,    1, 4048, 4048,   76,   96,  101,  134,  166,
+      198,  230,  255,  261,  268,  273,  278,  304,   77,   97,
+      314,  309,  124,  326,  186,  353,  318,  385,  405,  106,
+      373, 4048,  425,  457,  480,  218,  484, 4048,  516,  548,
+      580,  451,  250,  102,  608,  114, 4048,  630,  662,  694,
+      714,  127,   89,  509, 4048,  750,  576,  354,  770,  658,
+     4048,  777,  809,  380,  829,  835,  840,  846, 4048,  878,
+      612, 4048,  898,  618,  902,  648,  914,  918,  928,  745,
+     4048,  690,  950,  793,  345, 4048,  975,  971,  485,  964,
+     1007, 1000,  734, 1027, 4048, 1036,  129,  797, 1040, 1045,
+
+     4048,  132, 1065, 1069,  139,  960, 1088, 1096, 1107, 4048,
+     1101, 4048, 1139, 1159, 1114, 1134, 1163, 4048, 1195,  283,
+     1219,  371, 1239,  445,  489, 1170, 1263, 1287,  229,  539,
+      187, 1307, 1313,  159, 1345, 1357,  221, 1369, 1373,  625,
+     1383, 1415,  507, 1435, 1459,  561, 1479,  781,  491, 1183,
+     1486, 1390, 4048,  170, 1490, 1215, 1505, 1497, 4048, 1522,
+     1543,  162, 1283,  537, 1555, 1510, 1576, 1581, 1585, 1602,
+     4048,  135, 1607,  301, 1640, 1660, 1119, 1319,  778, 1614,
+     1665, 1670,  313, 1703, 1634, 4048,  253, 1727,  733,  219,
+     1751, 4048, 1775,  956, 1688, 4048,  308, 1795,  333,  368,
+
+     4048,  461, 1815, 1835, 1839, 1843, 1771, 1849, 1871, 4048,
+     1888,  847,  269, 1912, 4048,  616, 1932, 1965, 1323,  324,
+     1856, 4048, 4048,  802, 4048, 1940, 4048, 1985, 1989, 1953,
+     2002, 2008, 4048, 1957,  862, 2040, 2064,  871,  899, 2015,
+     2031, 2084, 4048, 1059, 2089, 4048, 2093, 2113, 4048, 2122,
+     2117, 2149, 2169,  927, 2193, 1221, 2217,  196, 1259,  358,
+     2241,  262, 2144, 4048, 2265, 2285, 2305, 2261, 2325, 2329,
+     2334, 2351, 4048,  942, 2375, 2361, 2413, 2370, 2451, 2455,
+     2459, 4048, 2491, 4048, 1050,  450, 2466, 4048, 2504, 2529,
+     2549, 2587, 2611, 2472, 4048, 1182,  490, 2635, 4048, 2673,
+
+     2480, 4048,  381, 2711,  398, 4048, 2749, 2781, 2487, 4048,
+     1332,  505, 2805, 4048, 2631, 4048, 2843,  336, 2756, 4048,
+     1377, 2764, 4048,  998, 2881, 2919, 2769, 4048, 2957, 4048,
+     2981, 3001, 3021, 3059, 2977, 3097, 3135, 3139, 3144, 3148,
+     3152, 4048, 3190, 4048, 3214, 3234, 3254, 3158, 3292,  549,
+     3330, 1411,  515, 3165, 4048, 3210, 3350, 3388, 3408, 3432,
+     3428, 4048, 1455, 4048, 1595, 4048, 3464, 3484, 3508, 3452,
+     4048, 4048, 1623, 3532, 1680, 4048, 3459, 4048, 3556, 4048,
+     1078, 1311, 3552, 4048, 3588, 4048, 3626, 3576, 4048, 3664,
+     3684, 3704, 1687,  547, 1877,  629, 3728, 3748, 3786, 3824,
+
+     3580, 4048, 3848, 3868, 3584, 4048, 3724, 3888, 3844, 4048,
+     3926, 3950, 4048, 3946, 4048, 3970, 3990, 4010, 4048, 4048
     } ;
 
-static yyconst flex_int16_t yy_def[454] =
+static yyconst flex_int16_t yy_def[421] =
     {   0,
-      411,  410,  410,  410,  410,  412,  410,  412,  410,  410,
-      412,   11,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  412,  413,  410,  410,
-      410,  414,    8,  410,  410,  410,  410,  415,   27,   39,
-      410,  410,  410,  410,  410,  410,  410,   27,   48,  410,
-      410,  410,  410,  410,  416,  410,  410,  410,  410,  410,
-      410,   27,  410,  410,   64,  410,  410,  410,  417,  410,
-      410,  410,  410,  410,  418,  410,   15,   15,  410,  410,
-      410,  410,  410,  410,  410,  410,  410,  414,  410,  410,
-      410,  419,  410,  410,  410,  410,  410,  410,  410,  410,
-
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-       23,  410,  410,  410,  410,  410,  420,   25,  410,  410,
-      410,  410,  413,  413,  410,  421,  410,   88,  410,  410,
-      410,  410,  415,  133,  410,  410,  410,  410,   44,  410,
-      422,  422,  410,  410,  410,  410,  410,  423,  410,  424,
-      424,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  410,  410,  417,  418,
-      410,  410,  410,  419,  410,   97,  410,  410,   97,  410,
-      410,  410,  425,  410,  410,  410,  410,  410,  410,  410,
-      410,  420,  410,  410,  410,  421,  410,  410,  426,  410,
-
-      427,  410,  410,  410,  410,  428,  410,  410,  422,  410,
-      410,  429,  410,  410,  410,  410,  147,  147,  410,  423,
-      410,  410,  430,  410,  410,  410,  431,  410,  410,  410,
-      410,  170,  410,  410,  410,  410,  410,  410,  410,  410,
-      425,  432,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  433,  410,  410,  434,  410,  426,  426,  410,
-      427,  410,  428,  410,  410,  410,  429,  410,  410,  435,
-      430,  271,  410,  410,  410,  410,  226,  226,  410,  410,
-      431,  410,  436,  410,  410,  410,  410,  410,  410,  432,
-      437,  438,  433,  433,  434,  410,  410,  410,  410,  439,
-
-      410,  440,  410,  410,  410,  441,  410,  429,  410,  435,
-      410,  410,  410,  410,  442,  410,  410,  410,  410,  436,
-      410,  410,  410,  410,  437,  438,  410,  410,  443,  410,
-      444,  439,  332,  440,  410,  441,  410,  445,  410,  446,
-      442,  341,  410,  436,  447,  410,  410,  410,  410,  410,
-      438,  443,  352,  444,  410,  410,  410,  410,  410,  410,
-      410,  410,  445,  363,  446,  410,  410,  410,  447,  410,
-      410,  410,  410,  448,  410,  410,  410,  410,  410,  449,
-      410,  410,  410,  450,  448,  385,  410,  410,  410,  410,
-      449,  391,  450,  410,  410,  451,  452,  410,  410,  410,
-
-      410,  451,  452,  410,  410,  453,  453,  410,  410,    0,
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,    0
     } ;
 
-static yyconst flex_uint16_t yy_nxt[2037] =
-    {   0,
-        4,    4,    5,    4,    4,    6,    6,    6,    6,    6,
-        6,    4,    7,    8,    9,   10,   11,    6,   12,   13,
-       14,   15,    4,   16,   17,   18,   19,    4,   20,   21,
-       22,   23,   24,   25,    4,    4,    8,    9,   10,   11,
-        6,   12,   13,   14,   15,    4,   16,   17,   18,   19,
-        4,   20,   21,   22,   23,   24,   25,    4,    4,    4,
-       26,   26,   30,   30,   97,   69,   69,   30,   30,  107,
-       28,  397,   88,   88,   26,   26,  123,  123,  114,  114,
-      125,   39,   29,   72,   28,  396,  136,   97,   89,   73,
-       70,  140,  107,   74,   90,   91,   29,  123,  123,   92,
-
-       92,  115,  370,  125,   39,   29,   72,   30,   30,  136,
-       48,   89,   73,   70,  140,   93,   74,   90,   91,   29,
-       31,   32,   32,   71,  115,   31,  340,  146,   94,  125,
-       37,   28,   95,   48,  337,   33,  116,  147,   93,   27,
-      135,   34,  335,   35,  161,  331,   26,   26,  410,   36,
-      146,   94,  125,  410,  410,   95,   28,   96,   33,  182,
-      147,  321,   27,  135,   34,   31,   35,  161,   29,  195,
-      195,  410,   36,  307,  130,  130,  410,  410,  305,   37,
-       38,   38,  182,  131,   27,   27,   27,   27,   27,   27,
-       28,   29,   39,   27,   27,   27,   40,   27,  191,  410,
-
-      410,   41,   42,  197,  198,   43,  131,   44,   45,  134,
-      134,  142,  142,  201,  201,   39,   27,   27,   27,   40,
-       27,  191,  410,  410,   41,   42,  154,  154,   43,  270,
-       44,   45,  162,  162,   43,  155,   51,  205,   46,   47,
-       47,  202,  202,   27,   27,   27,   27,   27,   27,   28,
-      256,   48,   27,   27,   27,   49,   27,   43,  155,   51,
-      205,   50,  410,  208,   51,   52,   53,   46,  410,   54,
-       32,   32,  126,  127,   48,   27,   27,   27,   49,   27,
-       28,  162,  162,  253,   50,  410,  208,   51,   52,   53,
-       68,  410,   35,   98,   98,  206,  206,   54,   55,   55,
-
-       63,  211,   88,   88,   69,   69,   38,   38,   28,   99,
-      229,  100,  410,  212,  212,   35,   88,   88,   56,  410,
-       57,  101,  129,   63,   90,   58,   59,   41,   37,  234,
-      132,   43,   99,  229,  100,  207,   34,  410,   90,   68,
-      171,   56,  410,   57,  101,  129,  172,   90,   58,   59,
-       41,  102,  234,  132,   43,  410,   60,   61,   61,   34,
-       37,   90,   71,  171,   46,   38,   38,  221,  222,  172,
-       62,   47,   47,    5,   37,   28,   63,   64,  410,   29,
-      239,   65,  227,  227,   66,   67,  410,   29,   69,   69,
-       43,   30,   30,   62,  228,  228,   51,  410,   53,   63,
-
-       64,  250,   29,  239,   65,  130,  130,   66,   67,  410,
-       29,  151,  151,   43,  410,   68,   75,   75,  410,   51,
-      410,   53,  410,   46,  250,   55,   55,  148,  149,   54,
-       75,   75,   76,  152,   77,   28,  410,   75,   75,  153,
-       78,   79,  262,   80,   82,   82,   71,   57,  410,   31,
-      410,  156,  156,   82,   82,   76,  152,   77,  410,  151,
-      151,  410,  153,   78,   79,  262,   80,  157,  264,   60,
-       57,  158,   30,   30,   81,   82,   82,  206,  206,   61,
-       61,  152,  159,   60,  256,  198,  198,   83,   81,   28,
-      157,  264,  265,   84,  158,   81,  201,  201,   74,   85,
-
-       86,   29,   87,  266,  152,  159,  253,  212,  212,  160,
-       83,   87,  410,  164,  164,  265,   84,   60,  270,  222,
-      222,   74,   85,   86,   29,  410,  266,   30,   30,  165,
-       31,  410,  166,   87,   92,   92,  410,   68,   75,   75,
-      410,  167,   75,   75,  242,  242,  103,   92,   92,   73,
-      104,  410,  165,   74,   76,  166,   82,   82,   76,  410,
-      105,   82,   82,  106,  167,   80,  187,  201,  201,  103,
-      260,  168,   73,  104,   84,  410,   74,   76,  282,   84,
-       85,   76,  410,  105,  410,   31,  106,  410,   80,  187,
-       88,   88,   96,  108,  108,  410,   81,   84,   88,   88,
-
-       81,  282,   84,   85,  410,   96,  410,  130,  130,   92,
-       92,  410,   90,  109,   87,  110,  173,  111,  410,   87,
-       90,   91,  112,  410,   88,   88,  126,  127,   92,   92,
-       98,   98,   98,   98,  410,   90,  109,  410,  110,  173,
-      111,   92,   92,   90,   91,  112,   90,  410,   37,  410,
-      100,  113,  117,  117,  154,  154,   37,   94,   98,   98,
-      101,   95,  227,  227,  118,  280,  119,   96,  410,   90,
-       94,  120,  410,  100,  410,   98,   98,   92,   92,  410,
-       94,  121,   37,  101,   95,  410,   96,  118,  102,  119,
-      102,  108,  108,   94,  120,  108,  108,  283,  283,   96,
-
-      108,  108,  410,  101,  121,   92,   92,  114,  114,  410,
-      122,  134,  134,  410,  114,  114,  102,  189,  286,  287,
-      137,  190,  110,  138,  117,  117,  101,  139,  117,  117,
-      410,  105,   41,  102,  410,   96,   43,  410,  193,  193,
-      189,  410,  108,  108,  190,  110,  138,  117,  117,  113,
-      139,  154,  154,  113,  105,   41,  209,  209,  113,   43,
-      225,  410,  109,   96,  110,  116,  120,  291,  291,   46,
-       47,   47,  116,  410,  141,  141,  141,  141,  141,  141,
-       28,  410,  122,  225,  410,  109,  122,  110,  410,  120,
-      117,  117,   29,  223,  223,   51,  194,  156,  156,  410,
-
-      113,  410,   88,   88,  119,  122,  243,  243,  410,  120,
-      410,  156,  156,  410,  210,   29,  162,  162,   51,  410,
-      199,  199,  410,  410,   90,  134,  134,  119,   54,  142,
-      142,  410,  120,  142,  142,  164,  164,  410,  143,   88,
-       88,  144,  410,  125,  410,  145,  410,   90,  122,  410,
-       43,  224,  292,  292,   51,  160,   53,  410,   51,   34,
-       37,   90,  164,  164,  144,  410,  125,  410,  145,  160,
-      203,  203,  410,   43,   68,  134,  134,   51,  200,   53,
-      410,   51,   34,   46,   90,  156,  156,   54,  162,  162,
-      410,   54,  410,  168,  410,  410,   41,   37,  162,  162,
-
-       43,  157,  142,  142,  410,  243,  243,   63,  163,  142,
-      142,  410,   65,  410,  244,  410,   67,   63,  410,   41,
-      168,  144,  410,   43,  157,  410,   67,   51,  204,   53,
-       63,  163,  410,   46,   51,   65,   53,  244,  410,   67,
-       63,  227,  227,  160,  144,  410,   68,  175,  175,   67,
-       51,  253,   53,  293,  293,  410,   68,   51,  410,   53,
-       54,  176,  177,  178,  298,  299,  410,   54,  151,  151,
-      148,  149,  179,  156,  156,  180,  302,  302,  151,  151,
-      410,  230,  230,  410,  176,  177,  178,  232,  232,  157,
-      152,  410,  164,  164,  410,  179,  164,  164,  180,  226,
-
-      152,  235,  235,  410,  159,  181,  183,  183,  410,  237,
-      237,  166,  157,  152,  410,  166,  175,  175,  184,  410,
-      185,  410,  226,  152,  167,  186,   60,  159,  187,  175,
-      175,  160,  105,  188,  166,  410,   60,  410,  166,  231,
-      410,  184,  410,  185,  410,  233,  410,  167,  186,  410,
-      168,  187,  175,  175,  168,  105,  188,  306,  306,  236,
-      175,  175,  313,  314,   96,  213,  213,  238,  178,  283,
-      283,  242,  242,  410,  181,  183,  183,  214,  240,  215,
-      180,  216,   92,   92,  410,  251,  251,  181,  180,  410,
-      186,  178,  217,  187,  218,  291,  291,  187,  324,  410,
-
-      214,  410,  215,  180,  216,  242,  242,  410,  105,  410,
-      181,  180,  410,  186,  410,  217,  187,  218,  181,  185,
-      187,  292,  292,  219,  186,  193,  193,  187,  410,  245,
-      245,  105,  410,   96,  242,  242,  254,  254,  203,  203,
-       96,  410,  185,  252,  257,  257,  258,  186,  185,  410,
-      187,  209,  209,  186,  213,  213,  187,  246,  247,  248,
-      410,  188,  213,  213,  213,  213,  268,  268,  223,  223,
-      271,  185,  230,  230,  213,  213,  186,  410,  216,  187,
-      246,  247,  248,  194,  188,  235,  235,  249,  215,  410,
-      216,  410,  237,  237,  255,  410,  204,  284,  284,  245,
-
-      245,  216,  200,  288,  288,  410,  410,  242,  242,  210,
-      240,  215,  219,  216,  410,  245,  245,  410,  245,  245,
-      219,  410,  219,  410,  269,  410,  224,  293,  293,  187,
-      231,  410,  219,  273,  273,  245,  245,  251,  251,  254,
-      254,  257,  257,  236,  410,  274,  246,  275,  410,  276,
-      238,  410,  187,  300,  300,  285,  410,  249,  303,  303,
-      277,  289,  278,  246,  410,  248,  308,  308,  274,  246,
-      275,  410,  276,  249,  268,  268,  249,  410,  410,  258,
-      296,  296,  410,  277,  410,  278,  246,  410,  248,  311,
-      311,  279,  410,  249,  410,  252,  410,  255,  410,  200,
-
-      410,  410,  410,  273,  273,  273,  273,  273,  273,  273,
-      273,  301,  410,  317,  317,  410,  304,  410,  318,  275,
-      410,  276,  410,  276,  309,  315,  315,  410,  410,  284,
-      284,  410,  269,  288,  288,  410,  327,  327,  297,  321,
-      287,  287,  275,  410,  276,  410,  276,  312,  322,  322,
-      410,  410,  329,  329,  296,  296,  302,  302,  410,  303,
-      303,  279,  410,  279,  410,  279,  410,  279,  306,  306,
-      410,  319,  331,  299,  299,  300,  300,  332,  308,  308,
-      338,  338,  410,  316,  311,  311,  410,  285,  340,  314,
-      314,  289,  410,  410,  328,  315,  315,  341,  317,  317,
-
-      317,  317,  343,  343,  345,  345,  323,  322,  322,  410,
-      330,  410,  297,  346,  347,  348,  348,  304,  410,  350,
-      350,  327,  327,  329,  329,  352,  410,  410,  410,  355,
-      355,  357,  357,  301,  358,  358,  309,  410,  339,  360,
-      360,  410,  312,  361,  361,  338,  338,  363,  410,  410,
-      410,  366,  366,  316,  343,  343,  319,  410,  319,  410,
-      344,  343,  343,  345,  345,  323,  370,  347,  347,  348,
-      348,  350,  350,  349,  350,  350,  410,  351,  410,  328,
-      410,  330,  372,  372,  410,  374,  374,  356,  410,  410,
-      410,  410,  359,  355,  355,  357,  357,  410,  376,  358,
-
-      358,  362,  410,  339,  360,  360,  410,  377,  410,  367,
-      361,  361,  368,  410,  410,  410,  378,  378,  410,  344,
-      380,  380,  366,  366,  382,  382,  410,  349,  410,  371,
-      384,  384,  351,  372,  372,  374,  374,  385,  387,  388,
-      373,  389,  390,  375,  378,  378,  410,  380,  380,  391,
-      410,  356,  382,  382,  384,  384,  410,  359,  410,  410,
-      410,  394,  394,  396,  388,  388,  398,  398,  362,  400,
-      400,  410,  394,  394,  379,  397,  390,  390,  381,  410,
-      367,  410,  383,  410,  410,  410,  398,  398,  400,  400,
-      410,  373,  410,  375,  404,  404,  406,  406,  404,  404,
-
-      406,  406,  379,  408,  408,  381,  408,  408,  410,  410,
-      383,  410,  410,  410,  410,  410,  410,  410,  410,  395,
-      410,  410,  410,  410,  399,  410,  410,  401,  410,  410,
-      395,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  399,  410,  401,  410,  410,  410,
-      410,  410,  405,  410,  410,  410,  405,  410,  410,  410,
-      410,  409,  410,  410,  409,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,   27,  410,  410,   27,   27,
-       27,   27,  124,  410,  410,  124,  410,  124,  128,  128,
-      128,  128,  128,  128,  128,  410,  128,  133,  410,  410,
-
-      133,  133,  133,  133,  133,  133,  150,  150,  150,  150,
-      150,  150,  150,  410,  150,  169,  410,  410,  169,  410,
-      169,  410,  410,  169,  170,  410,  410,  170,  410,  410,
-      410,  410,  170,  174,  410,  410,  174,  410,  174,  410,
-      410,  174,  192,  410,  410,  192,  410,  192,  410,  410,
-      192,  196,  410,  196,  141,  410,  410,  141,  410,  410,
-      410,  410,  141,  220,  410,  220,  150,  410,  410,  150,
-      410,  150,  410,  410,  150,  241,  410,  241,  241,  410,
-      241,  241,  410,  241,  259,  259,  410,  259,  410,  259,
-      410,  410,  259,  261,  410,  261,  261,  410,  261,  263,
-
-      410,  410,  263,  410,  263,  267,  410,  410,  267,  410,
-      267,  272,  272,  410,  272,  410,  272,  410,  410,  272,
-      281,  410,  281,  281,  410,  281,  290,  410,  290,  290,
-      410,  290,  290,  294,  410,  410,  294,  410,  294,  295,
-      410,  295,  310,  410,  310,  320,  320,  320,  320,  320,
-      320,  320,  320,  320,  320,  325,  410,  325,  325,  410,
-      325,  326,  326,  326,  326,  326,  326,  326,  326,  326,
-      326,  333,  333,  410,  333,  410,  333,  410,  410,  333,
+static yyconst flex_uint16_t yy_nxt[4086] =
+    {   3,
+        4,    4,    5,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    3,    4,    4,
+        5,    4,    4,    6,    6,    6,    6,    6,    6,    4,
+        7,    8,    9,   10,   11,    6,   12,   13,   14,   15,
+        4,   16,   17,   18,   19,   20,   21,   22,   23,   24,
+       25,   26,    4,    4,    4,    3,    3,   27,   27,    0,
+        0,   28,   28,   28,   28,   28,   28,   29,    3,   28,
+       28,   28,   28,   28,   28,    3,    3,   31,   31,   30,
+
+        3,    3,   33,   33,   96,    3,   28,   28,   28,   28,
+       28,   28,   29,    3,   28,   28,   34,   28,   28,   28,
+      141,  120,   35,    3,   36,   97,    3,  134,    3,  130,
+       37,    3,   32,    3,    3,   39,   39,   38,    3,   28,
+       28,   28,   28,   28,   28,   29,    0,   40,   28,   28,
+       28,   41,   28,  228,  140,  172,   42,   43,    3,  105,
+       44,    3,   45,   46,  174,    3,  183,   48,   48,    3,
+       47,   28,   28,   28,   28,   28,   28,   29,  224,   49,
+       28,   28,   28,   50,   28,    3,    3,  111,  111,   51,
+      220,  200,   52,   53,   54,    3,  199,    3,    0,   56,
+
+       56,  303,   55,   28,   28,   28,   28,   28,   28,   29,
+      111,   28,   28,   28,   28,   28,   28,    3,    3,   57,
+        3,   58,  112,  250,  124,  124,   59,   60,    3,    3,
+      202,   62,   62,  125,   61,   28,   28,   28,   28,   28,
+       28,   29,  197,   28,   63,   28,   28,   28,   28,    3,
+       64,   65,    3,   30,    3,   66,   70,   70,   67,   68,
+        3,    3,   31,   31,  247,  120,   69,    3,    3,   75,
+       75,    0,    3,  265,   82,   82,  129,    3,   73,   87,
+       87,   71,    3,  307,   74,   76,   83,   77,   31,  187,
+      187,   72,   82,   78,   79,   88,   80,   32,   84,   85,
+
+        3,   89,   90,    3,   81,   91,   91,    3,    3,   86,
+       91,   91,    3,    3,   38,   98,   98,    3,  234,   27,
+       27,   92,  102,    3,  256,    3,  103,  106,  106,   29,
+      244,   99,    3,  100,   93,    3,   93,  276,   94,  104,
+       95,   30,    0,   98,    3,   95,    0,  107,  258,  106,
+      101,  108,    3,    3,  113,  113,  109,    3,  162,    0,
+      148,  148,  110,  305,  163,    0,  114,    3,  115,  149,
+        3,  350,    3,  116,   31,   31,  189,  190,    0,    3,
+        3,   64,   64,  117,    3,  259,   27,   27,  335,  118,
+       28,   28,   28,   28,   28,   28,   29,    3,   28,   28,
+
+       28,   28,   28,   28,    3,  337,   29,   29,   30,   32,
+      119,  119,  119,  119,  119,  119,   69,    0,  119,  119,
+      119,  119,  119,  119,    3,    0,   33,   33,  121,  122,
+      123,  123,  123,  123,  123,  123,   29,    0,  123,  123,
+      123,  123,  123,  123,    3,    0,  193,  193,   36,    3,
+        3,    0,  128,  128,  321,    0,    3,    0,   33,   33,
+        3,   38,   28,   28,   28,   28,   28,   28,   29,    0,
+       28,   28,   28,   28,   28,   28,  260,   44,   35,    3,
+       36,   87,   87,    3,    3,   87,   87,   47,    3,    3,
+        3,  124,  124,   38,  331,  194,  194,  219,  219,  126,
+
+      164,   90,    0,   89,    3,   35,    3,   89,    3,  345,
+      136,  136,  212,  213,    3,    3,   38,   39,   39,  375,
+       38,  127,  127,  127,  127,  127,  127,   29,    0,  127,
+      127,  127,  127,  127,  127,   52,    3,    0,    3,   30,
+      198,  198,   44,  124,  124,   55,    3,    3,    3,   39,
+       39,  403,   47,   28,   28,   28,   28,   28,   28,   29,
+        3,   28,   28,   28,   28,   28,   28,  148,  148,    0,
+       42,   30,    0,  373,   44,    3,  216,  145,  145,    3,
+        0,   39,   39,    0,   47,   28,   28,   28,   28,   28,
+       28,   29,    0,   40,   28,   28,   28,   28,   28,  146,
+
+        0,    0,   42,   30,    0,  147,   44,    3,    0,  128,
+      128,    3,   61,   70,   70,    3,   47,    3,  131,   31,
+       31,  132,  148,  148,    3,  133,  203,  203,    3,    3,
+       42,   48,   48,  404,   44,  135,  135,  135,  135,  135,
+      135,   29,    0,    0,   47,   31,    0,    3,   72,   75,
+       75,    0,    0,   30,   32,    0,   52,    3,    0,  145,
+      145,    3,    0,   48,   48,    0,   55,   28,   28,   28,
+       28,   28,   28,   29,    0,   28,   28,   28,   28,   28,
+       28,  146,    0,    0,   81,   30,    0,    0,   52,    3,
+       54,   82,   82,    3,   61,   48,   48,    0,   55,   28,
+
+       28,   28,   28,   28,   28,   29,    0,   49,   28,   28,
+       28,   28,   28,    3,    0,  136,  136,   30,    0,    0,
+       52,    0,   54,    0,  137,    0,   86,  138,    0,  120,
+       55,  139,    3,    3,    0,   91,   91,  250,  190,  190,
+       52,    0,   54,    0,    3,    0,   75,   75,    0,    3,
+       55,   56,   56,  142,  143,  144,  144,  144,  144,  144,
+      144,   29,   76,  144,  144,  144,  144,  144,  144,    3,
+       95,  150,  150,   58,    0,    0,    3,    3,   62,   62,
+        3,   81,  218,  218,  238,  238,   61,  150,   29,    0,
+        0,  151,    3,  239,   82,   82,    3,    0,   98,   98,
+
+       30,    3,  152,  277,  277,    0,  153,    0,    3,    0,
+       27,   27,   82,   69,   28,   28,   28,   28,   28,   28,
+       29,    0,   28,   28,   28,   28,   28,   28,    3,   86,
+       64,   64,   30,  101,    3,    0,   64,   64,  154,    3,
+        0,  156,  156,    0,    0,    3,    3,   64,   64,   64,
+      155,  265,  213,  213,   66,   64,  155,  157,   68,    0,
+      156,    3,    0,    0,   68,   69,   64,  285,  286,  158,
+        3,   69,  290,  290,    0,    0,  159,    3,    0,   70,
+       70,    0,   69,  160,  160,  160,  160,  160,  160,    0,
+        0,  160,  160,  160,  160,  160,  160,    3,    3,   31,
+
+       31,    3,    0,   75,   75,  238,  238,  161,  161,  161,
+      161,  161,  161,    3,   72,   75,   75,    3,    0,   75,
+       75,   74,    0,    0,    0,   31,    3,    3,    0,   75,
+       75,   76,  296,  297,   32,   76,    0,    0,   81,   78,
+       79,    3,   80,    0,   79,   76,   80,  311,  312,    3,
+       81,   82,   82,    0,   81,    3,   80,  193,  193,    3,
+        0,  106,  106,    3,   81,   87,   87,  247,    0,   82,
+        3,    0,   87,   87,    3,   84,   87,   87,  121,  122,
+      123,  123,  123,  123,  123,  123,   86,   89,  123,  123,
+      123,  123,  123,  123,   89,   90,  110,    3,   89,    3,
+
+       38,   91,   91,  352,  353,    0,    3,   38,   91,   91,
+        0,   38,  165,  165,  165,  165,  165,  165,    0,    0,
+      165,  165,  165,  165,  165,  165,    3,    0,   91,   91,
+       93,    0,    0,    0,   94,    3,   95,  166,  166,    3,
+        0,   98,   98,   95,    3,    0,   98,   98,    0,    3,
+        0,  167,  168,  169,  321,  286,  286,   93,    3,  100,
+      291,  291,  170,   95,    3,  166,  175,  175,    3,   98,
+       91,   91,  171,  173,   98,    0,  101,    3,  176,    0,
+      177,  101,  181,  393,  394,  178,  182,    3,  179,  106,
+      106,    0,   93,  180,    0,    3,   93,  106,  106,    0,
+
+        3,   95,  111,  111,    0,   95,    3,    0,  106,  106,
+        0,  106,    0,    3,    0,  113,  113,  107,    3,  106,
+      237,  237,    0,    0,  110,    0,  109,    0,  107,    0,
+      106,    0,  110,    3,  116,  113,  113,  112,    3,  178,
+      113,  113,  179,  110,  184,  184,  184,  184,  184,  184,
+      118,    0,  184,  184,  184,  184,  184,  184,    3,    0,
+      113,  113,    3,    0,  113,  113,    0,    0,    0,    3,
+      118,   87,   87,    0,  115,  118,    0,    0,  115,  116,
+        0,    3,    3,  116,  150,  150,  331,  297,  297,  117,
+        0,   35,    0,   89,    3,  118,  185,  185,    0,  118,
+
+      119,  119,  119,  119,  119,  119,   38,    0,  119,  119,
+      119,  119,  119,  119,    3,    0,  156,  156,    3,  153,
+        3,    0,  300,  300,  188,  188,  188,  188,  188,  188,
+        0,  186,  188,  188,  188,  188,  188,  188,    3,    0,
+      191,  191,    0,    0,  123,  123,  123,  123,  123,  123,
+        0,  159,  123,  123,  123,  123,  123,  123,    3,    0,
+      304,  304,    3,    0,  195,  195,    0,    0,  127,  127,
+      127,  127,  127,  127,    0,  192,  127,  127,  127,  127,
+      127,  127,    3,    0,  163,  163,    3,    0,  128,  128,
+        0,    0,  127,  127,  127,  127,  127,  127,    0,  196,
+
+      127,  127,  127,  127,  127,  127,    3,    0,  128,  128,
+        3,    0,    3,   44,  128,  128,  395,  396,    3,  225,
+      237,  237,    3,   47,  218,  218,  132,    0,    0,   42,
+        0,    3,    0,   44,  247,   42,  345,  312,  312,   44,
+        0,    0,  179,   47,    3,    0,  135,  135,    0,   47,
+      135,  135,  135,  135,  135,  135,    3,    0,  136,  136,
+        0,    0,  135,  135,  135,  135,  135,  135,    3,    0,
+      136,  136,    3,    0,  136,  136,    3,    0,  351,  351,
+        0,  201,    3,   52,  204,  204,  138,    0,    0,    3,
+        0,  150,  150,   55,    0,   52,  205,   54,  206,   52,
+
+      207,   54,    0,    0,    0,   55,    0,  150,    0,   55,
+        3,  208,    0,  209,    3,  375,  353,  353,    0,  210,
+      211,  211,  211,  211,  211,  211,  153,    0,  211,  211,
+      211,  211,  211,  211,    3,    0,  214,  214,    0,    0,
+      144,  144,  144,  144,  144,  144,    0,    0,  144,  144,
+      144,  144,  144,  144,    3,    0,  363,  363,    3,  381,
+      145,  145,  142,  143,  144,  144,  144,  144,  144,  144,
+        0,  215,  144,  144,  144,  144,  144,  144,    3,    0,
+      145,  145,  146,    0,    0,    3,    0,  150,  150,    3,
+        0,   64,   64,    0,    0,   61,    3,    0,  156,  156,
+
+        0,  217,  146,  150,    3,    0,  156,  156,    0,    3,
+       64,  166,  166,    0,    0,   61,    0,  156,  152,   68,
+        0,    3,  153,  221,  221,  156,   69,  160,  160,  160,
+      160,  160,  160,  159,  158,  160,  160,  160,  160,  160,
+      160,  159,    3,    0,  161,  161,  171,    0,  161,  161,
+      161,  161,  161,  161,    3,    0,  226,  226,  222,    0,
+      165,  165,  165,  165,  165,  165,    0,    0,  165,  165,
+      165,  165,  165,  165,    0,    3,    0,  166,  166,  223,
+        3,    0,  166,  166,    3,    0,  166,  166,    0,    0,
+        0,  227,  168,  169,    3,    0,  365,  365,  169,  382,
+
+        0,    3,  170,  166,  166,  166,    3,    0,  229,  229,
+      166,    0,  171,    3,  166,  237,  237,  171,  168,  169,
+        0,  171,    3,  230,  387,  387,    0,    0,  231,  177,
+        0,  166,  232,    3,  178,  185,  185,  179,  171,    3,
+        0,  175,  175,  233,  235,  236,  236,  236,  236,  236,
+      236,    0,    0,  236,  236,  236,  236,  236,  236,    3,
+        0,  237,  237,  179,    3,    0,  240,  240,    0,    3,
+      186,   91,   91,    0,    0,  177,   95,    0,    0,    3,
+      178,  390,  390,  179,    0,    0,    3,    3,  180,  195,
+      195,  403,  394,  394,  240,  241,  242,   93,    0,    0,
+
+        0,  243,    3,    0,  245,  245,   95,    0,  184,  184,
+      184,  184,  184,  184,    0,    0,  184,  184,  184,  184,
+      184,  184,    0,    0,  196,    0,    3,    0,  248,  248,
+        0,    0,  188,  188,  188,  188,  188,  188,    0,  246,
+      188,  188,  188,  188,  188,  188,    0,    0,    0,    0,
+        3,    0,  251,  251,  252,    0,  253,  253,  253,  253,
+      253,  253,    0,  249,  253,  253,  253,  253,  253,  253,
+        3,    0,  204,  204,    3,    0,  193,  193,    0,  254,
+      255,  255,  255,  255,  255,  255,    0,  192,  255,  255,
+      255,  255,  255,  255,    3,    0,  198,  198,    0,    0,
+
+      257,  257,  257,  257,  257,  257,    0,  210,  257,  257,
+      257,  257,  257,  257,    3,    0,  203,  203,    0,    0,
+      261,  261,  261,  261,  261,  261,    0,    0,  261,  261,
+      261,  261,  261,  261,    3,    0,  204,  204,    3,    0,
+      204,  204,    3,    0,  204,  204,    0,    0,    3,  262,
+      204,  204,    0,    0,  206,    3,  207,  221,  221,    0,
+      207,    0,  205,    0,  206,    0,  207,    0,    0,    0,
+        3,  210,  204,  204,    0,  210,    3,    0,    0,  210,
+        0,  404,  396,  396,  205,  210,  206,    3,  207,  263,
+      263,    0,  222,  211,  211,  211,  211,  211,  211,  208,
+
+        0,  211,  211,  211,  211,  211,  211,  210,    0,    0,
+        0,    3,    0,  214,  214,  266,    0,  267,  267,  267,
+      267,  267,  267,    0,  264,  267,  267,  267,  267,  267,
+      267,    3,    0,  268,  268,    0,    0,    0,    0,    3,
+        0,  226,  226,    0,    0,  269,    0,  270,  215,  268,
+        0,    0,    3,    0,  229,  229,    3,    0,  234,  234,
+      271,    0,  272,    0,    3,    0,  218,  218,  273,  274,
+      275,  275,  275,  275,  275,  275,  227,    0,  275,  275,
+      275,  275,  275,  275,    3,    0,  278,  278,    3,  233,
+      229,  229,    0,  284,  283,  283,  283,  283,  283,  283,
+
+        0,    3,  279,  229,  229,    0,  280,    3,  281,  229,
+      229,    0,    0,    0,    3,    0,  240,  240,  230,    0,
+        0,  282,    0,    0,  230,  233,    0,  232,    0,    0,
+        3,    0,  240,  240,    0,    0,    0,    0,  233,    3,
+        0,  287,  287,    0,  233,  236,  236,  236,  236,  236,
+      236,  243,    0,  236,  236,  236,  236,  236,  236,    0,
+      240,    0,  242,    3,    0,  237,  237,  243,  235,  289,
+      289,  289,  289,  289,  289,    0,  288,  289,  289,  289,
+      289,  289,  289,    3,    0,  240,  240,  179,    3,    0,
+      245,  245,    3,    0,  247,  247,    0,    0,  292,  292,
+
+      292,  292,  292,  292,    0,    0,  292,  292,  292,  292,
+      292,  292,    3,  240,  248,  248,    3,    0,  251,  251,
+      243,    3,    0,    0,    0,  246,    0,  293,  293,  293,
+      293,  293,  293,    0,    0,  293,  293,  293,  293,  293,
+      293,    0,    0,    3,    0,  263,  263,    0,    3,  249,
+        0,    0,  252,  192,  253,  253,  253,  253,  253,  253,
+        0,    0,  253,  253,  253,  253,  253,  253,    3,    0,
+      294,  294,    0,    0,  253,  253,  253,  253,  253,  253,
+      264,    0,  253,  253,  253,  253,  253,  253,    0,    0,
+        0,    0,    3,    0,  298,  298,    0,    0,  255,  255,
+
+      255,  255,  255,  255,    0,  295,  255,  255,  255,  255,
+      255,  255,    0,    0,    0,    0,    3,    0,  301,  301,
+        0,    0,  257,  257,  257,  257,  257,  257,    0,  299,
+      257,  257,  257,  257,  257,  257,    0,    0,    0,    0,
+        3,    0,  261,  261,    0,    0,  261,  261,  261,  261,
+      261,  261,    0,  302,  261,  261,  261,  261,  261,  261,
+        3,    0,  268,  268,    3,    0,    0,    0,    0,    0,
+      308,  308,  308,  308,  308,  308,    0,  306,  308,  308,
+      308,  308,  308,  308,    3,    0,    0,    0,    0,    0,
+      267,  267,  267,  267,  267,  267,    0,  273,  267,  267,
+
+      267,  267,  267,  267,    3,    0,  309,  309,    0,    0,
+      267,  267,  267,  267,  267,  267,    0,    0,  267,  267,
+      267,  267,  267,  267,    3,    0,  268,  268,    3,    0,
+      268,  268,    0,    3,    0,  268,  268,    0,    0,    0,
+      270,  310,  268,    0,    0,    0,  268,  269,    0,  270,
+        3,  268,  268,  268,    0,    0,    0,    0,    0,    0,
+        3,  273,  315,  315,  269,  273,  270,  315,  268,    3,
+      273,  278,  278,    0,    3,    0,  313,  313,    0,  271,
+      275,  275,  275,  275,  275,  275,    0,  273,  275,  275,
+      275,  275,  275,  275,    0,    0,    0,  316,    0,  318,
+
+        0,    0,    0,    0,    0,    0,  282,    0,    0,    0,
+        0,  314,    3,  317,  277,  277,  317,  317,  317,  317,
+      317,  317,  317,  317,  317,  317,  317,  317,  317,  317,
+      317,  317,  317,  317,  317,  317,  317,  317,  317,  317,
+      317,  317,  317,  317,  317,  317,  317,  317,  317,  317,
+        3,    0,  278,  278,    3,    0,  278,  278,    3,    0,
+      278,  278,    0,    0,    0,    3,    0,  287,  287,    0,
+        0,    3,  279,  294,  294,    0,  279,    0,  281,    3,
+        0,  301,  301,    0,    0,    0,    3,  282,  309,  309,
+        3,  282,  319,  319,    0,  282,  283,  283,  283,  283,
+
+      283,  283,  288,    3,    0,  322,  322,    0,  295,  289,
+      289,  289,  289,  289,  289,    0,  302,  289,  289,  289,
+      289,  289,  289,  310,    0,    0,    0,  320,    3,    0,
+      290,  290,    0,  324,  325,  325,  325,  325,  325,  325,
+      323,    0,  325,  325,  325,  325,  325,  325,    3,  326,
+      291,  291,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,    3,    0,  327,  327,
+        0,    0,  292,  292,  292,  292,  292,  292,    0,    0,
+
+      292,  292,  292,  292,  292,  292,    0,    0,    0,    0,
+        3,    0,  329,  329,    0,    0,  293,  293,  293,  293,
+      293,  293,    0,  328,  293,  293,  293,  293,  293,  293,
+        3,    0,  315,  315,    3,    0,  298,  298,  332,    0,
+      333,  333,  333,  333,  333,  333,    0,  330,  333,  333,
+      333,  333,  333,  333,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  316,    0,    0,
+        0,  299,    3,  334,  300,  300,  334,  334,  334,  334,
+      334,  334,  334,  334,  334,  334,  334,  334,  334,  334,
       334,  334,  334,  334,  334,  334,  334,  334,  334,  334,
+
+      334,  334,  334,  334,  334,  334,  334,  334,  334,  334,
+        3,  336,  304,  304,  336,  336,  336,  336,  336,  336,
+      336,  336,  336,  336,  336,  336,  336,  336,  336,  336,
       336,  336,  336,  336,  336,  336,  336,  336,  336,  336,
+      336,  336,  336,  336,  336,  336,  336,  336,    3,    0,
+      338,  338,    0,    0,    0,    3,    0,  319,  319,    0,
+        0,    0,  339,    3,    0,  322,  322,    0,    3,    0,
+      327,  327,    0,    0,  340,    0,    0,  341,    0,    0,
+        3,    0,  343,  343,  338,  342,  308,  308,  308,  308,
+      308,  308,  320,    0,  308,  308,  308,  308,  308,  308,
+
+      323,    0,    0,    0,    3,  328,  313,  313,  346,    0,
+      347,  347,  347,  347,  347,  347,    0,  344,  347,  347,
+      347,  347,  347,  347,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  314,    3,  317,  348,  348,  317,  317,  317,  317,
+      317,  317,  317,  317,  317,  317,  317,  317,  317,  317,
+      317,  317,  317,  317,  317,  317,  317,  317,  317,  317,
+      317,  317,  317,  317,  317,  317,  317,  317,  317,  349,
+        3,    0,  354,  354,    0,    0,  325,  325,  325,  325,
+      325,  325,    0,    0,  325,  325,  325,  325,  325,  325,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  355,    3,  326,
+      356,  356,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  357,    3,    0,  329,  329,
+      358,    0,  359,  359,  359,  359,  359,  359,    0,    0,
+      359,  359,  359,  359,  359,  359,    3,    0,  335,  335,
+        3,    0,    0,    0,    0,    0,  360,  360,  360,  360,
+      360,  360,    0,  330,  360,  360,  360,  360,  360,  360,
+
+        3,    0,    0,    0,    0,    0,  333,  333,  333,  333,
+      333,  333,    0,  364,  333,  333,  333,  333,  333,  333,
+        3,    0,  361,  361,    0,    0,  333,  333,  333,  333,
+      333,  333,    0,    0,  333,  333,  333,  333,  333,  333,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  362,    3,  334,
+      363,  363,  334,  334,  334,  334,  334,  334,  334,  334,
+      334,  334,  334,  334,  334,  334,  334,  334,  334,  334,
+      334,  334,  334,  334,  334,  334,  334,  334,  334,  334,
+      334,  334,  334,  334,  334,  334,    3,  336,  365,  365,
 
-      342,  342,  410,  342,  410,  342,  410,  410,  342,  353,
-      353,  410,  353,  410,  353,  410,  410,  353,  354,  410,
-      354,  364,  364,  410,  364,  410,  364,  410,  410,  364,
-      365,  410,  365,  369,  410,  410,  369,  410,  369,  386,
-      386,  410,  386,  410,  386,  410,  410,  386,  392,  392,
-      410,  392,  410,  392,  410,  410,  392,  393,  410,  410,
-      393,  410,  393,  402,  410,  402,  403,  410,  403,  407,
-      410,  410,  407,  410,  407,    3,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410
+      336,  336,  336,  336,  336,  336,  336,  336,  336,  336,
+      336,  336,  336,  336,  336,  336,  336,  336,  336,  336,
+      336,  336,  336,  336,  336,  336,  336,  336,  336,  336,
+      336,  336,  336,  336,    3,    0,  337,  337,    3,    0,
+      338,  338,    0,    3,    0,  338,  338,    3,    0,  338,
+      338,    3,    0,  338,  338,    0,    0,    3,    0,  348,
+      348,  339,    0,    0,    3,    0,  354,  354,    0,    0,
+        0,  366,  341,    0,    0,  342,  341,    0,    0,  338,
+      342,    0,    0,  338,  342,    0,    0,  338,  342,    3,
+        0,  343,  343,  367,  372,  368,  368,  368,  368,  368,
+
+      368,  355,    0,  368,  368,  368,  368,  368,  368,    3,
+        0,  356,  356,    3,    0,    0,    0,    0,    0,  369,
+      369,  369,  369,  369,  369,    0,  344,  369,  369,  369,
+      369,  369,  369,    3,    0,    0,    0,    0,    0,  347,
+      347,  347,  347,  347,  347,    0,  376,  347,  347,  347,
+      347,  347,  347,    3,    0,  370,  370,    0,    0,  347,
+      347,  347,  347,  347,  347,    0,    0,  347,  347,  347,
+      347,  347,  347,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      371,    3,  317,  348,  348,  317,  317,  317,  317,  317,
+
+      317,  317,  317,  317,  317,  317,  317,  317,  317,  317,
+      317,  317,  317,  317,  317,  317,  317,  317,  317,  317,
+      317,  317,  317,  317,  317,  317,  317,  317,  349,    3,
+        0,  351,  351,    0,    0,  374,  374,  374,  374,  374,
+      374,    0,    0,  374,  374,  374,  374,  374,  374,    3,
+      326,  356,  356,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  357,    3,    0,    0,
+        0,    0,    0,  359,  359,  359,  359,  359,  359,    0,
+
+        0,  359,  359,  359,  359,  359,  359,    3,    0,  377,
+      377,    0,    0,  359,  359,  359,  359,  359,  359,    0,
+        0,  359,  359,  359,  359,  359,  359,    3,    0,  361,
+      361,    3,    0,  379,  379,    0,    0,  360,  360,  360,
+      360,  360,  360,    0,  378,  360,  360,  360,  360,  360,
+      360,    3,    0,  370,  370,    0,    0,    0,    3,    0,
+      377,  377,    0,    3,  362,    0,    0,    0,  380,  368,
+      368,  368,  368,  368,  368,    0,    0,  368,  368,  368,
+      368,  368,  368,    3,    0,  383,  383,    0,  371,  368,
+      368,  368,  368,  368,  368,  378,    0,  368,  368,  368,
+
+      368,  368,  368,    0,    0,    0,    0,    3,    0,  385,
+      385,    0,    0,  369,  369,  369,  369,  369,  369,    0,
+      384,  369,  369,  369,  369,  369,  369,    0,    0,    0,
+        0,    3,    0,  388,  388,    0,    0,  374,  374,  374,
+      374,  374,  374,    0,  386,  374,  374,  374,  374,  374,
+      374,    3,    0,  383,  383,    3,    0,  379,  379,  391,
+        0,  392,  392,  392,  392,  392,  392,    0,  389,  392,
+      392,  392,  392,  392,  392,    3,    0,  388,  388,    3,
+        0,  401,  401,    3,    0,  405,  405,    3,  384,  385,
+      385,  397,  380,  398,  398,  398,  398,  398,  398,    0,
+
+        0,  398,  398,  398,  398,  398,  398,    0,    0,    0,
+        0,    0,  389,    0,    0,    0,  402,    0,    0,    0,
+      406,    0,    0,    0,  386,    3,  399,  387,  387,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,    3,    0,  390,  390,    0,    0,  400,
+      400,  400,  400,  400,  400,    0,    0,  400,  400,  400,
+      400,  400,  400,    3,    0,    0,    0,    0,    0,  392,
+      392,  392,  392,  392,  392,    0,    0,  392,  392,  392,
+
+      392,  392,  392,    3,    0,  401,  401,    0,    0,  392,
+      392,  392,  392,  392,  392,    0,    0,  392,  392,  392,
+      392,  392,  392,    3,    0,  407,  407,    3,    0,    0,
+        0,    0,    0,  398,  398,  398,  398,  398,  398,    0,
+      402,  398,  398,  398,  398,  398,  398,    3,    0,  405,
+      405,    0,    0,  398,  398,  398,  398,  398,  398,    0,
+      413,  398,  398,  398,  398,  398,  398,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  406,    3,  399,  407,  407,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  408,    3,    0,  409,  409,    0,    0,  400,
+      400,  400,  400,  400,  400,    0,    0,  400,  400,  400,
+      400,  400,  400,    3,    0,  409,  409,    3,    0,    0,
+        0,    0,    0,  411,  411,  411,  411,  411,  411,    0,
+      410,  411,  411,  411,  411,  411,  411,    3,    0,    0,
+        0,    0,    0,  412,  412,  412,  412,  412,  412,    0,
+      410,  412,  412,  412,  412,  412,  412,    3,  399,  407,
+      407,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  408,    3,    0,  414,  414,    0,
+        0,  411,  411,  411,  411,  411,  411,    0,    0,  411,
+      411,  411,  411,  411,  411,    3,    0,  414,  414,    3,
+        0,  416,  416,    0,    0,  412,  412,  412,  412,  412,
+      412,    0,  415,  412,  412,  412,  412,  412,  412,    3,
+        0,  416,  416,    0,    0,  417,  417,  417,  417,  417,
+      417,    0,  415,  417,  417,  417,  417,  417,  417,    3,
+        0,  418,  418,    0,    0,  417,  417,  417,  417,  417,
+
+      417,    0,    0,  417,  417,  417,  417,  417,  417,    3,
+        0,  418,  418,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  419,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  419,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420
     } ;
 
-static yyconst flex_int16_t yy_chk[2037] =
-    {   0,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+static yyconst flex_int16_t yy_chk[4086] =
+    {   1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    2,    2,    2,
         2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
         2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
         2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        6,    6,    7,    7,   19,   13,   13,   14,   14,   22,
-        6,  390,   17,   17,   26,   26,   28,   28,   24,   24,
-       29,   40,    6,   14,   26,  388,   43,   19,   17,   14,
-       13,   45,   22,   14,   17,   17,   26,  123,  123,   18,
-
-       18,   24,  347,   29,   40,    6,   14,   30,   30,   43,
-       49,   17,   14,   13,   45,   18,   14,   17,   17,   26,
-        7,    8,    8,   13,   24,   14,  314,   51,   18,   42,
-       17,    8,   18,   49,  307,    8,   24,   52,   18,   33,
-       42,    8,  305,    8,   62,  299,   27,   27,   65,    8,
-       51,   18,   42,   33,   77,   18,   27,   18,    8,  103,
-       52,  287,   33,   42,    8,   30,    8,   62,   27,  125,
-      125,   65,    8,  266,   35,   35,   33,   77,  264,    8,
-        9,    9,  103,   35,    9,    9,    9,    9,    9,    9,
-        9,   27,    9,    9,    9,    9,    9,    9,  107,  111,
-
-      118,    9,    9,  127,  127,    9,   35,    9,    9,   41,
-       41,   53,   53,  130,  130,    9,    9,    9,    9,    9,
-        9,  107,  111,  118,    9,    9,   57,   57,    9,  222,
-        9,    9,   63,   63,   41,   57,   53,  135,    9,   10,
-       10,  131,  131,   10,   10,   10,   10,   10,   10,   10,
-      198,   10,   10,   10,   10,   10,   10,   41,   57,   53,
-      135,   10,   78,  140,   10,   10,   10,   41,   78,   53,
-       32,   32,   32,   32,   10,   10,   10,   10,   10,   10,
-       32,   67,   67,  195,   10,   78,  140,   10,   10,   10,
-       63,   78,   32,   20,   20,  136,  136,   10,   11,   11,
-
-       67,  143,   34,   34,   69,   69,   39,   39,   11,   20,
-      161,   20,  139,  146,  146,   32,   36,   36,   11,  139,
-       11,   20,   34,   67,   34,   11,   11,   39,   32,  171,
-       36,   39,   20,  161,   20,  137,   36,    3,   36,   67,
-       86,   11,  139,   11,   20,   34,   86,   34,   11,   11,
-       39,   20,  171,   36,   39,  176,   11,   12,   12,   36,
-       34,   36,   69,   86,   39,   38,   38,  149,  149,   86,
-       12,   48,   48,    1,   36,   38,   12,   12,  176,   12,
-      182,   12,  154,  154,   12,   12,  179,   38,   70,   70,
-       38,   74,   74,   12,  155,  155,   48,  179,   48,   12,
-
-       12,  191,   12,  182,   12,  173,  173,   12,   12,  179,
-       38,   56,   56,   38,    0,   12,   15,   15,    0,   48,
-      179,   48,    0,   38,  191,   55,   55,   55,   55,   48,
-       75,   75,   15,   56,   15,   55,    0,   76,   76,   56,
-       15,   15,  205,   15,   82,   82,   70,   55,    0,   74,
-        0,   58,   58,   84,   84,   15,   56,   15,    0,   59,
-       59,    0,   56,   15,   15,  205,   15,   58,  207,   56,
-       55,   58,   73,   73,   15,   16,   16,  206,  206,   61,
-       61,   59,   58,   55,  197,  197,  197,   16,   75,   61,
-       58,  207,  208,   16,   58,   76,  202,  202,   73,   16,
-
-       16,   61,   82,  211,   59,   58,  202,  212,  212,   58,
-       16,   84,    0,   66,   66,  208,   16,   59,  221,  221,
-      221,   73,   16,   16,   61,    0,  211,   72,   72,   66,
-       73,    0,   66,   16,   21,   21,  218,   61,   79,   79,
-        0,   66,   80,   80,  186,  186,   21,   92,   92,   72,
-       21,    0,   66,   72,   79,   66,   83,   83,   80,  218,
-       21,   85,   85,   21,   66,   79,  186,  201,  201,   21,
-      201,   66,   72,   21,   83,    0,   72,   79,  229,   85,
-       83,   80,    0,   21,    0,   72,   21,    0,   79,  186,
-       91,   91,   21,   23,   23,  278,   79,   83,   89,   89,
-
-       80,  229,   85,   83,    0,   92,    0,   90,   90,   94,
-       94,    0,   91,   23,   83,   23,   90,   23,  278,   85,
-       89,   89,   23,    0,   88,   88,   88,   88,   93,   93,
-       98,   98,   99,   99,   88,   91,   23,    0,   23,   90,
-       23,   95,   95,   89,   89,   23,   88,    0,   91,    0,
-       99,   23,   25,   25,  225,  225,   89,   93,  101,  101,
-       99,   93,  227,  227,   25,  227,   25,   94,    0,   88,
-       95,   25,    0,   99,    0,  100,  100,  105,  105,    0,
-       93,   25,   88,   99,   93,    0,   93,   25,   98,   25,
-       99,  108,  108,   95,   25,  110,  110,  234,  234,   95,
-
-      109,  109,    0,  100,   25,  106,  106,  114,  114,    0,
-       25,   44,   44,    0,  115,  115,  101,  106,  240,  240,
-       44,  106,  109,   44,  117,  117,  100,   44,  120,  120,
-        0,  106,   44,  100,    0,  105,   44,    0,  124,  124,
-      106,    0,  112,  112,  106,  109,   44,  119,  119,  108,
-       44,  152,  152,  110,  106,   44,  141,  141,  109,   44,
-      152,    0,  112,  106,  112,  114,  119,  243,  243,   44,
-       47,   47,  115,    0,   47,   47,   47,   47,   47,   47,
-       47,    0,  117,  152,    0,  112,  120,  112,    0,  119,
-      121,  121,   47,  150,  150,   47,  124,  156,  156,    0,
-
-      112,    0,  129,  129,  121,  119,  244,  244,    0,  121,
-        0,  157,  157,    0,  141,   47,  162,  162,   47,    0,
-      128,  128,  128,  128,  129,  134,  134,  121,   47,   50,
-       50,    0,  121,  142,  142,  164,  164,    0,   50,  132,
-      132,   50,  128,   50,    0,   50,    0,  129,  121,    0,
-      134,  150,  250,  250,   50,  156,   50,    0,  142,  132,
-      129,  132,  166,  166,   50,  128,   50,    0,   50,  157,
-      133,  133,    0,  134,  162,  138,  138,   50,  128,   50,
-      133,  142,  132,  134,  132,  159,  159,   50,   64,   64,
-        0,  142,  133,  164,    0,  133,  138,  132,  163,  163,
-
-      138,  159,  144,  144,    0,  187,  187,   64,   64,  145,
-      145,    0,   64,    0,  187,  133,   64,  163,  133,  138,
-      166,  145,    0,  138,  159,    0,  163,  144,  133,  144,
-       64,   64,    0,  138,  145,   64,  145,  187,    0,   64,
-      163,  228,  228,  159,  145,    0,   64,   97,   97,  163,
-      144,  228,  144,  253,  253,    0,  163,  145,    0,  145,
-      144,   97,   97,   97,  260,  260,    0,  145,  151,  151,
-      151,  151,   97,  158,  158,   97,  262,  262,  153,  153,
-        0,  169,  169,    0,   97,   97,   97,  170,  170,  158,
-      151,    0,  167,  167,    0,   97,  165,  165,   97,  153,
-
-      153,  172,  172,    0,  158,   97,  104,  104,    0,  174,
-      174,  167,  158,  151,    0,  165,  175,  175,  104,  217,
-      104,  217,  153,  153,  165,  104,  151,  158,  104,  180,
-      180,  158,  104,  104,  167,    0,  153,    0,  165,  169,
-        0,  104,  217,  104,  217,  170,    0,  165,  104,    0,
-      167,  104,  177,  177,  165,  104,  104,  265,  265,  172,
-      178,  178,  280,  280,  104,  147,  147,  174,  177,  283,
-      283,  185,  185,    0,  175,  183,  183,  147,  183,  147,
-      177,  147,  190,  190,    0,  192,  192,  180,  178,    0,
-      185,  177,  147,  185,  147,  291,  291,  183,  291,    0,
-
-      147,    0,  147,  177,  147,  188,  188,    0,  190,    0,
-      177,  178,    0,  185,    0,  147,  185,  147,  178,  188,
-      183,  292,  292,  147,  188,  193,  193,  188,    0,  189,
-      189,  190,    0,  183,  184,  184,  196,  196,  203,  203,
-      190,    0,  188,  192,  199,  199,  199,  188,  184,    0,
-      188,  209,  209,  184,  213,  213,  184,  189,  189,  189,
-        0,  184,  215,  215,  216,  216,  220,  220,  223,  223,
-      223,  184,  230,  230,  214,  214,  184,    0,  215,  184,
-      189,  189,  189,  193,  184,  235,  235,  189,  214,    0,
-      214,    0,  237,  237,  196,    0,  203,  239,  239,  245,
-
-      245,  215,  199,  241,  241,    0,  241,  242,  242,  209,
-      242,  214,  213,  214,    0,  246,  246,    0,  248,  248,
-      215,    0,  216,    0,  220,  241,  223,  293,  293,  242,
-      230,    0,  214,  226,  226,  247,  247,  251,  251,  254,
-      254,  257,  257,  235,    0,  226,  248,  226,  241,  226,
-      237,    0,  242,  261,  261,  239,  261,  245,  263,  263,
-      226,  241,  226,  247,    0,  247,  267,  267,  226,  248,
-      226,    0,  226,  246,  268,  268,  248,  258,  258,  258,
-      259,  259,  259,  226,    0,  226,  247,    0,  247,  272,
-      272,  226,  277,  247,  277,  251,    0,  254,    0,  257,
-
-      271,  271,  271,  273,  273,  274,  274,  275,  275,  276,
-      276,  261,    0,  282,  282,  277,  263,  277,  282,  274,
-        0,  274,    0,  275,  267,  281,  281,    0,  281,  284,
-      284,    0,  268,  288,  288,  258,  294,  294,  259,  286,
-      286,  286,  274,    0,  274,    0,  275,  272,  290,  290,
-        0,  290,  295,  295,  296,  296,  302,  302,  271,  303,
-      303,  273,    0,  274,    0,  275,    0,  276,  306,  306,
-      290,  282,  298,  298,  298,  300,  300,  300,  308,  308,
-      310,  310,    0,  281,  311,  311,    0,  284,  313,  313,
-      313,  288,    0,  290,  294,  315,  315,  315,  317,  317,
-
-      318,  318,  320,  320,  321,  321,  290,  322,  322,    0,
-      295,    0,  296,  324,  324,  325,  325,  303,  325,  326,
-      326,  327,  327,  329,  329,  329,  332,  332,  332,  333,
-      333,  334,  334,  300,  335,  335,  308,    0,  310,  336,
-      336,    0,  311,  337,  337,  338,  338,  338,  341,  341,
-      341,  342,  342,  315,  343,  343,  317,    0,  318,    0,
-      320,  344,  344,  345,  345,  322,  346,  346,  346,  348,
-      348,  350,  350,  325,  351,  351,    0,  326,    0,  327,
-        0,  329,  353,  353,  332,  354,  354,  333,  352,  352,
-      352,    0,  335,  355,  355,  357,  357,    0,  357,  358,
-
-      358,  337,    0,  338,  360,  360,  341,  360,    0,  342,
-      361,  361,  343,  363,  363,  363,  364,  364,    0,  344,
-      365,  365,  366,  366,  369,  369,    0,  348,    0,  350,
-      370,  370,  351,  372,  372,  374,  374,  374,  376,  376,
-      353,  377,  377,  354,  378,  378,  352,  380,  380,  380,
-        0,  355,  382,  382,  384,  384,    0,  358,  385,  385,
-      385,  386,  386,  387,  387,  387,  392,  392,  361,  393,
-      393,  363,  394,  394,  364,  389,  389,  389,  365,    0,
-      366,    0,  369,  391,  391,  391,  398,  398,  400,  400,
-        0,  372,    0,  374,  402,  402,  403,  403,  404,  404,
-
-      406,  406,  378,  407,  407,  380,  408,  408,    0,    0,
-      382,    0,    0,    0,    0,    0,  385,    0,    0,  386,
-        0,    0,    0,    0,  392,    0,    0,  393,    0,    0,
-      394,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  391,    0,    0,  398,    0,  400,    0,    0,    0,
-        0,    0,  402,    0,    0,    0,  404,    0,    0,    0,
-        0,  407,    0,    0,  408,  411,  411,  411,  411,  411,
-      411,  411,  411,  411,  411,  412,    0,    0,  412,  412,
-      412,  412,  413,    0,    0,  413,    0,  413,  414,  414,
-      414,  414,  414,  414,  414,    0,  414,  415,    0,    0,
-
-      415,  415,  415,  415,  415,  415,  416,  416,  416,  416,
-      416,  416,  416,    0,  416,  417,    0,    0,  417,    0,
-      417,    0,    0,  417,  418,    0,    0,  418,    0,    0,
-        0,    0,  418,  419,    0,    0,  419,    0,  419,    0,
-        0,  419,  420,    0,    0,  420,    0,  420,    0,    0,
-      420,  421,    0,  421,  422,    0,    0,  422,    0,    0,
-        0,    0,  422,  423,    0,  423,  424,    0,    0,  424,
-        0,  424,    0,    0,  424,  425,    0,  425,  425,    0,
-      425,  425,    0,  425,  426,  426,    0,  426,    0,  426,
-        0,    0,  426,  427,    0,  427,  427,    0,  427,  428,
-
-        0,    0,  428,    0,  428,  429,    0,    0,  429,    0,
-      429,  430,  430,    0,  430,    0,  430,    0,    0,  430,
-      431,    0,  431,  431,    0,  431,  432,    0,  432,  432,
-        0,  432,  432,  433,    0,    0,  433,    0,  433,  434,
-        0,  434,  435,    0,  435,  436,  436,  436,  436,  436,
-      436,  436,  436,  436,  436,  437,    0,  437,  437,    0,
-      437,  438,  438,  438,  438,  438,  438,  438,  438,  438,
-      438,  439,  439,    0,  439,    0,  439,    0,    0,  439,
-      440,  440,  440,  440,  440,  440,  440,  440,  440,  440,
-      441,  441,  441,  441,  441,  441,  441,  441,  441,  441,
-
-      442,  442,    0,  442,    0,  442,    0,    0,  442,  443,
-      443,    0,  443,    0,  443,    0,    0,  443,  444,    0,
-      444,  445,  445,    0,  445,    0,  445,    0,    0,  445,
-      446,    0,  446,  447,    0,    0,  447,    0,  447,  448,
-      448,    0,  448,    0,  448,    0,    0,  448,  449,  449,
-        0,  449,    0,  449,    0,    0,  449,  450,    0,    0,
-      450,    0,  450,  451,    0,  451,  452,    0,  452,  453,
-        0,    0,  453,    0,  453,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410
+        2,    2,    2,    2,    2,    6,   19,    6,    6,    0,
+        0,    6,    6,    6,    6,    6,    6,    6,   53,    6,
+        6,    6,    6,    6,    6,    7,   20,    7,    7,    6,
+
+        8,   44,    8,    8,   19,   30,    8,    8,    8,    8,
+        8,    8,    8,   46,    8,    8,    8,    8,    8,    8,
+       53,   30,    8,   23,    8,   20,   52,   46,   97,   44,
+        8,  102,    7,    9,  172,    9,    9,    8,  105,    9,
+        9,    9,    9,    9,    9,    9,    0,    9,    9,    9,
+        9,    9,    9,  172,   52,   97,    9,    9,  134,   23,
+        9,  162,    9,    9,  102,   10,  105,   10,   10,  154,
+        9,   10,   10,   10,   10,   10,   10,   10,  162,   10,
+       10,   10,   10,   10,   10,   25,  131,   25,   25,   10,
+      154,  134,   10,   10,   10,  258,  131,   11,    0,   11,
+
+       11,  258,   10,   11,   11,   11,   11,   11,   11,   11,
+       25,   11,   11,   11,   11,   11,   11,   36,  190,   11,
+      137,   11,   25,  190,   36,   36,   11,   11,  129,   12,
+      137,   12,   12,   36,   11,   12,   12,   12,   12,   12,
+       12,   12,  129,   12,   12,   12,   12,   12,   12,   43,
+       12,   12,  187,   12,   13,   12,   13,   13,   12,   12,
+       14,  262,   14,   14,  187,   43,   12,   15,  213,   15,
+       15,    0,   16,  213,   16,   16,   43,   17,   14,   17,
+       17,   13,  120,  262,   14,   15,   16,   15,   14,  120,
+      120,   13,   16,   15,   15,   17,   15,   14,   16,   16,
+
+      174,   17,   17,   18,   15,   18,   18,  197,   22,   16,
+       22,   22,  183,   21,   17,   21,   21,   27,  174,   27,
+       27,   18,   22,  220,  197,   24,   22,   24,   24,   27,
+      183,   21,  199,   21,   18,  318,   22,  220,   18,   22,
+       18,   27,    0,   21,   85,   22,    0,   24,  199,   24,
+       21,   24,   26,   58,   26,   26,   24,  260,   85,    0,
+       58,   58,   24,  260,   85,    0,   26,  200,   26,   58,
+      122,  318,   31,   26,   31,   31,  122,  122,    0,   64,
+      303,   64,   64,   26,   28,  200,   28,   28,  303,   26,
+       28,   28,   28,   28,   28,   28,   28,  305,   28,   28,
+
+       28,   28,   28,   28,   29,  305,   29,   29,   28,   31,
+       29,   29,   29,   29,   29,   29,   64,    0,   29,   29,
+       29,   29,   29,   29,   33,    0,   33,   33,   33,   33,
+       33,   33,   33,   33,   33,   33,   33,    0,   33,   33,
+       33,   33,   33,   33,  124,    0,  124,  124,   33,  286,
+       42,    0,   42,   42,  286,    0,   34,    0,   34,   34,
+      202,   33,   34,   34,   34,   34,   34,   34,   34,    0,
+       34,   34,   34,   34,   34,   34,  202,   42,   34,   35,
+       34,   35,   35,   37,   89,   37,   37,   42,  125,  297,
+      149,   89,   89,   34,  297,  125,  125,  149,  149,   37,
+
+       89,   35,    0,   35,  312,   37,  143,   37,   54,  312,
+       54,   54,  143,  143,  353,   39,   35,   39,   39,  353,
+       37,   39,   39,   39,   39,   39,   39,   39,    0,   39,
+       39,   39,   39,   39,   39,   54,  164,    0,  130,   39,
+      130,  130,   39,  164,  164,   54,  394,   40,  350,   40,
+       40,  394,   39,   40,   40,   40,   40,   40,   40,   40,
+      146,   40,   40,   40,   40,   40,   40,  146,  146,    0,
+       40,   40,    0,  350,   40,   57,  146,   57,   57,   41,
+        0,   41,   41,    0,   40,   41,   41,   41,   41,   41,
+       41,   41,    0,   41,   41,   41,   41,   41,   41,   57,
+
+        0,    0,   41,   41,    0,   57,   41,   45,    0,   45,
+       45,   71,   57,   71,   71,  216,   41,   74,   45,   74,
+       74,   45,  216,  216,  140,   45,  140,  140,  396,   48,
+       45,   48,   48,  396,   45,   48,   48,   48,   48,   48,
+       48,   48,    0,    0,   45,   74,    0,   76,   71,   76,
+       76,    0,    0,   48,   74,    0,   48,   60,    0,   60,
+       60,   49,    0,   49,   49,    0,   48,   49,   49,   49,
+       49,   49,   49,   49,    0,   49,   49,   49,   49,   49,
+       49,   60,    0,    0,   76,   49,    0,    0,   49,   82,
+       49,   82,   82,   50,   60,   50,   50,    0,   49,   50,
+
+       50,   50,   50,   50,   50,   50,    0,   50,   50,   50,
+       50,   50,   50,   51,    0,   51,   51,   50,    0,    0,
+       50,    0,   50,    0,   51,    0,   82,   51,    0,   51,
+       50,   51,  189,   93,    0,   93,   93,  189,  189,  189,
+       51,    0,   51,    0,   80,    0,   80,   80,    0,   56,
+       51,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   80,   56,   56,   56,   56,   56,   56,   59,
+       93,   59,   59,   56,    0,    0,   62,  179,   62,   62,
+      148,   80,  148,  148,  179,  179,   56,   59,   62,    0,
+        0,   59,   84,  179,   84,   84,   98,    0,   98,   98,
+
+       62,  224,   59,  224,  224,    0,   59,    0,   63,    0,
+       63,   63,   84,   62,   63,   63,   63,   63,   63,   63,
+       63,    0,   63,   63,   63,   63,   63,   63,   65,   84,
+       65,   65,   63,   98,   66,    0,   66,   66,   63,   67,
+        0,   67,   67,    0,    0,   68,  212,   68,   68,   65,
+       65,  212,  212,  212,   65,   66,   66,   67,   65,    0,
+       67,  235,    0,    0,   66,   65,   68,  235,  235,   67,
+      238,   66,  238,  238,    0,    0,   67,   70,    0,   70,
+       70,    0,   68,   70,   70,   70,   70,   70,   70,    0,
+        0,   70,   70,   70,   70,   70,   70,   73,  239,   73,
+
+       73,   75,    0,   75,   75,  239,  239,   75,   75,   75,
+       75,   75,   75,   77,   70,   77,   77,   78,    0,   78,
+       78,   73,    0,    0,    0,   73,  254,   79,    0,   79,
+       79,   77,  254,  254,   73,   78,    0,    0,   75,   77,
+       77,  274,   77,    0,   78,   79,   78,  274,  274,   83,
+       77,   83,   83,    0,   78,  194,   79,  194,  194,  106,
+        0,  106,  106,   90,   79,   90,   90,  194,    0,   83,
+       88,    0,   88,   88,   87,   83,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   83,   90,   87,   87,
+       87,   87,   87,   87,   88,   88,  106,  324,   87,   92,
+
+       90,   92,   92,  324,  324,    0,   91,   88,   91,   91,
+        0,   87,   91,   91,   91,   91,   91,   91,    0,    0,
+       91,   91,   91,   91,   91,   91,   94,    0,   94,   94,
+       92,    0,    0,    0,   92,   96,   92,   96,   96,   99,
+        0,   99,   99,   91,  100,    0,  100,  100,    0,  285,
+        0,   96,   96,   96,  285,  285,  285,   94,  244,   99,
+      244,  244,   96,   94,  103,   96,  103,  103,  104,   99,
+      104,  104,   96,   99,  100,    0,   99,  381,  103,    0,
+      103,  100,  104,  381,  381,  103,  104,  107,  103,  107,
+      107,    0,  103,  103,    0,  108,  104,  108,  108,    0,
+
+      111,  103,  111,  111,    0,  104,  109,    0,  109,  109,
+        0,  107,    0,  115,    0,  115,  115,  108,  177,  108,
+      177,  177,    0,    0,  107,    0,  108,    0,  109,    0,
+      109,    0,  108,  116,  115,  116,  116,  111,  113,  177,
+      113,  113,  177,  109,  113,  113,  113,  113,  113,  113,
+      115,    0,  113,  113,  113,  113,  113,  113,  114,    0,
+      114,  114,  117,    0,  117,  117,    0,    0,    0,  126,
+      116,  126,  126,    0,  114,  113,    0,    0,  117,  114,
+        0,  296,  150,  117,  150,  150,  296,  296,  296,  114,
+        0,  126,    0,  126,  119,  114,  119,  119,    0,  117,
+
+      119,  119,  119,  119,  119,  119,  126,    0,  119,  119,
+      119,  119,  119,  119,  156,    0,  156,  156,  121,  150,
+      256,    0,  256,  256,  121,  121,  121,  121,  121,  121,
+        0,  119,  121,  121,  121,  121,  121,  121,  123,    0,
+      123,  123,    0,    0,  123,  123,  123,  123,  123,  123,
+        0,  156,  123,  123,  123,  123,  123,  123,  259,    0,
+      259,  259,  127,    0,  127,  127,    0,    0,  127,  127,
+      127,  127,  127,  127,    0,  123,  127,  127,  127,  127,
+      127,  127,  163,    0,  163,  163,  128,    0,  128,  128,
+        0,    0,  128,  128,  128,  128,  128,  128,    0,  127,
+
+      128,  128,  128,  128,  128,  128,  132,    0,  132,  132,
+      382,    0,  133,  128,  133,  133,  382,  382,  178,  163,
+      178,  178,  219,  128,  219,  219,  133,    0,    0,  132,
+        0,  311,    0,  132,  219,  133,  311,  311,  311,  133,
+        0,    0,  178,  132,  135,    0,  135,  135,    0,  133,
+      135,  135,  135,  135,  135,  135,  136,    0,  136,  136,
+        0,    0,  136,  136,  136,  136,  136,  136,  138,    0,
+      138,  138,  139,    0,  139,  139,  321,    0,  321,  321,
+        0,  135,  141,  136,  141,  141,  139,    0,    0,  152,
+        0,  152,  152,  136,    0,  138,  141,  138,  141,  139,
+
+      141,  139,    0,    0,    0,  138,    0,  152,    0,  139,
+      352,  141,    0,  141,  142,  352,  352,  352,    0,  141,
+      142,  142,  142,  142,  142,  142,  152,    0,  142,  142,
+      142,  142,  142,  142,  144,    0,  144,  144,    0,    0,
+      144,  144,  144,  144,  144,  144,    0,    0,  144,  144,
+      144,  144,  144,  144,  363,    0,  363,  363,  145,  363,
+      145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+        0,  144,  145,  145,  145,  145,  145,  145,  147,    0,
+      147,  147,  145,    0,    0,  151,    0,  151,  151,  155,
+        0,  155,  155,    0,    0,  145,  158,    0,  158,  158,
+
+        0,  147,  147,  151,  157,    0,  157,  157,    0,  166,
+      155,  166,  166,    0,    0,  147,    0,  158,  151,  155,
+        0,  160,  151,  160,  160,  157,  155,  160,  160,  160,
+      160,  160,  160,  158,  157,  160,  160,  160,  160,  160,
+      160,  157,  161,    0,  161,  161,  166,    0,  161,  161,
+      161,  161,  161,  161,  165,    0,  165,  165,  160,    0,
+      165,  165,  165,  165,  165,  165,    0,    0,  165,  165,
+      165,  165,  165,  165,    0,  167,    0,  167,  167,  161,
+      168,    0,  168,  168,  169,    0,  169,  169,    0,    0,
+        0,  165,  167,  167,  365,    0,  365,  365,  168,  365,
+
+        0,  170,  167,  170,  170,  167,  173,    0,  173,  173,
+      168,    0,  167,  180,  169,  180,  180,  168,  170,  170,
+        0,  169,  373,  173,  373,  373,    0,    0,  173,  180,
+        0,  170,  173,  185,  180,  185,  185,  180,  170,  175,
+        0,  175,  175,  173,  175,  175,  175,  175,  175,  175,
+      175,    0,    0,  175,  175,  175,  175,  175,  175,  176,
+        0,  176,  176,  175,  181,    0,  181,  181,    0,  182,
+      185,  182,  182,    0,    0,  176,  175,    0,    0,  375,
+      176,  375,  375,  176,    0,    0,  393,  195,  176,  195,
+      195,  393,  393,  393,  181,  181,  181,  182,    0,    0,
+
+        0,  181,  184,    0,  184,  184,  182,    0,  184,  184,
+      184,  184,  184,  184,    0,    0,  184,  184,  184,  184,
+      184,  184,    0,    0,  195,    0,  188,    0,  188,  188,
+        0,    0,  188,  188,  188,  188,  188,  188,    0,  184,
+      188,  188,  188,  188,  188,  188,    0,    0,    0,    0,
+      191,    0,  191,  191,  191,    0,  191,  191,  191,  191,
+      191,  191,    0,  188,  191,  191,  191,  191,  191,  191,
+      207,    0,  207,  207,  193,    0,  193,  193,    0,  193,
+      193,  193,  193,  193,  193,  193,    0,  191,  193,  193,
+      193,  193,  193,  193,  198,    0,  198,  198,    0,    0,
+
+      198,  198,  198,  198,  198,  198,    0,  207,  198,  198,
+      198,  198,  198,  198,  203,    0,  203,  203,    0,    0,
+      203,  203,  203,  203,  203,  203,    0,    0,  203,  203,
+      203,  203,  203,  203,  204,    0,  204,  204,  205,    0,
+      205,  205,  206,    0,  206,  206,    0,    0,  208,  204,
+      208,  208,    0,    0,  205,  221,  205,  221,  221,    0,
+      206,    0,  208,    0,  208,    0,  208,    0,    0,    0,
+      209,  204,  209,  209,    0,  205,  395,    0,    0,  206,
+        0,  395,  395,  395,  209,  208,  209,  211,  209,  211,
+      211,    0,  221,  211,  211,  211,  211,  211,  211,  209,
+
+        0,  211,  211,  211,  211,  211,  211,  209,    0,    0,
+        0,  214,    0,  214,  214,  214,    0,  214,  214,  214,
+      214,  214,  214,    0,  211,  214,  214,  214,  214,  214,
+      214,  217,    0,  217,  217,    0,    0,    0,    0,  226,
+        0,  226,  226,    0,    0,  217,    0,  217,  214,  217,
+        0,    0,  230,    0,  230,  230,  234,    0,  234,  234,
+      217,    0,  217,    0,  218,    0,  218,  218,  217,  218,
+      218,  218,  218,  218,  218,  218,  226,    0,  218,  218,
+      218,  218,  218,  218,  228,    0,  228,  228,  229,  230,
+      229,  229,    0,  234,  229,  229,  229,  229,  229,  229,
+
+        0,  231,  228,  231,  231,    0,  228,  232,  228,  232,
+      232,    0,    0,    0,  240,    0,  240,  240,  231,    0,
+        0,  228,    0,    0,  232,  229,    0,  231,    0,    0,
+      241,    0,  241,  241,    0,    0,    0,    0,  231,  236,
+        0,  236,  236,    0,  232,  236,  236,  236,  236,  236,
+      236,  240,    0,  236,  236,  236,  236,  236,  236,    0,
+      241,    0,  241,  237,    0,  237,  237,  241,  237,  237,
+      237,  237,  237,  237,  237,    0,  236,  237,  237,  237,
+      237,  237,  237,  242,    0,  242,  242,  237,  245,    0,
+      245,  245,  247,    0,  247,  247,    0,    0,  247,  247,
+
+      247,  247,  247,  247,    0,    0,  247,  247,  247,  247,
+      247,  247,  248,  242,  248,  248,  251,    0,  251,  251,
+      242,  250,    0,    0,    0,  245,    0,  250,  250,  250,
+      250,  250,  250,    0,    0,  250,  250,  250,  250,  250,
+      250,    0,    0,  263,    0,  263,  263,    0,  252,  248,
+        0,    0,  252,  251,  252,  252,  252,  252,  252,  252,
+        0,    0,  252,  252,  252,  252,  252,  252,  253,    0,
+      253,  253,    0,    0,  253,  253,  253,  253,  253,  253,
+      263,    0,  253,  253,  253,  253,  253,  253,    0,    0,
+        0,    0,  255,    0,  255,  255,    0,    0,  255,  255,
+
+      255,  255,  255,  255,    0,  253,  255,  255,  255,  255,
+      255,  255,    0,    0,    0,    0,  257,    0,  257,  257,
+        0,    0,  257,  257,  257,  257,  257,  257,    0,  255,
+      257,  257,  257,  257,  257,  257,    0,    0,    0,    0,
+      261,    0,  261,  261,    0,    0,  261,  261,  261,  261,
+      261,  261,    0,  257,  261,  261,  261,  261,  261,  261,
+      268,    0,  268,  268,  265,    0,    0,    0,    0,    0,
+      265,  265,  265,  265,  265,  265,    0,  261,  265,  265,
+      265,  265,  265,  265,  266,    0,    0,    0,    0,    0,
+      266,  266,  266,  266,  266,  266,    0,  268,  266,  266,
+
+      266,  266,  266,  266,  267,    0,  267,  267,    0,    0,
+      267,  267,  267,  267,  267,  267,    0,    0,  267,  267,
+      267,  267,  267,  267,  269,    0,  269,  269,  270,    0,
+      270,  270,    0,  271,    0,  271,  271,    0,    0,    0,
+      269,  267,  269,    0,    0,    0,  270,  271,    0,  271,
+      272,  271,  272,  272,    0,    0,    0,    0,    0,    0,
+      276,  269,  276,  276,  272,  270,  272,  276,  272,  278,
+      271,  278,  278,    0,  275,    0,  275,  275,    0,  272,
+      275,  275,  275,  275,  275,  275,    0,  272,  275,  275,
+      275,  275,  275,  275,    0,    0,    0,  276,    0,  278,
+
+        0,    0,    0,    0,    0,    0,  278,    0,    0,    0,
+        0,  275,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
+      279,    0,  279,  279,  280,    0,  280,  280,  281,    0,
+      281,  281,    0,    0,    0,  287,    0,  287,  287,    0,
+        0,  294,  280,  294,  294,    0,  281,    0,  280,  301,
+        0,  301,  301,    0,    0,    0,  309,  279,  309,  309,
+      283,  280,  283,  283,    0,  281,  283,  283,  283,  283,
+
+      283,  283,  287,  289,    0,  289,  289,    0,  294,  289,
+      289,  289,  289,  289,  289,    0,  301,  289,  289,  289,
+      289,  289,  289,  309,    0,    0,    0,  283,  290,    0,
+      290,  290,    0,  290,  290,  290,  290,  290,  290,  290,
+      289,    0,  290,  290,  290,  290,  290,  290,  291,  291,
+      291,  291,  291,  291,  291,  291,  291,  291,  291,  291,
+      291,  291,  291,  291,  291,  291,  291,  291,  291,  291,
+      291,  291,  291,  291,  291,  291,  291,  291,  291,  291,
+      291,  291,  291,  291,  291,  291,  292,    0,  292,  292,
+        0,    0,  292,  292,  292,  292,  292,  292,    0,    0,
+
+      292,  292,  292,  292,  292,  292,    0,    0,    0,    0,
+      293,    0,  293,  293,    0,    0,  293,  293,  293,  293,
+      293,  293,    0,  292,  293,  293,  293,  293,  293,  293,
+      315,    0,  315,  315,  298,    0,  298,  298,  298,    0,
+      298,  298,  298,  298,  298,  298,    0,  293,  298,  298,
+      298,  298,  298,  298,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  315,    0,    0,
+        0,  298,  300,  300,  300,  300,  300,  300,  300,  300,
+      300,  300,  300,  300,  300,  300,  300,  300,  300,  300,
+      300,  300,  300,  300,  300,  300,  300,  300,  300,  300,
+
+      300,  300,  300,  300,  300,  300,  300,  300,  300,  300,
+      304,  304,  304,  304,  304,  304,  304,  304,  304,  304,
+      304,  304,  304,  304,  304,  304,  304,  304,  304,  304,
+      304,  304,  304,  304,  304,  304,  304,  304,  304,  304,
+      304,  304,  304,  304,  304,  304,  304,  304,  307,    0,
+      307,  307,    0,    0,    0,  319,    0,  319,  319,    0,
+        0,    0,  307,  322,    0,  322,  322,    0,  327,    0,
+      327,  327,    0,    0,  307,    0,    0,  307,    0,    0,
+      308,    0,  308,  308,  307,  307,  308,  308,  308,  308,
+      308,  308,  319,    0,  308,  308,  308,  308,  308,  308,
+
+      322,    0,    0,    0,  313,  327,  313,  313,  313,    0,
+      313,  313,  313,  313,  313,  313,    0,  308,  313,  313,
+      313,  313,  313,  313,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  313,  317,  317,  317,  317,  317,  317,  317,  317,
+      317,  317,  317,  317,  317,  317,  317,  317,  317,  317,
+      317,  317,  317,  317,  317,  317,  317,  317,  317,  317,
+      317,  317,  317,  317,  317,  317,  317,  317,  317,  317,
+      325,    0,  325,  325,    0,    0,  325,  325,  325,  325,
+      325,  325,    0,    0,  325,  325,  325,  325,  325,  325,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  325,  326,  326,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  326,  326,  326,  326,
+      326,  326,  326,  326,  326,  326,  329,    0,  329,  329,
+      329,    0,  329,  329,  329,  329,  329,  329,    0,    0,
+      329,  329,  329,  329,  329,  329,  335,    0,  335,  335,
+      331,    0,    0,    0,    0,    0,  331,  331,  331,  331,
+      331,  331,    0,  329,  331,  331,  331,  331,  331,  331,
+
+      332,    0,    0,    0,    0,    0,  332,  332,  332,  332,
+      332,  332,    0,  335,  332,  332,  332,  332,  332,  332,
+      333,    0,  333,  333,    0,    0,  333,  333,  333,  333,
+      333,  333,    0,    0,  333,  333,  333,  333,  333,  333,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  333,  334,  334,
+      334,  334,  334,  334,  334,  334,  334,  334,  334,  334,
+      334,  334,  334,  334,  334,  334,  334,  334,  334,  334,
+      334,  334,  334,  334,  334,  334,  334,  334,  334,  334,
+      334,  334,  334,  334,  334,  334,  336,  336,  336,  336,
+
+      336,  336,  336,  336,  336,  336,  336,  336,  336,  336,
+      336,  336,  336,  336,  336,  336,  336,  336,  336,  336,
+      336,  336,  336,  336,  336,  336,  336,  336,  336,  336,
+      336,  336,  336,  336,  337,    0,  337,  337,  338,    0,
+      338,  338,    0,  339,    0,  339,  339,  340,    0,  340,
+      340,  341,    0,  341,  341,    0,    0,  348,    0,  348,
+      348,  340,    0,    0,  354,    0,  354,  354,    0,    0,
+        0,  337,  339,    0,    0,  338,  340,    0,    0,  339,
+      339,    0,    0,  340,  340,    0,    0,  341,  341,  343,
+        0,  343,  343,  343,  348,  343,  343,  343,  343,  343,
+
+      343,  354,    0,  343,  343,  343,  343,  343,  343,  356,
+        0,  356,  356,  345,    0,    0,    0,    0,    0,  345,
+      345,  345,  345,  345,  345,    0,  343,  345,  345,  345,
+      345,  345,  345,  346,    0,    0,    0,    0,    0,  346,
+      346,  346,  346,  346,  346,    0,  356,  346,  346,  346,
+      346,  346,  346,  347,    0,  347,  347,    0,    0,  347,
+      347,  347,  347,  347,  347,    0,    0,  347,  347,  347,
+      347,  347,  347,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      347,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+
+      349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+      349,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+      349,  349,  349,  349,  349,  349,  349,  349,  349,  351,
+        0,  351,  351,    0,    0,  351,  351,  351,  351,  351,
+      351,    0,    0,  351,  351,  351,  351,  351,  351,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  358,    0,    0,
+        0,    0,    0,  358,  358,  358,  358,  358,  358,    0,
+
+        0,  358,  358,  358,  358,  358,  358,  359,    0,  359,
+      359,    0,    0,  359,  359,  359,  359,  359,  359,    0,
+        0,  359,  359,  359,  359,  359,  359,  361,    0,  361,
+      361,  360,    0,  360,  360,    0,    0,  360,  360,  360,
+      360,  360,  360,    0,  359,  360,  360,  360,  360,  360,
+      360,  370,    0,  370,  370,    0,    0,    0,  377,    0,
+      377,  377,    0,  367,  361,    0,    0,    0,  360,  367,
+      367,  367,  367,  367,  367,    0,    0,  367,  367,  367,
+      367,  367,  367,  368,    0,  368,  368,    0,  370,  368,
+      368,  368,  368,  368,  368,  377,    0,  368,  368,  368,
+
+      368,  368,  368,    0,    0,    0,    0,  369,    0,  369,
+      369,    0,    0,  369,  369,  369,  369,  369,  369,    0,
+      368,  369,  369,  369,  369,  369,  369,    0,    0,    0,
+        0,  374,    0,  374,  374,    0,    0,  374,  374,  374,
+      374,  374,  374,    0,  369,  374,  374,  374,  374,  374,
+      374,  383,    0,  383,  383,  379,    0,  379,  379,  379,
+        0,  379,  379,  379,  379,  379,  379,    0,  374,  379,
+      379,  379,  379,  379,  379,  388,    0,  388,  388,  401,
+        0,  401,  401,  405,    0,  405,  405,  385,  383,  385,
+      385,  385,  379,  385,  385,  385,  385,  385,  385,    0,
+
+        0,  385,  385,  385,  385,  385,  385,    0,    0,    0,
+        0,    0,  388,    0,    0,    0,  401,    0,    0,    0,
+      405,    0,    0,    0,  385,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
+      387,  387,  387,  390,    0,  390,  390,    0,    0,  390,
+      390,  390,  390,  390,  390,    0,    0,  390,  390,  390,
+      390,  390,  390,  391,    0,    0,    0,    0,    0,  391,
+      391,  391,  391,  391,  391,    0,    0,  391,  391,  391,
+
+      391,  391,  391,  392,    0,  392,  392,    0,    0,  392,
+      392,  392,  392,  392,  392,    0,    0,  392,  392,  392,
+      392,  392,  392,  407,    0,  407,  407,  397,    0,    0,
+        0,    0,    0,  397,  397,  397,  397,  397,  397,    0,
+      392,  397,  397,  397,  397,  397,  397,  398,    0,  398,
+      398,    0,    0,  398,  398,  398,  398,  398,  398,    0,
+      407,  398,  398,  398,  398,  398,  398,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  398,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
+      399,  399,  399,  400,    0,  400,  400,    0,    0,  400,
+      400,  400,  400,  400,  400,    0,    0,  400,  400,  400,
+      400,  400,  400,  409,    0,  409,  409,  403,    0,    0,
+        0,    0,    0,  403,  403,  403,  403,  403,  403,    0,
+      400,  403,  403,  403,  403,  403,  403,  404,    0,    0,
+        0,    0,    0,  404,  404,  404,  404,  404,  404,    0,
+      409,  404,  404,  404,  404,  404,  404,  408,  408,  408,
+      408,  408,  408,  408,  408,  408,  408,  408,  408,  408,
+
+      408,  408,  408,  408,  408,  408,  408,  408,  408,  408,
+      408,  408,  408,  408,  408,  408,  408,  408,  408,  408,
+      408,  408,  408,  408,  408,  411,    0,  411,  411,    0,
+        0,  411,  411,  411,  411,  411,  411,    0,    0,  411,
+      411,  411,  411,  411,  411,  414,    0,  414,  414,  412,
+        0,  412,  412,    0,    0,  412,  412,  412,  412,  412,
+      412,    0,  411,  412,  412,  412,  412,  412,  412,  416,
+        0,  416,  416,    0,    0,  416,  416,  416,  416,  416,
+      416,    0,  414,  416,  416,  416,  416,  416,  416,  417,
+        0,  417,  417,    0,    0,  417,  417,  417,  417,  417,
+
+      417,    0,    0,  417,  417,  417,  417,  417,  417,  418,
+        0,  418,  418,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  417,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  418,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1125,10 +1566,12 @@ extern void fb_sha1(void);
   dr{ive}
   vm
   fr{esh}
+  prof{ile} {sym <file>}
+  rew{ind} {secs}
   (? | h{elp})
 */
 
-#line 1132 "src/meta/debug.c"
+#line 1575 "src/meta/debug.c"
 
 #define INITIAL 0
 
@@ -1354,7 +1797,7 @@ YY_DECL
 
 
 
-#line 1358 "src/meta/debug.c"
+#line 1801 "src/meta/debug.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1382,13 +1825,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 411 )
+				if ( yy_current_state >= 421 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 1976 );
+		while ( yy_base[yy_current_state] != 4048 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -1415,7 +1858,7 @@ do_action:	/* This label is used only to access EOF actions. */
 case 1:
 /* rule 1 can match eol */
 YY_RULE_SETUP
-#line 108 "src/meta/debug.l"
+#line 110 "src/meta/debug.l"
 {
     /* mem <addrs> <len> */
     int do_ascii = 0;
@@ -1433,7 +1876,7 @@ YY_RULE_SETUP
 case 2:
 /* rule 2 can match eol */
 YY_RULE_SETUP
-#line 122 "src/meta/debug.l"
+#line 124 "src/meta/debug.l"
 {
     /* mem /<bank>/<addrs> <len> */
     int do_ascii = 0;
@@ -1454,7 +1897,7 @@ YY_RULE_SETUP
 case 3:
 /* rule 3 can match eol */
 YY_RULE_SETUP
-#line 139 "src/meta/debug.l"
+#line 141 "src/meta/debug.l"
 {
     /* mem <addrs> */
     int do_ascii = 0;
@@ -1471,7 +1914,7 @@ YY_RULE_SETUP
 case 4:
 /* rule 4 can match eol */
 YY_RULE_SETUP
-#line 152 "src/meta/debug.l"
+#line 154 "src/meta/debug.l"
 {
     /* mem /<bank>/<addrs> */
     int do_ascii = 0;
@@ -1491,7 +1934,7 @@ YY_RULE_SETUP
 case 5:
 /* rule 5 can match eol */
 YY_RULE_SETUP
-#line 168 "src/meta/debug.l"
+#line 170 "src/meta/debug.l"
 {
     /* mem +<len> */
     int do_ascii = 0;
@@ -1509,7 +1952,7 @@ YY_RULE_SETUP
 case 6:
 /* rule 6 can match eol */
 YY_RULE_SETUP
-#line 182 "src/meta/debug.l"
+#line 184 "src/meta/debug.l"
 {
     /* dump mem from current location */
     int do_ascii = 0;
@@ -1523,7 +1966,7 @@ YY_RULE_SETUP
 case 7:
 /* rule 7 can match eol */
 YY_RULE_SETUP
-#line 192 "src/meta/debug.l"
+#line 194 "src/meta/debug.l"
 {
     /* dump mem from lc<bank> <addrs> <len> */
     int do_ascii = 0;
@@ -1545,7 +1988,7 @@ YY_RULE_SETUP
 case 8:
 /* rule 8 can match eol */
 YY_RULE_SETUP
-#line 210 "src/meta/debug.l"
+#line 212 "src/meta/debug.l"
 {
     /* dump mem from lc<bank> /<bank>/<addrs> <len> */
     int do_ascii = 0;
@@ -1571,7 +2014,7 @@ YY_RULE_SETUP
 case 9:
 /* rule 9 can match eol */
 YY_RULE_SETUP
-#line 232 "src/meta/debug.l"
+#line 234 "src/meta/debug.l"
 {
     /* dump mem from lc<bank> <addrs> */
     int do_ascii = 0;
@@ -1592,7 +2035,7 @@ YY_RULE_SETUP
 case 10:
 /* rule 10 can match eol */
 YY_RULE_SETUP
-#line 249 "src/meta/debug.l"
+#line 251 "src/meta/debug.l"
 {
     /* dump mem from lc<bank> /<bank>/<addrs> */
     int do_ascii = 0;
@@ -1617,7 +2060,7 @@ YY_RULE_SETUP
 case 11:
 /* rule 11 can match eol */
 YY_RULE_SETUP
-#line 270 "src/meta/debug.l"
+#line 272 "src/meta/debug.l"
 {
     /* disassemble at <addrs> <len> */
     while (!isspace(*debugtext)) ++debugtext;
@@ -1632,7 +2075,7 @@ YY_RULE_SETUP
 case 12:
 /* rule 12 can match eol */
 YY_RULE_SETUP
-#line 281 "src/meta/debug.l"
+#line 283 "src/meta/debug.l"
 {
     /* disassemble at /<bank>/<addrs> <len> */
     while (*debugtext != '/') ++debugtext;
@@ -1650,7 +2093,7 @@ YY_RULE_SETUP
 case 13:
 /* rule 13 can match eol */
 YY_RULE_SETUP
-#line 295 "src/meta/debug.l"
+#line 297 "src/meta/debug.l"
 {
     /* disassemble at <addrs> */
     while (!isspace(*debugtext)) ++debugtext;
@@ -1666,7 +2109,7 @@ YY_RULE_SETUP
 case 14:
 /* rule 14 can match eol */
 YY_RULE_SETUP
-#line 307 "src/meta/debug.l"
+#line 309 "src/meta/debug.l"
 {
     /* disassemble at /<bank>/<addrs> */
     while (*debugtext != '/') ++debugtext;
@@ -1685,7 +2128,7 @@ YY_RULE_SETUP
 case 15:
 /* rule 15 can match eol */
 YY_RULE_SETUP
-#line 322 "src/meta/debug.l"
+#line 324 "src/meta/debug.l"
 {
     /* disassemble current location +<len> */
     while (*debugtext != '+') ++debugtext;
@@ -1699,7 +2142,7 @@ YY_RULE_SETUP
 case 16:
 /* rule 16 can match eol */
 YY_RULE_SETUP
-#line 332 "src/meta/debug.l"
+#line 334 "src/meta/debug.l"
 {
     /* disassemble current location */
     disasm(run_args.cpu65_pc, 256, 0, -1);
@@ -1709,7 +2152,7 @@ YY_RULE_SETUP
 case 17:
 /* rule 17 can match eol */
 YY_RULE_SETUP
-#line 338 "src/meta/debug.l"
+#line 340 "src/meta/debug.l"
 {
     /* disassemble language<bank> <addr> <len> */
     int lc;
@@ -1728,7 +2171,7 @@ YY_RULE_SETUP
 case 18:
 /* rule 18 can match eol */
 YY_RULE_SETUP
-#line 353 "src/meta/debug.l"
+#line 355 "src/meta/debug.l"
 {
     /* disassemble language<bank> /<bank>/<addr> <len> */
     int lc;
@@ -1752,7 +2195,7 @@ YY_RULE_SETUP
 case 19:
 /* rule 19 can match eol */
 YY_RULE_SETUP
-#line 373 "src/meta/debug.l"
+#line 375 "src/meta/debug.l"
 {
     /* disassemble language<bank> <addr> */
     int lc;
@@ -1770,7 +2213,7 @@ YY_RULE_SETUP
 case 20:
 /* rule 20 can match eol */
 YY_RULE_SETUP
-#line 387 "src/meta/debug.l"
+#line 389 "src/meta/debug.l"
 {
     /* disassemble language<bank> /<bank>/<addr> */
     int lc;
@@ -1793,7 +2236,7 @@ YY_RULE_SETUP
 case 21:
 /* rule 21 can match eol */
 YY_RULE_SETUP
-#line 406 "src/meta/debug.l"
+#line 408 "src/meta/debug.l"
 {
     /* show cpu state */
     show_regs();
@@ -1803,7 +2246,7 @@ YY_RULE_SETUP
 case 22:
 /* rule 22 can match eol */
 YY_RULE_SETUP
-#line 412 "src/meta/debug.l"
+#line 414 "src/meta/debug.l"
 {
     /* set memory <addr> : <hex string> */
     arg1 = (int)strtol(debugtext, &debugtext, 16);
@@ -1818,7 +2261,7 @@ YY_RULE_SETUP
 case 23:
 /* rule 23 can match eol */
 YY_RULE_SETUP
-#line 423 "src/meta/debug.l"
+#line 425 "src/meta/debug.l"
 {
     /* set LC memory <addr> lc1|lc2 : <hex string> */
     int lc;
@@ -1837,7 +2280,7 @@ YY_RULE_SETUP
 case 24:
 /* rule 24 can match eol */
 YY_RULE_SETUP
-#line 438 "src/meta/debug.l"
+#line 440 "src/meta/debug.l"
 {
     /* bload <file> /<bank>/<addr> */
     FILE *fp = NULL;
@@ -1878,7 +2321,7 @@ YY_RULE_SETUP
 case 25:
 /* rule 25 can match eol */
 YY_RULE_SETUP
-#line 475 "src/meta/debug.l"
+#line 477 "src/meta/debug.l"
 {
 
     stepping_struct_s s = {
@@ -1897,7 +2340,7 @@ YY_RULE_SETUP
 case 26:
 /* rule 26 can match eol */
 YY_RULE_SETUP
-#line 490 "src/meta/debug.l"
+#line 492 "src/meta/debug.l"
 {
 
     while (!isspace(*debugtext)) ++debugtext;
@@ -1921,7 +2364,7 @@ YY_RULE_SETUP
 case 27:
 /* rule 27 can match eol */
 YY_RULE_SETUP
-#line 510 "src/meta/debug.l"
+#line 512 "src/meta/debug.l"
 {
 
     stepping_struct_s s = {
@@ -1936,7 +2379,7 @@ YY_RULE_SETUP
 case 28:
 /* rule 28 can match eol */
 YY_RULE_SETUP
-#line 521 "src/meta/debug.l"
+#line 523 "src/meta/debug.l"
 {
     /* step until PC == next instruction.  good for finishing backward
        loops */
@@ -1983,7 +2426,7 @@ YY_RULE_SETUP
 case 29:
 /* rule 29 can match eol */
 YY_RULE_SETUP
-#line 564 "src/meta/debug.l"
+#line 566 "src/meta/debug.l"
 {
     /* jump to addrs and run while remaining in debugger console */
     while (!isspace(*debugtext)) ++debugtext;
@@ -2002,7 +2445,7 @@ YY_RULE_SETUP
 case 30:
 /* rule 30 can match eol */
 YY_RULE_SETUP
-#line 579 "src/meta/debug.l"
+#line 581 "src/meta/debug.l"
 {
     stepping_struct_s s = {
         .step_type = GOING
@@ -2015,7 +2458,7 @@ YY_RULE_SETUP
 case 31:
 /* rule 31 can match eol */
 YY_RULE_SETUP
-#line 588 "src/meta/debug.l"
+#line 590 "src/meta/debug.l"
 {
     /* set watchpoint */
     set_halt(watchpoints, run_args.cpu65_pc);
@@ -2025,7 +2468,7 @@ YY_RULE_SETUP
 case 32:
 /* rule 32 can match eol */
 YY_RULE_SETUP
-#line 594 "src/meta/debug.l"
+#line 596 "src/meta/debug.l"
 {
     /* set watchpoint */
     while (!isspace(*debugtext)) ++debugtext;
@@ -2043,7 +2486,7 @@ YY_RULE_SETUP
 case 33:
 /* rule 33 can match eol */
 YY_RULE_SETUP
-#line 609 "src/meta/debug.l"
+#line 611 "src/meta/debug.l"
 {
     /* set breakpoint */
     set_halt(breakpoints, run_args.cpu65_pc);
@@ -2053,7 +2496,7 @@ YY_RULE_SETUP
 case 34:
 /* rule 34 can match eol */
 YY_RULE_SETUP
-#line 615 "src/meta/debug.l"
+#line 617 "src/meta/debug.l"
 {
     /* set breakpoint */
     while (!isspace(*debugtext)) ++debugtext;
@@ -2071,7 +2514,7 @@ YY_RULE_SETUP
 case 35:
 /* rule 35 can match eol */
 YY_RULE_SETUP
-#line 629 "src/meta/debug.l"
+#line 631 "src/meta/debug.l"
 {
     /* set breakpoint */
     while (!(*debugtext == 'p')) ++debugtext;
@@ -2090,7 +2533,7 @@ YY_RULE_SETUP
 case 36:
 /* rule 36 can match eol */
 YY_RULE_SETUP
-#line 644 "src/meta/debug.l"
+#line 646 "src/meta/debug.l"
 {
     /* set opcode breakpoints on 65c02 instructions */
     set_halt_65c02();
@@ -2100,7 +2543,7 @@ YY_RULE_SETUP
 case 37:
 /* rule 37 can match eol */
 YY_RULE_SETUP
-#line 650 "src/meta/debug.l"
+#line 652 "src/meta/debug.l"
 {
     /* ignore everything */
     clear_halt(watchpoints, 0);
@@ -2111,7 +2554,7 @@ YY_RULE_SETUP
 case 38:
 /* rule 38 can match eol */
 YY_RULE_SETUP
-#line 657 "src/meta/debug.l"
+#line 659 "src/meta/debug.l"
 {
     /* ignore <watchpt> ... */
 
@@ -2132,7 +2575,7 @@ YY_RULE_SETUP
 case 39:
 /* rule 39 can match eol */
 YY_RULE_SETUP
-#line 675 "src/meta/debug.l"
+#line 677 "src/meta/debug.l"
 {
     /* clear everything */
     clear_halt(breakpoints, 0);
@@ -2143,7 +2586,7 @@ YY_RULE_SETUP
 case 40:
 /* rule 40 can match eol */
 YY_RULE_SETUP
-#line 682 "src/meta/debug.l"
+#line 684 "src/meta/debug.l"
 {
     /* clear <breakpt> ... */
     while (!isspace(*debugtext)) ++debugtext;
@@ -2163,7 +2606,7 @@ YY_RULE_SETUP
 case 41:
 /* rule 41 can match eol */
 YY_RULE_SETUP
-#line 698 "src/meta/debug.l"
+#line 700 "src/meta/debug.l"
 {
     /* clear <opcode breakpt> ... */
     while (!(*debugtext == 'p')) ++debugtext;
@@ -2185,7 +2628,7 @@ YY_RULE_SETUP
 case 42:
 /* rule 42 can match eol */
 YY_RULE_SETUP
-#line 716 "src/meta/debug.l"
+#line 718 "src/meta/debug.l"
 {
     /* clear 65c02 ... */
     clear_halt_65c02();
@@ -2195,7 +2638,7 @@ YY_RULE_SETUP
 case 43:
 /* rule 43 can match eol */
 YY_RULE_SETUP
-#line 722 "src/meta/debug.l"
+#line 724 "src/meta/debug.l"
 {
     /* show breakpoints and watchpoints */
     show_breakpts();
@@ -2205,7 +2648,7 @@ YY_RULE_SETUP
 case 44:
 /* rule 44 can match eol */
 YY_RULE_SETUP
-#line 728 "src/meta/debug.l"
+#line 730 "src/meta/debug.l"
 {
     /* show opcode breakpoints */
     show_opcode_breakpts();
@@ -2215,7 +2658,7 @@ YY_RULE_SETUP
 case 45:
 /* rule 45 can match eol */
 YY_RULE_SETUP
-#line 734 "src/meta/debug.l"
+#line 736 "src/meta/debug.l"
 {
     /* search main memory for <bytes> */
     while (!isspace(*debugtext)) ++debugtext;
@@ -2229,7 +2672,7 @@ YY_RULE_SETUP
 case 46:
 /* rule 46 can match eol */
 YY_RULE_SETUP
-#line 744 "src/meta/debug.l"
+#line 746 "src/meta/debug.l"
 {
     /* search memory<bank> for <bytes> */
     while (*debugtext != '/') ++debugtext;
@@ -2246,7 +2689,7 @@ YY_RULE_SETUP
 case 47:
 /* rule 47 can match eol */
 YY_RULE_SETUP
-#line 757 "src/meta/debug.l"
+#line 759 "src/meta/debug.l"
 {
     /* search LC<bank> for <bytes> */
     int lc;
@@ -2266,7 +2709,7 @@ YY_RULE_SETUP
 case 48:
 /* rule 48 can match eol */
 YY_RULE_SETUP
-#line 773 "src/meta/debug.l"
+#line 775 "src/meta/debug.l"
 {
     /* search LC<bank> memory<bank> for <bytes> */
     int lc;
@@ -2289,7 +2732,7 @@ YY_RULE_SETUP
 case 49:
 /* rule 49 can match eol */
 YY_RULE_SETUP
-#line 792 "src/meta/debug.l"
+#line 794 "src/meta/debug.l"
 {
     /* type ASCII to emulator */
     char buf[DEBUG_BUFSZ];
@@ -2315,7 +2758,7 @@ YY_RULE_SETUP
 case 50:
 /* rule 50 can match eol */
 YY_RULE_SETUP
-#line 814 "src/meta/debug.l"
+#line 816 "src/meta/debug.l"
 {
     /* load/type ASCII <file> */
     FILE *fp = NULL;
@@ -2361,11 +2804,11 @@ YY_RULE_SETUP
 case 51:
 /* rule 51 can match eol */
 YY_RULE_SETUP
-#line 856 "src/meta/debug.l"
+#line 858 "src/meta/debug.l"
 {
 #if CPU_TRACING
     char *buf = NULL;
-    asprintf(&buf, "%s/%s", HOMEDIR, "cputrace.txt");
+    ASPRINTF(&buf, "%s/%s", HOMEDIR, "cputrace.txt");
     cpu65_trace_toggle(buf);
     FREE(buf);
 #else
@@ -2376,11 +2819,26 @@ YY_RULE_SETUP
 case 52:
 /* rule 52 can match eol */
 YY_RULE_SETUP
-#line 867 "src/meta/debug.l"
+#line 869 "src/meta/debug.l"
+{
+#if CPU_TRACING
+    char *buf = NULL;
+    ASPRINTF(&buf, "%s/%s", HOMEDIR, "cputrace.bin");
+    cpu65_trace_toggleBinary(buf);
+    FREE(buf);
+#else
+    LOG("CPU tracing not enabled...");
+#endif
+}
+	YY_BREAK
+case 53:
+/* rule 53 can match eol */
+YY_RULE_SETUP
+#line 880 "src/meta/debug.l"
 {
 #if DISK_TRACING
     char *buf = NULL;
-    asprintf(&buf, "%s/%s", HOMEDIR, "disktrace.txt");
+    ASPRINTF(&buf, "%s/%s", HOMEDIR, "disktrace.txt");
     disk6_traceToggle(buf, NULL);
     FREE(buf);
 #else
@@ -2388,67 +2846,156 @@ YY_RULE_SETUP
 #endif
 }
 	YY_BREAK
-case 53:
-/* rule 53 can match eol */
+case 54:
+/* rule 54 can match eol */
 YY_RULE_SETUP
-#line 878 "src/meta/debug.l"
+#line 891 "src/meta/debug.l"
+{
+    /* toggle the profiler, writing the report and flame graph (collapsed stacks) when stopped */
+    if (!profiler_isProfiling()) {
+        if (profiler_begin()) {
+            sprintf(second_buf[num_buffer_lines++], "profiling...");
+        } else {
+            sprintf(second_buf[num_buffer_lines++], "profiling not supported");
+        }
+        return PROFILE;
+    }
+
+    profiler_end();
+
+    char *buf = NULL;
+    ASPRINTF(&buf, "%s/%s", HOMEDIR, "a2_profile.txt");
+    if (buf && profiler_writeReport(buf)) {
+        sprintf(second_buf[num_buffer_lines++], "wrote ~/a2_profile.txt");
+    }
+    FREE(buf);
+    ASPRINTF(&buf, "%s/%s", HOMEDIR, "a2_profile.folded");
+    if (buf && profiler_writeFlameGraph(buf)) {
+        sprintf(second_buf[num_buffer_lines++], "wrote ~/a2_profile.folded");
+    }
+    FREE(buf);
+    return PROFILE;
+}
+	YY_BREAK
+case 55:
+/* rule 55 can match eol */
+YY_RULE_SETUP
+#line 918 "src/meta/debug.l"
+{
+    /* load symbols for the profiler exports */
+    char buf[DEBUG_BUFSZ];
+
+    while (!isspace(*debugtext)) ++debugtext;
+    while (isspace(*debugtext)) ++debugtext;
+    while (!isspace(*debugtext)) ++debugtext;
+    while (isspace(*debugtext)) ++debugtext;
+
+    strncpy(buf, debugtext, DEBUG_BUFSZ-1);
+    buf[DEBUG_BUFSZ-1] = '\0';
+    int len = (int)strlen(buf);
+    while (len && isspace(buf[len-1])) buf[--len] = '\0';
+
+    int count = profiler_loadSymbols(buf);
+    if (count < 0) {
+        sprintf(second_buf[num_buffer_lines++], "problem: %.29s", buf);
+    } else {
+        sprintf(second_buf[num_buffer_lines++], "loaded %d symbols", count);
+    }
+    return PROFILE;
+}
+	YY_BREAK
+case 56:
+/* rule 56 can match eol */
+YY_RULE_SETUP
+#line 941 "src/meta/debug.l"
+{
+    /* restore the rewind snapshot taken a second ago */
+    if (emulator_rewind(1)) {
+        sprintf(second_buf[num_buffer_lines++], "rewound (%u secs left)", emulator_rewindAvailable());
+    } else {
+        sprintf(second_buf[num_buffer_lines++], "nothing to rewind");
+    }
+    return REWIND;
+}
+	YY_BREAK
+case 57:
+/* rule 57 can match eol */
+YY_RULE_SETUP
+#line 951 "src/meta/debug.l"
+{
+    /* restore the rewind snapshot taken <secs> ago */
+    while (!isspace(*debugtext)) ++debugtext;
+
+    arg1 = (int)strtol(debugtext, &debugtext, 10);
+    if (emulator_rewind((unsigned int)arg1)) {
+        sprintf(second_buf[num_buffer_lines++], "rewound (%u secs left)", emulator_rewindAvailable());
+    } else {
+        sprintf(second_buf[num_buffer_lines++], "nothing to rewind");
+    }
+    return REWIND;
+}
+	YY_BREAK
+case 58:
+/* rule 58 can match eol */
+YY_RULE_SETUP
+#line 964 "src/meta/debug.l"
 {
     /* display language card settings */
     show_lc_info();
     return LC;
 }
 	YY_BREAK
-case 54:
-/* rule 54 can match eol */
+case 59:
+/* rule 59 can match eol */
 YY_RULE_SETUP
-#line 884 "src/meta/debug.l"
+#line 970 "src/meta/debug.l"
 {
     /* show disk settings */
     show_disk_info();
     return DRIVE;
 }
 	YY_BREAK
-case 55:
-/* rule 55 can match eol */
+case 60:
+/* rule 60 can match eol */
 YY_RULE_SETUP
-#line 890 "src/meta/debug.l"
+#line 976 "src/meta/debug.l"
 {
     /* show other VM softswitch settings */
     show_misc_info();
     return VM;
 }
 	YY_BREAK
-case 56:
-/* rule 56 can match eol */
+case 61:
+/* rule 61 can match eol */
 YY_RULE_SETUP
-#line 896 "src/meta/debug.l"
+#line 982 "src/meta/debug.l"
 {
     /* refresh the screen */
     clear_debugger_screen();
 }
 	YY_BREAK
-case 57:
-/* rule 57 can match eol */
+case 62:
+/* rule 62 can match eol */
 YY_RULE_SETUP
-#line 901 "src/meta/debug.l"
+#line 987 "src/meta/debug.l"
 {
     fb_sha1();
     return FBSHA1;
 }
 	YY_BREAK
-case 58:
-/* rule 58 can match eol */
+case 63:
+/* rule 63 can match eol */
 YY_RULE_SETUP
-#line 906 "src/meta/debug.l"
+#line 992 "src/meta/debug.l"
 {
     display_help();
     return HELP;
 }
 	YY_BREAK
-case 59:
-/* rule 59 can match eol */
+case 64:
+/* rule 64 can match eol */
 YY_RULE_SETUP
-#line 911 "src/meta/debug.l"
+#line 997 "src/meta/debug.l"
 {
     /* bsave <file> /<bank>/<addr> <len> */
     /* save memory dump to file */
@@ -2500,19 +3047,19 @@ YY_RULE_SETUP
     return BSAVE;
 }
 	YY_BREAK
-case 60:
-/* rule 60 can match eol */
+case 65:
+/* rule 65 can match eol */
 YY_RULE_SETUP
-#line 962 "src/meta/debug.l"
+#line 1048 "src/meta/debug.l"
 {
     /* log debugger output to file - not implemented */
     return LOG;
 }
 	YY_BREAK
-case 61:
-/* rule 61 can match eol */
+case 66:
+/* rule 66 can match eol */
 YY_RULE_SETUP
-#line 967 "src/meta/debug.l"
+#line 1053 "src/meta/debug.l"
 {
     /* save apple2 state to a .img file - not implemented I'd like to
      * be compatible with the applePC emulator's .img format. anyone
@@ -2521,23 +3068,23 @@ YY_RULE_SETUP
     return SAVE;
 }
 	YY_BREAK
-case 62:
-/* rule 62 can match eol */
+case 67:
+/* rule 67 can match eol */
 YY_RULE_SETUP
-#line 976 "src/meta/debug.l"
+#line 1062 "src/meta/debug.l"
 /* ignore newlines */
 	YY_BREAK
-case 63:
+case 68:
 YY_RULE_SETUP
-#line 978 "src/meta/debug.l"
+#line 1064 "src/meta/debug.l"
 /* ignore extraneous characters */
 	YY_BREAK
-case 64:
+case 69:
 YY_RULE_SETUP
-#line 981 "src/meta/debug.l"
+#line 1067 "src/meta/debug.l"
 ECHO;
 	YY_BREAK
-#line 2541 "src/meta/debug.c"
+#line 3088 "src/meta/debug.c"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
@@ -2822,7 +3369,7 @@ static int yy_get_next_buffer (void)
 
 	for ( yy_cp = (yytext_ptr) + YY_MORE_ADJ; yy_cp < (yy_c_buf_p); ++yy_cp )
 		{
-		YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 60);
+		YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 37);
 		if ( yy_accept[yy_current_state] )
 			{
 			(yy_last_accepting_state) = yy_current_state;
@@ -2831,7 +3378,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 411 )
+			if ( yy_current_state >= 421 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
@@ -2850,7 +3397,7 @@ static int yy_get_next_buffer (void)
 	int yy_is_jam;
     	char *yy_cp = (yy_c_buf_p);
 
-	YY_CHAR yy_c = 60;
+	YY_CHAR yy_c = 37;
 	if ( yy_accept[yy_current_state] )
 		{
 		(yy_last_accepting_state) = yy_current_state;
@@ -2859,11 +3406,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 411 )
+		if ( yy_current_state >= 421 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
-	yy_is_jam = (yy_current_state == 410);
+	yy_is_jam = (yy_current_state == 420);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3541,8 +4088,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 981 "src/meta/debug.l"
-
+#line 1067 "src/meta/debug.l"
 
 
 
@@ -3553,7 +4099,7 @@ int yywrap () {
 /* initialize the buffer - needed each time through */
 void init_lex (char *str, int size) {
     if (buffer) yy_delete_buffer(buffer);
-    buffer = yy_scan_buffer(str,size);
+    buffer = yy_scan_buffer(str, size);
 
     if (!buffer) {	/* oops */
 	printf("lex buffer not big enough\n");
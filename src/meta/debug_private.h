@@ -55,7 +55,9 @@ enum {
     LOG,
     MEM,
     OPCODES,
+    PROFILE,
     REGS,
+    REWIND,
     SAVE,
     SEARCH,
     SETMEM,
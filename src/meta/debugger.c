@@ -867,6 +867,47 @@ void clear_halt_65c02() {
     clear_halt_opcode((uint8_t)0xF2); clear_halt_opcode((uint8_t)0xFA);
 }
 
+/* -------------------------------------------------------------------------
+    arm_haltmap () - hand breakpoints, watchpoints and opcode breakpoints to
+        the CPU core as bitmaps.  The CPU thread then runs whole quanta and
+        cpu65_run() only returns early after an instruction that hits one
+   ------------------------------------------------------------------------- */
+#if CPU65_HALTMAP_INLINE
+static void arm_haltmap(void) {
+    static uint8_t haltmap[HALTMAP_SIZ];
+    memset(haltmap, 0x0, sizeof(haltmap));
+
+    for (int i = 0; i < MAX_BRKPTS; i++)
+    {
+        if (breakpoints[i] >= 0)
+        {
+            haltmap[HALTMAP_EXEC + (breakpoints[i]>>3)] |= (1 << (breakpoints[i] & 0x7));
+        }
+        if (watchpoints[i] >= 0)
+        {
+            haltmap[HALTMAP_READ + (watchpoints[i]>>3)] |= (1 << (watchpoints[i] & 0x7));
+            haltmap[HALTMAP_WRITE + (watchpoints[i]>>3)] |= (1 << (watchpoints[i] & 0x7));
+        }
+    }
+
+    for (int op = 0; op < 0x100; op++)
+    {
+        if (op_breakpoints[op])
+        {
+            haltmap[HALTMAP_OPCODE + (op>>3)] |= (1 << (op & 0x7));
+        }
+    }
+
+    run_args.cpu65_halted = 0;
+    run_args.cpu65_haltmap = haltmap;
+}
+#endif
+
+static void disarm_haltmap(void) {
+    run_args.cpu65_haltmap = NULL;
+    run_args.cpu65_halted = 0;
+}
+
 /* -------------------------------------------------------------------------
     at_haltpt () - tests if at haltpt
         returns 0 = no breaks or watches
@@ -1094,7 +1135,7 @@ void fb_sha1() {
     uint8_t md[SHA_DIGEST_LENGTH];
     char buf[(SHA_DIGEST_LENGTH*2)+1];
 
-    PIXEL_TYPE *fb = display_getCurrentFramebuffer();
+    PIXEL_TYPE *fb = display_peekCurrentFramebuffer();
     SHA1((const unsigned char *)fb, SCANWIDTH*SCANHEIGHT*PIXEL_STRIDE, md);
 
     int i=0;
@@ -1134,6 +1175,17 @@ static int begin_cpu_stepping() {
         stepping_struct.step_text = NULL;
     }
 
+#if CPU65_HALTMAP_INLINE
+    // only step/next/finish/until and deterministic typing need the CPU to stop after every instruction
+    bool run_free = (stepping_struct.step_type == GOING) && !stepping_struct.step_deterministically;
+#   if TESTING
+    run_free = run_free && !shouldBreakCallback;
+#   endif
+    if (run_free) {
+        arm_haltmap();
+    }
+#endif
+
     do {
         if (stepping_struct.step_text && !((apple_ii_64k[0][0xC000] & 0x80) || (apple_ii_64k[1][0xC000] & 0x80)) ) {
             uint8_t text_ch = (uint8_t)stepping_struct.step_text[0];
@@ -1141,8 +1193,7 @@ static int begin_cpu_stepping() {
                 text_ch = '\r';
             }
 
-            apple_ii_64k[0][0xC000] = text_ch | 0x80;
-            apple_ii_64k[1][0xC000] = text_ch | 0x80;
+            replay_input(REPLAY_INPUT_KEY, text_ch | 0x80);
 
             ++stepping_struct.step_text;
             if (stepping_struct.step_text[0] == '\0') {
@@ -1170,6 +1221,8 @@ static int begin_cpu_stepping() {
         }
     } while (!stepping_struct.should_break);
 
+    disarm_haltmap();
+
     if ((err = pthread_cond_signal(&cpu_thread_cond))) {
         LOG("pthread_cond_signal : %d", err);
     }
@@ -1312,6 +1365,8 @@ void display_help() {
     sprintf(second_buf[i++], "bsave <filename> </bank/addr> <len>  ");
     sprintf(second_buf[i++], "bload <filename> </bank/addr>        ");
     sprintf(second_buf[i++], "fr{esh}                              ");
+    sprintf(second_buf[i++], "prof{ile} {sym <filename>}           ");
+    sprintf(second_buf[i++], "rew{ind} {secs}                      ");
     sprintf(second_buf[i++], "(h{elp} | ?)                         ");
     num_buffer_lines = i;
 }
@@ -0,0 +1,638 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+#include "common.h"
+
+#define PROFILER_MAX_DEPTH 128          // JSR pushes 2 bytes, so deeper stacks are not trackable anyway
+#define PROFILER_MAX_NODES (1<<20)
+#define PROFILER_NODES_CHUNK 4096
+#define PROFILER_REPORT_ROWS 64
+#define PROFILER_SYMBOL_SPAN 0x100      // report addresses as SYMBOL+offset within this distance
+#define PROFILER_NAME_MAX 64
+
+#define OPCODE_BRK 0x00
+#define OPCODE_JSR 0x20
+
+typedef enum profiler_bank_t {
+    PROFILER_BANK_MAIN = 0,
+    PROFILER_BANK_AUX,
+    PROFILER_BANK_ROM,
+    PROFILER_BANK_LC1,
+    PROFILER_BANK_LC2,
+    PROFILER_BANK_LC,
+    PROFILER_BANK_AUXLC1,
+    PROFILER_BANK_AUXLC2,
+    PROFILER_BANK_AUXLC,
+    PROFILER_BANK_IO,
+    NUM_PROFILER_BANKS,
+} profiler_bank_t;
+
+static const char *const bank_names[NUM_PROFILER_BANKS] = {
+    "main", "aux", "rom", "lc1", "lc2", "lc", "auxlc1", "auxlc2", "auxlc", "io",
+};
+
+typedef enum profiler_call_t {
+    PROFILER_CALL_ROOT = 0,
+    PROFILER_CALL_JSR,
+    PROFILER_CALL_BRK,
+    PROFILER_CALL_IRQ,
+} profiler_call_t;
+
+typedef struct profiler_counts_s {
+    uint64_t cycles[65536];
+    uint32_t hits[65536];
+} profiler_counts_s;
+
+// Call tree node : a routine entry reached through a particular chain of callers
+typedef struct profiler_node_s {
+    uint64_t cycles;    // self cycles
+    uint32_t parent;
+    uint32_t child;     // first callee (0 : none)
+    uint32_t sibling;   // next callee of parent (0 : none)
+    uint16_t pc;
+    uint8_t bank;
+    uint8_t call;       // profiler_call_t
+} profiler_node_s;
+
+typedef struct profiler_frame_s {
+    uint32_t node;
+    uint8_t sp;         // stack pointer inside the routine, the frame unwinds once SP rises above it
+} profiler_frame_s;
+
+typedef struct profiler_s {
+    profiler_counts_s *counts[NUM_PROFILER_BANKS];
+
+    profiler_node_s *nodes;
+    uint32_t numNodes;
+    uint32_t capNodes;
+
+    profiler_frame_s frames[PROFILER_MAX_DEPTH];
+    unsigned int depth;
+    unsigned long overflows;    // calls beyond PROFILER_MAX_DEPTH (attributed to the deepest tracked routine)
+    uint32_t current;           // node of the top frame (0 : root)
+
+    uint16_t pc;                // start PC and bank of the instruction being executed
+    uint8_t bank;
+
+    uint64_t totalCycles;
+    uint64_t instructions;
+} profiler_s;
+
+typedef struct profiler_symbol_s {
+    uint16_t addr;
+    char *name;
+} profiler_symbol_s;
+
+static VM_LOCAL profiler_s *profile = NULL;
+static VM_LOCAL profiler_symbol_s *symbols = NULL;
+static VM_LOCAL unsigned int numSymbols = 0;
+
+// ----------------------------------------------------------------------------
+// Sampling
+
+static inline bool _profiler_inRange(uintptr_t host, const void *base, size_t len, size_t *offset) {
+    if (host >= (uintptr_t)base && host < (uintptr_t)base + len) {
+        *offset = host - (uintptr_t)base;
+        return true;
+    }
+    return false;
+}
+
+// Bank of the memory an instruction at pc is fetched from, derived from the same run_args base pointer the CPU core
+// fetches through (so this tracks RAMRD/ALTZP/80STORE/language card switches without any softswitch bookkeeping)
+static uint8_t _profiler_bank(uint16_t pc) {
+    uint8_t off = cpu65_vmem_rbase[pc>>8];
+    if (!off) {
+        return PROFILER_BANK_IO;
+    }
+
+    uint8_t *base = *(uint8_t **)((uint8_t *)&run_args + off);
+    uintptr_t host = (uintptr_t)base + pc;
+    size_t offset = 0;
+    if (_profiler_inRange(host, apple_ii_64k[0], sizeof(apple_ii_64k[0]), &offset)) {
+        return pc < 0xC000 ? PROFILER_BANK_MAIN : PROFILER_BANK_ROM;
+    }
+    if (_profiler_inRange(host, apple_ii_64k[1], sizeof(apple_ii_64k[1]), &offset)) {
+        return pc < 0xC000 ? PROFILER_BANK_AUX : PROFILER_BANK_ROM;
+    }
+    if (_profiler_inRange(host, language_banks, sizeof(language_banks), &offset)) {
+        // bank 2 is the first 4K of each language_banks[], bank 1 the second
+        bool bank1 = (offset % sizeof(language_banks[0])) >= 0x1000;
+        if (offset >= sizeof(language_banks[0])) {
+            return bank1 ? PROFILER_BANK_AUXLC1 : PROFILER_BANK_AUXLC2;
+        }
+        return bank1 ? PROFILER_BANK_LC1 : PROFILER_BANK_LC2;
+    }
+    if (_profiler_inRange(host, language_card, sizeof(language_card), &offset)) {
+        return (offset >= sizeof(language_card[0])) ? PROFILER_BANK_AUXLC : PROFILER_BANK_LC;
+    }
+
+    return PROFILER_BANK_IO;
+}
+
+static uint32_t _profiler_callee(profiler_s *p, profiler_call_t call) {
+    uint32_t parent = p->current;
+
+    for (uint32_t idx = p->nodes[parent].child; idx; idx = p->nodes[idx].sibling) {
+        profiler_node_s *node = &p->nodes[idx];
+        if (node->pc == p->pc && node->bank == p->bank && node->call == call) {
+            return idx;
+        }
+    }
+
+    if (p->numNodes == p->capNodes) {
+        if (p->capNodes >= PROFILER_MAX_NODES) {
+            return parent;
+        }
+        profiler_node_s *nodes = REALLOC(p->nodes, (p->capNodes + PROFILER_NODES_CHUNK) * sizeof(profiler_node_s));
+        if (!nodes) {
+            return parent;
+        }
+        p->nodes = nodes;
+        p->capNodes += PROFILER_NODES_CHUNK;
+    }
+
+    uint32_t idx = p->numNodes++;
+    p->nodes[idx] = (profiler_node_s){
+        .parent = parent,
+        .sibling = p->nodes[parent].child,
+        .pc = p->pc,
+        .bank = p->bank,
+        .call = call,
+    };
+    p->nodes[parent].child = idx;
+
+    return idx;
+}
+
+static void _profiler_call(profiler_s *p, profiler_call_t call) {
+    if (p->depth == PROFILER_MAX_DEPTH) {
+        ++p->overflows;
+        return;
+    }
+    p->current = _profiler_callee(p, call);
+    p->frames[p->depth++] = (profiler_frame_s){
+        .node = p->current,
+        .sp = run_args.cpu65_sp,
+    };
+}
+
+static void _profiler_unwind(profiler_s *p) {
+    while (p->depth && run_args.cpu65_sp > p->frames[p->depth-1].sp) {
+        --p->depth;
+    }
+    p->current = p->depth ? p->frames[p->depth-1].node : 0;
+}
+
+void profiler_sample(uint8_t cycles) {
+    profiler_s *p = profile;
+    if (UNLIKELY(!p)) {
+        return;
+    }
+
+    if (UNLIKELY(cycles == PROFILE_RESET)) {
+        p->depth = 0;
+        p->current = 0;
+        p->pc = run_args.cpu65_pc;
+        p->bank = _profiler_bank(p->pc);
+        return;
+    }
+
+    if (cycles == PROFILE_IRQ) {
+        p->pc = run_args.cpu65_pc;
+        p->bank = _profiler_bank(p->pc);
+        _profiler_call(p, PROFILER_CALL_IRQ);
+        return;
+    }
+
+    profiler_counts_s *counts = p->counts[p->bank];
+    if (UNLIKELY(!counts)) {
+        counts = p->counts[p->bank] = CALLOC(1, sizeof(profiler_counts_s));
+    }
+    if (LIKELY(counts != NULL)) {
+        counts->cycles[p->pc] += cycles;
+        ++counts->hits[p->pc];
+    }
+    p->nodes[p->current].cycles += cycles;
+    p->totalCycles += cycles;
+    ++p->instructions;
+
+    p->pc = run_args.cpu65_pc;
+    p->bank = _profiler_bank(p->pc);
+
+    uint8_t opcode = run_args.cpu65_opcode;
+    if (opcode == OPCODE_JSR) {
+        _profiler_call(p, PROFILER_CALL_JSR);
+    } else if (opcode == OPCODE_BRK) {
+        _profiler_call(p, PROFILER_CALL_BRK);
+    } else if (p->depth) {
+        _profiler_unwind(p);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Lifecycle
+
+static void _profiler_free(void) {
+    if (!profile) {
+        return;
+    }
+    for (unsigned int i = 0; i < NUM_PROFILER_BANKS; i++) {
+        FREE(profile->counts[i]);
+    }
+    FREE(profile->nodes);
+    FREE(profile);
+}
+
+bool profiler_begin(void) {
+#if CPU65_PROFILE_HOOK
+    ASSERT_ON_CPU_THREAD();
+
+    run_args.cpu65_profile = NULL;
+    _profiler_free();
+
+    profile = CALLOC(1, sizeof(profiler_s));
+    if (!profile) {
+        LOG("OOPS, not enough memory for profiler");
+        return false;
+    }
+    profile->nodes = CALLOC(PROFILER_NODES_CHUNK, sizeof(profiler_node_s));
+    if (!profile->nodes) {
+        LOG("OOPS, not enough memory for profiler");
+        FREE(profile);
+        return false;
+    }
+    profile->capNodes = PROFILER_NODES_CHUNK;
+    profile->numNodes = 1; // root
+
+    // the CPU is not running (we are on its thread), so this is where it resumes
+    profile->pc = run_args.cpu65_pc;
+    profile->bank = _profiler_bank(profile->pc);
+
+    extern void cpu65_profile_sample(uint16_t, uint8_t);
+    run_args.cpu65_profile = cpu65_profile_sample;
+    return true;
+#else
+    LOG("CPU core does not support profiling...");
+    return false;
+#endif
+}
+
+void profiler_end(void) {
+    run_args.cpu65_profile = NULL;
+}
+
+bool profiler_isProfiling(void) {
+    return run_args.cpu65_profile != NULL;
+}
+
+// ----------------------------------------------------------------------------
+// Symbols
+
+static int _profiler_symbolCompare(const void *a, const void *b) {
+    return (int)((const profiler_symbol_s *)a)->addr - (int)((const profiler_symbol_s *)b)->addr;
+}
+
+static void _profiler_freeSymbols(void) {
+    for (unsigned int i = 0; i < numSymbols; i++) {
+        FREE(symbols[i].name);
+    }
+    FREE(symbols);
+    numSymbols = 0;
+}
+
+int profiler_loadSymbols(const char *path) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        LOG("OOPS, could not open symbols %s (%s)", path, strerror(errno));
+        return -1;
+    }
+
+    _profiler_freeSymbols();
+
+    unsigned int capSymbols = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), fp)) {
+        char *s = line;
+        while (isspace(*s)) {
+            ++s;
+        }
+
+        // VICE label : al C:FC58 .HOME
+        if (strncmp(s, "al ", 3) == 0) {
+            s += 3;
+            while (isspace(*s)) {
+                ++s;
+            }
+            if (s[0] && s[1] == ':') {
+                s += 2;
+            }
+        }
+
+        if (*s == '$') {
+            ++s;
+        } else if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+            s += 2;
+        }
+
+        char *end = NULL;
+        unsigned long addr = strtoul(s, &end, 16);
+        if (end == s || addr > 0xFFFF || !isspace(*end)) {
+            continue; // comment or unrecognized line
+        }
+
+        s = end;
+        while (isspace(*s) || *s == '.' || *s == '=') {
+            ++s;
+        }
+        size_t len = 0;
+        while (s[len] && !isspace(s[len])) {
+            ++len;
+        }
+        if (!len) {
+            continue;
+        }
+
+        if (numSymbols == capSymbols) {
+            capSymbols = capSymbols ? capSymbols * 2 : 256;
+            profiler_symbol_s *syms = REALLOC(symbols, capSymbols * sizeof(profiler_symbol_s));
+            if (!syms) {
+                break;
+            }
+            symbols = syms;
+        }
+        symbols[numSymbols].addr = (uint16_t)addr;
+        symbols[numSymbols].name = STRNDUP(s, MIN(len, PROFILER_NAME_MAX-1));
+        if (symbols[numSymbols].name) {
+            ++numSymbols;
+        }
+    }
+    fclose(fp);
+
+    if (numSymbols) {
+        qsort(symbols, numSymbols, sizeof(profiler_symbol_s), &_profiler_symbolCompare);
+    }
+
+    return (int)numSymbols;
+}
+
+// Nearest symbol at or below addr (NULL : none within PROFILER_SYMBOL_SPAN)
+static const profiler_symbol_s *_profiler_symbol(uint16_t addr) {
+    unsigned int lo = 0;
+    unsigned int hi = numSymbols;
+    while (lo < hi) {
+        unsigned int mid = (lo + hi) / 2;
+        if (symbols[mid].addr <= addr) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (!lo || addr - symbols[lo-1].addr >= PROFILER_SYMBOL_SPAN) {
+        return NULL;
+    }
+    return &symbols[lo-1];
+}
+
+static void _profiler_routineName(char *buf, size_t len, const profiler_node_s *node) {
+    static const char *const prefixes[] = { "", "", "[brk] ", "[irq] " };
+    const profiler_symbol_s *sym = _profiler_symbol(node->pc);
+    if (sym && sym->addr == node->pc) {
+        snprintf(buf, len, "%s%s", prefixes[node->call], sym->name);
+    } else {
+        snprintf(buf, len, "%s%s:%04X", prefixes[node->call], bank_names[node->bank], node->pc);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Export
+
+typedef struct profiler_row_s {
+    uint64_t self;
+    uint64_t total;
+    uint32_t hits;
+    uint16_t pc;
+    uint8_t bank;
+    uint8_t call;
+} profiler_row_s;
+
+static int _profiler_rowCompareCycles(const void *a, const void *b) {
+    const profiler_row_s *ra = (const profiler_row_s *)a;
+    const profiler_row_s *rb = (const profiler_row_s *)b;
+    uint64_t ca = ra->total ? ra->total : ra->self;
+    uint64_t cb = rb->total ? rb->total : rb->self;
+    return (ca < cb) ? 1 : (ca > cb) ? -1 : 0;
+}
+
+static int _profiler_rowCompareRoutine(const void *a, const void *b) {
+    const profiler_row_s *ra = (const profiler_row_s *)a;
+    const profiler_row_s *rb = (const profiler_row_s *)b;
+    if (ra->bank != rb->bank) {
+        return (int)ra->bank - (int)rb->bank;
+    }
+    if (ra->pc != rb->pc) {
+        return (int)ra->pc - (int)rb->pc;
+    }
+    return (int)ra->call - (int)rb->call;
+}
+
+static double _profiler_percent(uint64_t cycles) {
+    return profile->totalCycles ? (100.0 * cycles) / profile->totalCycles : 0.0;
+}
+
+static void _profiler_writeAddresses(FILE *fp) {
+    size_t numRows = 0;
+    for (unsigned int bank = 0; bank < NUM_PROFILER_BANKS; bank++) {
+        if (!profile->counts[bank]) {
+            continue;
+        }
+        for (unsigned int pc = 0; pc < 65536; pc++) {
+            numRows += profile->counts[bank]->hits[pc] ? 1 : 0;
+        }
+    }
+
+    profiler_row_s *rows = numRows ? MALLOC(numRows * sizeof(profiler_row_s)) : NULL;
+    if (!rows) {
+        return;
+    }
+
+    size_t idx = 0;
+    for (unsigned int bank = 0; bank < NUM_PROFILER_BANKS; bank++) {
+        const profiler_counts_s *counts = profile->counts[bank];
+        if (!counts) {
+            continue;
+        }
+        for (unsigned int pc = 0; pc < 65536; pc++) {
+            if (counts->hits[pc]) {
+                rows[idx++] = (profiler_row_s){
+                    .self = counts->cycles[pc],
+                    .hits = counts->hits[pc],
+                    .pc = (uint16_t)pc,
+                    .bank = (uint8_t)bank,
+                };
+            }
+        }
+    }
+    qsort(rows, numRows, sizeof(profiler_row_s), &_profiler_rowCompareCycles);
+
+    fprintf(fp, "Hottest addresses\n");
+    fprintf(fp, "%-8s %-5s %14s %7s %12s  %s\n", "bank", "addr", "cycles", "%", "executed", "symbol");
+    for (size_t i = 0; i < MIN(numRows, PROFILER_REPORT_ROWS); i++) {
+        char symbuf[PROFILER_NAME_MAX + 8] = { 0 };
+        const profiler_symbol_s *sym = _profiler_symbol(rows[i].pc);
+        if (sym) {
+            if (sym->addr == rows[i].pc) {
+                snprintf(symbuf, sizeof(symbuf), "%s", sym->name);
+            } else {
+                snprintf(symbuf, sizeof(symbuf), "%s+%02X", sym->name, rows[i].pc - sym->addr);
+            }
+        }
+        fprintf(fp, "%-8s %04X  %14llu %6.2f%% %12u  %s\n", bank_names[rows[i].bank], rows[i].pc,
+                (unsigned long long)rows[i].self, _profiler_percent(rows[i].self), rows[i].hits, symbuf);
+    }
+
+    FREE(rows);
+}
+
+static void _profiler_writeRoutines(FILE *fp) {
+    const uint32_t numNodes = profile->numNodes;
+    uint64_t *inclusive = MALLOC(numNodes * sizeof(uint64_t));
+    profiler_row_s *rows = MALLOC(numNodes * sizeof(profiler_row_s));
+
+    do {
+        if (!inclusive || !rows) {
+            break;
+        }
+
+        // callees always follow their caller in the node array
+        for (uint32_t i = 0; i < numNodes; i++) {
+            inclusive[i] = profile->nodes[i].cycles;
+        }
+        for (uint32_t i = numNodes - 1; i > 0; i--) {
+            inclusive[profile->nodes[i].parent] += inclusive[i];
+        }
+
+        // one row per node (less the root), counting total cycles only at the outermost activation of recursion
+        uint32_t numRows = 0;
+        for (uint32_t i = 1; i < numNodes; i++) {
+            const profiler_node_s *node = &profile->nodes[i];
+            bool recursive = false;
+            for (uint32_t up = node->parent; up; up = profile->nodes[up].parent) {
+                const profiler_node_s *caller = &profile->nodes[up];
+                if (caller->pc == node->pc && caller->bank == node->bank && caller->call == node->call) {
+                    recursive = true;
+                    break;
+                }
+            }
+            rows[numRows++] = (profiler_row_s){
+                .self = node->cycles,
+                .total = recursive ? 0 : inclusive[i],
+                .hits = 1,
+                .pc = node->pc,
+                .bank = node->bank,
+                .call = node->call,
+            };
+        }
+
+        // merge rows of the same routine reached through different callers
+        qsort(rows, numRows, sizeof(profiler_row_s), &_profiler_rowCompareRoutine);
+        uint32_t numRoutines = 0;
+        for (uint32_t i = 0; i < numRows; i++) {
+            if (numRoutines && _profiler_rowCompareRoutine(&rows[numRoutines-1], &rows[i]) == 0) {
+                rows[numRoutines-1].self += rows[i].self;
+                rows[numRoutines-1].total += rows[i].total;
+                rows[numRoutines-1].hits += rows[i].hits;
+            } else {
+                rows[numRoutines++] = rows[i];
+            }
+        }
+        qsort(rows, numRoutines, sizeof(profiler_row_s), &_profiler_rowCompareCycles);
+
+        fprintf(fp, "Routines (from JSR/BRK/IRQ call stacks)\n");
+        fprintf(fp, "%14s %7s %14s %7s %8s  %s\n", "total", "%", "self", "%", "callers", "routine");
+        fprintf(fp, "%14llu %6.2f%% %14llu %6.2f%% %8s  %s\n", (unsigned long long)inclusive[0], _profiler_percent(inclusive[0]),
+                (unsigned long long)profile->nodes[0].cycles, _profiler_percent(profile->nodes[0].cycles), "", "[toplevel]");
+        for (uint32_t i = 0; i < MIN(numRoutines, PROFILER_REPORT_ROWS); i++) {
+            char name[PROFILER_NAME_MAX + 16];
+            profiler_node_s node = { .pc = rows[i].pc, .bank = rows[i].bank, .call = rows[i].call };
+            _profiler_routineName(name, sizeof(name), &node);
+            fprintf(fp, "%14llu %6.2f%% %14llu %6.2f%% %8u  %s\n", (unsigned long long)rows[i].total, _profiler_percent(rows[i].total),
+                    (unsigned long long)rows[i].self, _profiler_percent(rows[i].self), rows[i].hits, name);
+        }
+    } while (0);
+
+    FREE(rows);
+    FREE(inclusive);
+}
+
+bool profiler_writeReport(const char *path) {
+    if (!profile) {
+        LOG("No profile to write...");
+        return false;
+    }
+
+    FILE *fp = fopen(path, "w");
+    if (!fp) {
+        LOG("OOPS, could not open %s (%s)", path, strerror(errno));
+        return false;
+    }
+
+    fprintf(fp, "65c02 profile : %llu cycles, %llu instructions, %u call paths",
+            (unsigned long long)profile->totalCycles, (unsigned long long)profile->instructions, profile->numNodes - 1);
+    if (profile->overflows) {
+        fprintf(fp, ", %lu calls deeper than %d untracked", profile->overflows, PROFILER_MAX_DEPTH);
+    }
+    fprintf(fp, "\n\n");
+
+    _profiler_writeAddresses(fp);
+    fprintf(fp, "\n");
+    _profiler_writeRoutines(fp);
+
+    return fclose(fp) == 0;
+}
+
+bool profiler_writeFlameGraph(const char *path) {
+    if (!profile) {
+        LOG("No profile to write...");
+        return false;
+    }
+
+    FILE *fp = fopen(path, "w");
+    if (!fp) {
+        LOG("OOPS, could not open %s (%s)", path, strerror(errno));
+        return false;
+    }
+
+    if (profile->nodes[0].cycles) {
+        fprintf(fp, "[toplevel] %llu\n", (unsigned long long)profile->nodes[0].cycles);
+    }
+
+    uint32_t path_nodes[PROFILER_MAX_DEPTH];
+    for (uint32_t i = 1; i < profile->numNodes; i++) {
+        if (!profile->nodes[i].cycles) {
+            continue;
+        }
+
+        unsigned int depth = 0;
+        for (uint32_t up = i; up && depth < PROFILER_MAX_DEPTH; up = profile->nodes[up].parent) {
+            path_nodes[depth++] = up;
+        }
+
+        while (depth) {
+            char name[PROFILER_NAME_MAX + 16];
+            _profiler_routineName(name, sizeof(name), &profile->nodes[path_nodes[--depth]]);
+            fprintf(fp, "%s%c", name, depth ? ';' : ' ');
+        }
+        fprintf(fp, "%llu\n", (unsigned long long)profile->nodes[i].cycles);
+    }
+
+    return fclose(fp) == 0;
+}
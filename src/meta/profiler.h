@@ -0,0 +1,44 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+/*
+ * 65c02 profiler : accumulates the cycles executed at each PC of each memory bank (main/aux RAM, language card banks,
+ * ROM, I/O) from the CPU core's per-instruction hook, and reconstructs the guest call stack from JSR/BRK/IRQ entries
+ * (a frame unwinds once the stack pointer rises above it, so RTS/RTI and stack-dropping exits are both handled).
+ *
+ * All routines are to be called on the CPU thread.
+ */
+
+#ifndef _META_PROFILER_H_
+#define _META_PROFILER_H_
+
+// Start profiling, discarding any previous profile (false if the CPU core has no profiler hook)
+bool profiler_begin(void);
+
+// Stop profiling, keeping the profile for export
+void profiler_end(void);
+
+bool profiler_isProfiling(void);
+
+// Load symbols used in exports : "ADDR NAME" lines (hex address, optional '$' or "0x" prefix) or VICE "al C:ADDR .NAME"
+// labels.  Returns the count of symbols loaded (replacing any previously loaded), or -1 on error
+int profiler_loadSymbols(const char *path);
+
+// Export hottest addresses and per-routine self/total cycles as text
+bool profiler_writeReport(const char *path);
+
+// Export collapsed stacks ("frame;frame;frame cycles" lines) for flamegraph.pl and compatible viewers
+bool profiler_writeFlameGraph(const char *path);
+
+// CPU core hook (see run_args.cpu65_profile)
+void profiler_sample(uint8_t cycles);
+
+#endif /* whole file */
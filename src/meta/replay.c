@@ -0,0 +1,669 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+#include "common.h"
+#include <test/sha1.h>
+
+#define REPLAY_VERSION 1
+#define REPLAY_EVENTS_CHUNK 256
+#define REPLAY_LINE_MAX (PATH_MAX + 64)
+#define REPLAY_HASH_LEN (SHA_DIGEST_LENGTH * 2)
+
+typedef enum replay_mode_t {
+    REPLAY_OFF = 0,
+    REPLAY_RECORDING,
+    REPLAY_PLAYING,
+} replay_mode_t;
+
+// logged events beyond the replay_input_t inputs
+typedef enum replay_event_t {
+    REPLAY_EVENT_EJECT = NUM_REPLAY_INPUTS,
+    REPLAY_EVENT_INSERT,
+    REPLAY_EVENT_END,
+    NUM_REPLAY_EVENTS,
+} replay_event_t;
+
+static const char *const event_names[NUM_REPLAY_EVENTS] = {
+    "key", "joyx", "joyy", "button0", "button1", "reset", "eject", "insert", "end",
+};
+
+typedef struct replay_event_s {
+    unsigned long cycles;           // session cycles
+    struct replay_event_s *next;    // input queue link
+    char *path;                     // insert : disk image, end : memory hash
+    uint16_t value;                 // input value or drive
+    uint8_t kind;                   // replay_input_t or replay_event_t
+    bool readonly;                  // insert
+    bool applied;                   // queued disk notifications are only logged
+} replay_event_s;
+
+static VM_LOCAL replay_mode_t mode = REPLAY_OFF;
+static VM_LOCAL replay_mode_t pending = REPLAY_OFF;
+static VM_LOCAL unsigned int seed = 0;
+static VM_LOCAL unsigned long cycles_offset = 0;        // session cycles = cycles_offset + cycles_count_total
+static VM_LOCAL bool verified = false;
+
+// recording
+static VM_LOCAL FILE *log_fp = NULL;
+
+// playback
+static VM_LOCAL char *log_dir = NULL;
+static VM_LOCAL replay_event_s *events = NULL;
+static VM_LOCAL unsigned int numEvents = 0;
+static VM_LOCAL unsigned int nextEvent = 0;
+static VM_LOCAL char *initial_disks[2] = { NULL, NULL };
+static VM_LOCAL bool initial_readonly[2] = { false, false };
+static VM_LOCAL uint8_t initial_buttons[2] = { 0, 0 };
+static VM_LOCAL bool diverged = false;
+
+// inputs and disk notifications from other threads while recording
+static pthread_mutex_t queue_mutex = PTHREAD_MUTEX_INITIALIZER;
+static VM_LOCAL replay_event_s *queue_head = NULL;
+static VM_LOCAL replay_event_s *queue_tail = NULL;
+static VM_LOCAL unsigned long queued = 0;
+
+// ----------------------------------------------------------------------------
+
+static inline unsigned long _replay_cycles(void) {
+    timing_checkpointCycles();
+    return cycles_offset + cycles_count_total;
+}
+
+static void _replay_memoryHash(char hash[REPLAY_HASH_LEN+1]) {
+    SHA1Context sha = { { 0 } };
+    SHA1Reset(&sha);
+    SHA1Input(&sha, apple_ii_64k[0], sizeof(apple_ii_64k));
+    SHA1Input(&sha, language_card[0], sizeof(language_card));
+    SHA1Input(&sha, language_banks[0], sizeof(language_banks));
+    SHA1Result(&sha);
+    for (unsigned int i = 0; i < 5; i++) {
+        snprintf(&hash[i<<3], 9, "%08x", sha.Message_Digest[i]);
+    }
+}
+
+static void _replay_apply(uint8_t input, uint16_t value) {
+    switch (input) {
+        case REPLAY_INPUT_KEY:
+            apple_ii_64k[0][0xC000] = (uint8_t)value;
+            apple_ii_64k[1][0xC000] = (uint8_t)value;
+            break;
+        case REPLAY_INPUT_JOY_X:
+            joy_x = value;
+            break;
+        case REPLAY_INPUT_JOY_Y:
+            joy_y = value;
+            break;
+        case REPLAY_INPUT_BUTTON0:
+            run_args.joy_button0 = (uint8_t)value;
+            break;
+        case REPLAY_INPUT_BUTTON1:
+            run_args.joy_button1 = (uint8_t)value;
+            break;
+        case REPLAY_INPUT_RESET:
+            cpu65_interrupt(ResetSig);
+            break;
+        default:
+            assert(false && "not an input");
+            break;
+    }
+}
+
+static void _replay_insertDisk(int drive, const char *path, bool readonly) {
+    char *found = NULL;
+    int fd = -1;
+    TEMP_FAILURE_RETRY(fd = open(path, readonly ? O_RDONLY : O_RDWR));
+    if (fd == -1 && log_dir) {
+        // the image may have been shipped alongside the log
+        const char *name = strrchr(path, '/');
+        ASPRINTF(&found, "%s/%s", log_dir, name ? name+1 : path);
+        if (found) {
+            TEMP_FAILURE_RETRY(fd = open(found, readonly ? O_RDONLY : O_RDWR));
+            path = found;
+        }
+    }
+
+    do {
+        if (fd == -1) {
+            LOG("OOPS, replay could not open disk image %s (%s)", path, strerror(errno));
+            break;
+        }
+        const char *err = disk6_insert(fd, drive, path, readonly);
+        if (err) {
+            LOG("OOPS, replay could not insert disk image %s (%s)", path, err);
+        }
+        TEMP_FAILURE_RETRY(close(fd));
+    } while (0);
+
+    if (found) {
+        FREE(found);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// recording
+
+static void _replay_write(const replay_event_s *ev) {
+    switch (ev->kind) {
+        case REPLAY_INPUT_RESET:
+            fprintf(log_fp, "%lu %s\n", ev->cycles, event_names[ev->kind]);
+            break;
+        case REPLAY_EVENT_EJECT:
+            fprintf(log_fp, "%lu %s %u\n", ev->cycles, event_names[ev->kind], ev->value);
+            break;
+        case REPLAY_EVENT_INSERT:
+            fprintf(log_fp, "%lu %s %u %u %s\n", ev->cycles, event_names[ev->kind], ev->value, ev->readonly, ev->path);
+            break;
+        case REPLAY_EVENT_END:
+            fprintf(log_fp, "%lu %s %s\n", ev->cycles, event_names[ev->kind], ev->path);
+            break;
+        default:
+            fprintf(log_fp, "%lu %s %02x\n", ev->cycles, event_names[ev->kind], ev->value);
+            break;
+    }
+    // keep the log intact should the emulator crash (inputs are infrequent)
+    fflush(log_fp);
+}
+
+// Apply (unless already applied) and log an event on the CPU thread
+static void _replay_record(replay_event_s *ev) {
+    if (!ev->applied) {
+        _replay_apply(ev->kind, ev->value);
+    }
+    ev->cycles = _replay_cycles();
+    _replay_write(ev);
+}
+
+static void _replay_post(uint8_t kind, uint16_t value, const char *path, bool readonly, bool applied) {
+    replay_event_s ev = {
+        .kind = kind,
+        .value = value,
+        .path = (char *)path,
+        .readonly = readonly,
+        .applied = applied,
+    };
+
+    if (mode == REPLAY_RECORDING && timing_isCPUThread()) {
+        _replay_record(&ev);
+        return;
+    }
+
+    // queued until the CPU thread's next instruction boundary
+    replay_event_s *qev = MALLOC(sizeof(replay_event_s));
+    if (!qev) {
+        return;
+    }
+    *qev = ev;
+    qev->next = NULL;
+    qev->path = path ? STRDUP(path) : NULL;
+
+    pthread_mutex_lock(&queue_mutex);
+    if (queue_tail) {
+        queue_tail->next = qev;
+    } else {
+        queue_head = qev;
+    }
+    queue_tail = qev;
+    __atomic_store_n(&queued, 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&queue_mutex);
+}
+
+bool replay_beginRecording(const char *path) {
+    if (mode != REPLAY_OFF || pending != REPLAY_OFF) {
+        LOG("OOPS, replay session already active");
+        return false;
+    }
+
+    log_fp = fopen(path, "w");
+    if (!log_fp) {
+        LOG("OOPS, could not open replay log %s (%s)", path, strerror(errno));
+        return false;
+    }
+
+    seed = (unsigned int)time(NULL);
+    pending = REPLAY_RECORDING;
+    LOG("replay : recording to %s ...", path);
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// playback
+
+static void _replay_freeEvents(void) {
+    for (unsigned int i = 0; i < numEvents; i++) {
+        if (events[i].path) {
+            FREE(events[i].path);
+        }
+    }
+    if (events) {
+        FREE(events);
+    }
+    numEvents = 0;
+    nextEvent = 0;
+    for (unsigned int drive = 0; drive < 2; drive++) {
+        if (initial_disks[drive]) {
+            FREE(initial_disks[drive]);
+        }
+    }
+    if (log_dir) {
+        FREE(log_dir);
+    }
+}
+
+static int _replay_eventKind(const char *name) {
+    for (unsigned int kind = 0; kind < NUM_REPLAY_EVENTS; kind++) {
+        if (strcmp(name, event_names[kind]) == 0) {
+            return (int)kind;
+        }
+    }
+    return -1;
+}
+
+// Parse the arguments of a logged event (or initial state line) into ev
+static bool _replay_parseArgs(replay_event_s *ev, const char *args) {
+    unsigned int value = 0;
+    unsigned int readonly = 0;
+    int n = 0;
+
+    switch (ev->kind) {
+        case REPLAY_INPUT_RESET:
+            return true;
+        case REPLAY_EVENT_EJECT:
+            if (sscanf(args, "%u", &value) != 1 || value > 1) {
+                return false;
+            }
+            break;
+        case REPLAY_EVENT_INSERT:
+            if (sscanf(args, "%u %u %n", &value, &readonly, &n) != 2 || value > 1 || !args[n]) {
+                return false;
+            }
+            ev->readonly = (readonly != 0);
+            ev->path = STRDUP(&args[n]);
+            break;
+        case REPLAY_EVENT_END: {
+            char hash[REPLAY_HASH_LEN+1] = { 0 };
+            if (sscanf(args, "%40s", hash) != 1 || strlen(hash) != REPLAY_HASH_LEN) {
+                return false;
+            }
+            ev->path = STRDUP(hash);
+            break;
+        }
+        default:
+            if (sscanf(args, "%x", &value) != 1 || value > 0xFFFF) {
+                return false;
+            }
+            break;
+    }
+
+    ev->value = (uint16_t)value;
+    return true;
+}
+
+static bool _replay_load(const char *path) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        LOG("OOPS, could not open replay log %s (%s)", path, strerror(errno));
+        return false;
+    }
+
+    _replay_freeEvents();
+
+    bool ok = true;
+    int version = -1;
+    unsigned int capEvents = 0;
+    unsigned int lineNum = 0;
+    char line[REPLAY_LINE_MAX];
+    while (ok && fgets(line, sizeof(line), fp)) {
+        ++lineNum;
+        size_t len = strlen(line);
+        while (len && isspace(line[len-1])) {
+            line[--len] = '\0';
+        }
+        if (!len || line[0] == '#') {
+            continue;
+        }
+
+        replay_event_s ev = { 0 };
+        char name[16] = { 0 };
+        int n = 0;
+
+        if (isdigit(line[0])) {
+            // <cycles> <event> <args>
+            if (sscanf(line, "%lu %15s %n", &ev.cycles, name, &n) != 2) {
+                ok = false;
+                break;
+            }
+            int kind = _replay_eventKind(name);
+            if (kind < 0 || (numEvents && (long)(ev.cycles - events[numEvents-1].cycles) < 0)) {
+                ok = false;
+                break;
+            }
+            ev.kind = (uint8_t)kind;
+            if (!_replay_parseArgs(&ev, &line[n])) {
+                ok = false;
+                break;
+            }
+
+            if (numEvents == capEvents) {
+                capEvents += REPLAY_EVENTS_CHUNK;
+                replay_event_s *evs = REALLOC(events, capEvents * sizeof(replay_event_s));
+                if (!evs) {
+                    FREE(ev.path);
+                    ok = false;
+                    break;
+                }
+                events = evs;
+            }
+            events[numEvents++] = ev;
+            continue;
+        }
+
+        // header and initial machine state : <keyword> <args>
+        if (sscanf(line, "%15s %n", name, &n) != 1) {
+            ok = false;
+        } else if (strcmp(name, "version") == 0) {
+            ok = (sscanf(&line[n], "%d", &version) == 1) && (version == REPLAY_VERSION);
+        } else if (strcmp(name, "seed") == 0) {
+            ok = (sscanf(&line[n], "%u", &seed) == 1);
+        } else {
+            int kind = _replay_eventKind(name);
+            ev.kind = (uint8_t)kind;
+            if (kind == REPLAY_EVENT_INSERT) {
+                ok = _replay_parseArgs(&ev, &line[n]);
+                if (ok) {
+                    if (initial_disks[ev.value]) {
+                        FREE(initial_disks[ev.value]);
+                    }
+                    initial_disks[ev.value] = ev.path;
+                    initial_readonly[ev.value] = ev.readonly;
+                }
+            } else if (kind == REPLAY_INPUT_BUTTON0 || kind == REPLAY_INPUT_BUTTON1) {
+                ok = _replay_parseArgs(&ev, &line[n]);
+                initial_buttons[kind - REPLAY_INPUT_BUTTON0] = (uint8_t)ev.value;
+            } else {
+                ok = false;
+            }
+        }
+    }
+    fclose(fp);
+
+    if (ok && version != REPLAY_VERSION) {
+        LOG("OOPS, replay log %s has no supported version", path);
+        _replay_freeEvents();
+        return false;
+    }
+    if (!ok) {
+        LOG("OOPS, replay log %s : unrecognized line %u", path, lineNum);
+        _replay_freeEvents();
+        return false;
+    }
+
+    const char *slash = strrchr(path, '/');
+    log_dir = slash ? STRNDUP(path, slash - path) : STRDUP(".");
+
+    return true;
+}
+
+bool replay_beginPlayback(const char *path) {
+    if (mode != REPLAY_OFF || pending != REPLAY_OFF) {
+        LOG("OOPS, replay session already active");
+        return false;
+    }
+
+    if (!_replay_load(path)) {
+        return false;
+    }
+
+    pending = REPLAY_PLAYING;
+    LOG("replay : playing back %s (%u events) ...", path, numEvents);
+
+    return true;
+}
+
+static void _replay_deadline(void) {
+    // nothing to do : the event only ends cpu65_run() on the cycle of the next input, which replay_drainInput() applies
+    // before the CPU resumes (where recording applied it)
+}
+
+static void _replay_schedule(void) {
+    if (nextEvent < numEvents) {
+        timing_scheduleEvent(TIMING_EVENT_REPLAY, events[nextEvent].cycles - cycles_offset, &_replay_deadline);
+    }
+}
+
+static void _replay_finish(void) {
+    LOG("replay : playback %s", verified ? "verified" : (nextEvent < numEvents ? "stopped" : "finished"));
+    timing_cancelEvent(TIMING_EVENT_REPLAY);
+    _replay_freeEvents();
+    mode = REPLAY_OFF;
+    timing_initialize(); // back to configured speed
+}
+
+static void _replay_verify(const char *expected) {
+    char hash[REPLAY_HASH_LEN+1] = { 0 };
+    _replay_memoryHash(hash);
+    verified = (strcmp(hash, expected) == 0);
+    if (!verified) {
+        LOG("OOPS, replay memory hash %s does not match recorded %s", hash, expected);
+    }
+}
+
+static void _replay_playDue(void) {
+    const unsigned long now = _replay_cycles();
+
+    while (nextEvent < numEvents && (long)(events[nextEvent].cycles - now) <= 0) {
+        const replay_event_s *ev = &events[nextEvent++];
+        if (ev->cycles != now && !diverged) {
+            diverged = true;
+            LOG("OOPS, replay event at cycle %lu applied at %lu, playback has diverged", ev->cycles, now);
+        }
+
+        switch (ev->kind) {
+            case REPLAY_EVENT_EJECT:
+                disk6_eject(ev->value);
+                break;
+            case REPLAY_EVENT_INSERT:
+                _replay_insertDisk(ev->value, ev->path, ev->readonly);
+                break;
+            case REPLAY_EVENT_END:
+                _replay_verify(ev->path);
+                break;
+            default:
+                _replay_apply(ev->kind, ev->value);
+                break;
+        }
+    }
+
+    if (nextEvent < numEvents) {
+        _replay_schedule();
+    } else {
+        _replay_finish();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// session
+
+static void _replay_start(void) {
+    const replay_mode_t starting = pending;
+    pending = REPLAY_OFF;
+
+    cycles_offset = 0UL - cycles_count_total;
+    verified = false;
+    diverged = false;
+    srandom(seed);
+
+    // both sessions start with freshly inserted images (eject retains some drive state)
+    char *paths[2] = { NULL, NULL };
+    bool readonly[2] = { false, false };
+    for (unsigned int drive = 0; drive < 2; drive++) {
+        if (starting == REPLAY_RECORDING && disk6.disk[drive].file_name) {
+            paths[drive] = STRDUP(disk6.disk[drive].file_name);
+            readonly[drive] = disk6.disk[drive].is_protected;
+        } else if (starting == REPLAY_PLAYING && initial_disks[drive]) {
+            paths[drive] = STRDUP(initial_disks[drive]);
+            readonly[drive] = initial_readonly[drive];
+        }
+        disk6_eject(drive);
+    }
+
+    if (starting == REPLAY_RECORDING) {
+        fprintf(log_fp, "# apple2ix input replay\n");
+        fprintf(log_fp, "version %d\n", REPLAY_VERSION);
+        fprintf(log_fp, "seed %u\n", seed);
+        for (unsigned int drive = 0; drive < 2; drive++) {
+            if (paths[drive]) {
+                fprintf(log_fp, "%s %u %u %s\n", event_names[REPLAY_EVENT_INSERT], drive, readonly[drive], paths[drive]);
+            }
+        }
+        fprintf(log_fp, "%s %02x\n", event_names[REPLAY_INPUT_BUTTON0], run_args.joy_button0);
+        fprintf(log_fp, "%s %02x\n", event_names[REPLAY_INPUT_BUTTON1], run_args.joy_button1);
+        fflush(log_fp);
+    } else {
+        run_args.joy_button0 = initial_buttons[0];
+        run_args.joy_button1 = initial_buttons[1];
+    }
+
+    for (unsigned int drive = 0; drive < 2; drive++) {
+        if (paths[drive]) {
+            _replay_insertDisk(drive, paths[drive], readonly[drive]);
+            FREE(paths[drive]);
+        }
+    }
+
+    mode = starting;
+
+    if (mode == REPLAY_PLAYING) {
+        if (numEvents) {
+            _replay_schedule();
+        } else {
+            _replay_finish();
+        }
+    }
+}
+
+void replay_end(void) {
+    ASSERT_ON_CPU_THREAD();
+
+    if (pending == REPLAY_RECORDING || mode == REPLAY_RECORDING) {
+        if (mode == REPLAY_RECORDING) {
+            char hash[REPLAY_HASH_LEN+1] = { 0 };
+            _replay_memoryHash(hash);
+            replay_event_s ev = {
+                .kind = REPLAY_EVENT_END,
+                .path = hash,
+            };
+            ev.cycles = _replay_cycles();
+            _replay_write(&ev);
+            LOG("replay : recorded %lu cycles", ev.cycles);
+        }
+        fclose(log_fp);
+        log_fp = NULL;
+        mode = REPLAY_OFF;
+    } else if (pending == REPLAY_PLAYING) {
+        _replay_freeEvents();
+    } else if (mode == REPLAY_PLAYING) {
+        _replay_finish();
+    }
+
+    pending = REPLAY_OFF;
+}
+
+bool replay_isRecording(void) {
+    return mode == REPLAY_RECORDING;
+}
+
+bool replay_isPlaying(void) {
+    return mode == REPLAY_PLAYING;
+}
+
+bool replay_playbackVerified(void) {
+    return verified;
+}
+
+bool replay_isStarting(void) {
+    return pending != REPLAY_OFF;
+}
+
+void replay_input(replay_input_t input, uint16_t value) {
+    assert(input < NUM_REPLAY_INPUTS);
+
+    const replay_mode_t session = (pending != REPLAY_OFF) ? pending : mode;
+    if (session == REPLAY_OFF) {
+        _replay_apply(input, value);
+    } else if (session == REPLAY_RECORDING) {
+        _replay_post(input, value, NULL, false, /*applied:*/false);
+    }
+    // else live input is ignored during playback
+}
+
+void replay_diskInserted(int drive, const char *path, bool readonly) {
+    if (mode == REPLAY_RECORDING) {
+        _replay_post(REPLAY_EVENT_INSERT, (uint16_t)drive, path, readonly, /*applied:*/true);
+    }
+}
+
+void replay_diskEjected(int drive) {
+    if (mode == REPLAY_RECORDING) {
+        _replay_post(REPLAY_EVENT_EJECT, (uint16_t)drive, NULL, false, /*applied:*/true);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// timing hooks
+
+void replay_reinitialize(unsigned long previous_cycles) {
+    if (pending != REPLAY_OFF) {
+        _replay_start();
+        return;
+    }
+
+    // a cold boot during the session (e.g. Open-Apple reset) : session cycles keep counting, and the (dropped) pending
+    // playback deadline is rescheduled
+    cycles_offset += previous_cycles - cycles_count_total;
+    if (mode == REPLAY_PLAYING) {
+        _replay_schedule();
+    }
+}
+
+void replay_drainInput(void) {
+    if (mode == REPLAY_PLAYING) {
+        if ((long)(events[nextEvent].cycles - _replay_cycles()) <= 0) {
+            _replay_playDue();
+        }
+        return;
+    }
+
+    if (LIKELY(!__atomic_load_n(&queued, __ATOMIC_ACQUIRE))) {
+        return;
+    }
+
+    pthread_mutex_lock(&queue_mutex);
+    replay_event_s *ev = queue_head;
+    queue_head = NULL;
+    queue_tail = NULL;
+    __atomic_store_n(&queued, 0, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&queue_mutex);
+
+    while (ev) {
+        replay_event_s *next = ev->next;
+        if (mode == REPLAY_RECORDING) {
+            _replay_record(ev);
+        } else if (!ev->applied) {
+            _replay_apply(ev->kind, ev->value); // recording ended with input still queued
+        }
+        if (ev->path) {
+            FREE(ev->path);
+        }
+        FREE(ev);
+        ev = next;
+    }
+}
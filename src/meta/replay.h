@@ -0,0 +1,107 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+/*
+ * Deterministic record/replay of external input.
+ *
+ * While recording, the inputs that the emulated machine can observe (keyboard latch, joystick axes and buttons, reset
+ * key, Disk II insert/eject) are applied by the CPU thread on an instruction boundary and logged with the cycle count
+ * at which they took effect.  Playback injects the logged inputs at the same cycles through the timing event
+ * scheduler, at full speed, ignoring live input.  Both sessions begin from a cold boot with the same memory
+ * randomization seed, so a playback reproduces the recorded run bit-exactly.  A recording closed by replay_end() ends
+ * with a hash of machine memory that playback verifies.
+ *
+ * The log is line-oriented text :
+ *
+ *      # comment
+ *      version 1
+ *      seed <n>
+ *      <cycles> key|joyx|joyy|button0|button1 <value>
+ *      <cycles> reset
+ *      <cycles> eject <drive>
+ *      <cycles> insert <drive> <readonly> <path>
+ *      <cycles> end <sha1>
+ *
+ * Disk images are referenced by path (falling back to an image of the same name alongside the log), so an image
+ * written to while recording must be restored before playback.
+ */
+
+#ifndef _META_REPLAY_H_
+#define _META_REPLAY_H_
+
+typedef enum replay_input_t {
+    REPLAY_INPUT_KEY = 0,   // keyboard latch ($C000) value
+    REPLAY_INPUT_JOY_X,     // paddle 0
+    REPLAY_INPUT_JOY_Y,     // paddle 1
+    REPLAY_INPUT_BUTTON0,   // button 0 / Open Apple
+    REPLAY_INPUT_BUTTON1,   // button 1 / Closed Apple
+    REPLAY_INPUT_RESET,     // reset key (value ignored)
+    NUM_REPLAY_INPUTS,
+} replay_input_t;
+
+/*
+ * Begin recording to the specified log.  Recording starts with a cold boot before the CPU next runs.  Call on the CPU
+ * thread or while the CPU is paused.
+ */
+bool replay_beginRecording(const char *path);
+
+/*
+ * Begin playing back the specified log.  Playback starts with a cold boot before the CPU next runs and stops on its own
+ * once the log is exhausted.  Call on the CPU thread or while the CPU is paused.
+ */
+bool replay_beginPlayback(const char *path);
+
+/*
+ * Stop recording (closing the log with the end-of-recording memory hash) or playback.
+ */
+void replay_end(void) CALL_ON_CPU_THREAD;
+
+bool replay_isRecording(void);
+
+bool replay_isPlaying(void);
+
+/*
+ * Did the last completed playback reach the end of the recording with matching machine memory?
+ */
+bool replay_playbackVerified(void);
+
+/*
+ * Deliver an external input to the machine.  It is applied immediately unless recording (queued for the CPU thread
+ * when called from another thread) or playing back (dropped).
+ */
+void replay_input(replay_input_t input, uint16_t value);
+
+/*
+ * Disk II insert/eject notifications (logged while recording)
+ */
+void replay_diskInserted(int drive, const char *path, bool readonly);
+void replay_diskEjected(int drive);
+
+// ----------------------------------------------------------------------------
+// timing hooks
+
+/*
+ * Is a session waiting for its cold boot?
+ */
+bool replay_isStarting(void);
+
+/*
+ * Called by the machine cold boot, after cycle counts and events are reset (previous_cycles : cycles_count_total before
+ * the reset)
+ */
+void replay_reinitialize(unsigned long previous_cycles) CALL_ON_CPU_THREAD;
+
+/*
+ * Apply inputs queued by other threads while recording (called between cpu65_run() invocations)
+ */
+void replay_drainInput(void) CALL_ON_CPU_THREAD;
+
+#endif /* whole file */
@@ -14,11 +14,14 @@
  */
 
 #include "common.h"
+#include "video/ntsc.h"
 
 #include <locale.h>
+#include <test/sha1.h>
 
 #define SAVE_MAGICK  "A2VM"
 #define SAVE_MAGICK2 "A2V2"
+#define SAVE_MAGICK3 "A2V3" // chunked/compressed container of version 2 module streams
 #define SAVE_VERSION 2
 #define SAVE_MAGICK_LEN sizeof(SAVE_MAGICK)
 
@@ -66,7 +69,7 @@ static __attribute__((constructor)) void __init_common(void) {
 #if defined(CONFIG_DATADIR)
 static void _cli_help(void) {
     fprintf(stderr, "\n");
-    fprintf(stderr, "Usage: %s [-A <audio>] [-V <video>]\n", argv[0]);
+    fprintf(stderr, "Usage: %s [-A <audio>] [-V <video>] [-r <log> | -p <log>] [-b]\n", argv[0]);
 
     const char *aname = audio_getCurrentBackend()->name();
     fprintf(stderr, "\t-A <");
@@ -78,12 +81,16 @@ static void _cli_help(void) {
     video_printBackends(stderr);
     fprintf(stderr, "> -- choose video renderer (default: %s)\n", vname);
 
+    fprintf(stderr, "\t-r <log> -- record input from a cold boot to the replay log\n");
+    fprintf(stderr, "\t-p <log> -- play back the replay log from a cold boot\n");
+    fprintf(stderr, "\t-b -- benchmark the NTSC pixel kernels and exit\n");
+
     fprintf(stderr, "\n");
 }
 
 static void _cli_argsToPrefs(void) {
     int opt = -1;
-    while ((opt = getopt(argc, argv, "?hA:V:")) != -1) {
+    while ((opt = getopt(argc, argv, "?hA:V:r:p:b")) != -1) {
         switch (opt) {
             case 'A':
                 audio_chooseBackend(optarg);
@@ -91,6 +98,19 @@ static void _cli_argsToPrefs(void) {
             case 'V':
                 video_chooseBackend(optarg);
                 break;
+            case 'r':
+                if (!replay_beginRecording(optarg)) {
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'p':
+                if (!replay_beginPlayback(optarg)) {
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'b':
+                ntsc_benchmark(stdout);
+                exit(EXIT_SUCCESS);
             case '?':
             case 'h':
             default:
@@ -166,7 +186,9 @@ static int _load_magick(int fd) {
 
     // check header
 
-    if (memcmp(magick, SAVE_MAGICK2, SAVE_MAGICK_LEN) == 0) {
+    if (memcmp(magick, SAVE_MAGICK3, SAVE_MAGICK_LEN) == 0) {
+        return 3;
+    } else if (memcmp(magick, SAVE_MAGICK2, SAVE_MAGICK_LEN) == 0) {
         return 2;
     } else if (memcmp(magick, SAVE_MAGICK, SAVE_MAGICK_LEN) == 0) {
         return 1;
@@ -176,59 +198,552 @@ static int _load_magick(int fd) {
     return -1;
 }
 
-bool emulator_saveState(int fd) {
-    bool saved = false;
+// ----------------------------------------------------------------------------
+// Chunked save-state container (A2V3)
+//
+// "A2V3\0" is followed by one or more frames.  The first frame is a key frame holding every chunk, frames appended by
+// emulator_saveStateDelta() hold only the chunks whose hash changed since the previous frame.  Each module's (A2V2)
+// stream is split into STATE_CHUNK_SIZ chunks, so untouched memory pages hash the same from one save to the next.
+//
+//  frame :
+//      "A2F3" u32:frameLen u32:seq u32:flags u32[NUM_STATE_MODULES]:moduleLen u32:numRecords
+//      record[numRecords] : u8:module u8:encoding u32:index u32:storedLen u8[20]:sha1 u8[storedLen]:data
+//      manifest : u8[20]:sha1 of every chunk of every module (in module order)
+//      u8[20]:sha1 of all preceding frame bytes
+//
+// Integers are big-endian as in the module streams.  A truncated/corrupt trailing frame (e.g. interrupted autosave) is
+// ignored and the frame before it is loaded.
+
+#define STATE_FRAME_MAGICK "A2F3"
+#define STATE_FRAME_MAGICK_LEN 4
+#define STATE_FRAME_KEY 0x1
+#define STATE_CHUNK_SIZ 4096
+#define STATE_RECORD_HDR_SIZ (1 + 1 + 4 + 4 + SHA_DIGEST_LENGTH)
+
+typedef enum state_module_t {
+    STATE_MODULE_DISK = 0,
+    STATE_MODULE_VM,
+    STATE_MODULE_CPU,
+    STATE_MODULE_TIMING,
+    STATE_MODULE_VIDEO,
+    STATE_MODULE_MB,
+    NUM_STATE_MODULES,
+} state_module_t;
+
+typedef enum state_encoding_t {
+    STATE_ENCODING_RAW = 0,
+    STATE_ENCODING_ZLIB,
+} state_encoding_t;
+
+typedef struct StateBuffer_s {
+    uint8_t *buf;
+    size_t len;
+    size_t cap;
+    size_t pos; // read position
+} StateBuffer_s;
+
+// last frame written, to decide which chunks go into the next delta frame
+static struct {
+    bool valid;
+    dev_t dev;
+    ino_t ino;
+    off_t end;
+    uint32_t seq;
+    size_t keyBytes;
+    size_t deltaBytes;
+    uint8_t trailer[SHA_DIGEST_LENGTH];
+    uint32_t moduleLen[NUM_STATE_MODULES];
+    uint8_t *hashes[NUM_STATE_MODULES];
+} lastFrame = { 0 };
+
+// memory stream backing module save/load for the chunked container
+static StateBuffer_s *moduleStream = NULL;
+
+static inline uint32_t _state_numChunks(uint32_t len) {
+    return (len + STATE_CHUNK_SIZ - 1) / STATE_CHUNK_SIZ;
+}
 
-#if !TESTING
-    assert(cpu_isPaused() && "should be paused to save state");
-#endif
+static inline uint32_t _state_chunkLen(uint32_t len, uint32_t idx) {
+    return MIN(STATE_CHUNK_SIZ, len - (idx * STATE_CHUNK_SIZ));
+}
 
-    do {
-        // save header
-        if (!_save_state(fd, (const uint8_t *)SAVE_MAGICK2, SAVE_MAGICK_LEN)) {
-            break;
+static inline uint32_t _state_get32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | ((uint32_t)p[3] << 0);
+}
+
+static inline void _state_put32(uint8_t *p, uint32_t val) {
+    p[0] = (uint8_t)((val & 0xFF000000) >> 24);
+    p[1] = (uint8_t)((val & 0xFF0000  ) >> 16);
+    p[2] = (uint8_t)((val & 0xFF00    ) >>  8);
+    p[3] = (uint8_t)((val & 0xFF      ) >>  0);
+}
+
+static bool _buffer_resize(StateBuffer_s *buffer, size_t len) {
+    if (len > buffer->cap) {
+        size_t cap = MAX(len, buffer->cap << 1);
+        uint8_t *buf = REALLOC(buffer->buf, cap);
+        if (!buf) {
+            LOG("OOPS, not enough memory for %lu bytes of save-state", (unsigned long)cap);
+            return false;
         }
+        memset(buf + buffer->cap, 0x0, cap - buffer->cap);
+        buffer->buf = buf;
+        buffer->cap = cap;
+    }
+    buffer->len = len;
+    return true;
+}
 
-        StateHelper_s helper = {
-            .fd = fd,
-            .version = SAVE_VERSION,
-            .save = &_save_state,
-            .load = &_load_state,
-        };
+static bool _buffer_append(StateBuffer_s *buffer, const uint8_t *data, size_t len) {
+    if (!len) {
+        return true;
+    }
+    size_t pos = buffer->len;
+    if (!_buffer_resize(buffer, pos + len)) {
+        return false;
+    }
+    memcpy(buffer->buf + pos, data, len);
+    return true;
+}
 
-        if (!disk6_saveState(&helper)) {
-            break;
+static bool _buffer_append32(StateBuffer_s *buffer, uint32_t val) {
+    uint8_t serialized[4];
+    _state_put32(serialized, val);
+    return _buffer_append(buffer, serialized, 4);
+}
+
+static void _buffer_destroy(StateBuffer_s *buffer) {
+    if (buffer->buf) {
+        FREE(buffer->buf);
+    }
+    memset(buffer, 0x0, sizeof(*buffer));
+}
+
+static bool _save_stream(int fd, const uint8_t * outbuf, ssize_t outmax) {
+    (void)fd;
+    return _buffer_append(moduleStream, outbuf, outmax);
+}
+
+static bool _load_stream(int fd, uint8_t * inbuf, ssize_t inmax) {
+    (void)fd;
+    if (UNLIKELY(moduleStream->pos + inmax > moduleStream->len)) {
+        LOG("OOPS, encountered truncated save-state stream");
+        return false;
+    }
+    memcpy(inbuf, moduleStream->buf + moduleStream->pos, inmax);
+    moduleStream->pos += inmax;
+    return true;
+}
+
+static bool _save_modules(StateBuffer_s modules[NUM_STATE_MODULES], bool isRewind) {
+    static bool (*const savers[NUM_STATE_MODULES])(StateHelper_s *) = {
+        [STATE_MODULE_DISK] = &disk6_saveState,
+        [STATE_MODULE_VM] = &vm_saveState,
+        [STATE_MODULE_CPU] = &cpu65_saveState,
+        [STATE_MODULE_TIMING] = &timing_saveState,
+        [STATE_MODULE_VIDEO] = &video_saveState,
+        [STATE_MODULE_MB] = &mb_saveState,
+    };
+
+    StateHelper_s helper = {
+        .fd = -1,
+        .version = SAVE_VERSION,
+        .diskFdA = -1,
+        .diskFdB = -1,
+        .save = &_save_stream,
+        .load = &_load_stream,
+        .isRewind = isRewind,
+    };
+
+    bool saved = true;
+    for (unsigned int m = 0; m < NUM_STATE_MODULES && saved; m++) {
+        moduleStream = &modules[m];
+        saved = savers[m](&helper);
+        if (saved && UNLIKELY(modules[m].len > UINT32_MAX)) {
+            saved = false;
         }
+    }
+    moduleStream = NULL;
+
+    return saved;
+}
+
+// Build a frame from freshly saved module streams.  Chunks are compared against lastFrame hashes unless keyFrame is
+// set.  Hashes of the new frame are returned to the caller in hashes[].
+static bool _build_frame(StateBuffer_s *frame, StateBuffer_s modules[NUM_STATE_MODULES], bool keyFrame, uint32_t seq, OUTPARM uint8_t *hashes[NUM_STATE_MODULES]) {
+    uint8_t packed[STATE_CHUNK_SIZ + (STATE_CHUNK_SIZ>>3)];
+    uint8_t hdr[STATE_RECORD_HDR_SIZ];
+
+    frame->len = 0;
+    if (!_buffer_append(frame, (const uint8_t *)STATE_FRAME_MAGICK, STATE_FRAME_MAGICK_LEN)) {
+        return false;
+    }
+    bool ok = _buffer_append32(frame, 0); // frameLen placeholder
+    ok = ok && _buffer_append32(frame, seq);
+    ok = ok && _buffer_append32(frame, keyFrame ? STATE_FRAME_KEY : 0);
+    for (unsigned int m = 0; m < NUM_STATE_MODULES; m++) {
+        ok = ok && _buffer_append32(frame, (uint32_t)modules[m].len);
+    }
+    size_t numRecordsPos = frame->len;
+    ok = ok && _buffer_append32(frame, 0); // numRecords placeholder
+    if (!ok) {
+        return false;
+    }
+
+    uint32_t numRecords = 0;
+    for (unsigned int m = 0; m < NUM_STATE_MODULES; m++) {
+        uint32_t len = (uint32_t)modules[m].len;
+        uint32_t numChunks = _state_numChunks(len);
+        uint32_t lastNumChunks = lastFrame.valid ? _state_numChunks(lastFrame.moduleLen[m]) : 0;
+
+        hashes[m] = MALLOC(MAX(numChunks, 1) * SHA_DIGEST_LENGTH);
+        if (!hashes[m]) {
+            return false;
+        }
+
+        for (uint32_t idx = 0; idx < numChunks; idx++) {
+            const uint8_t *chunk = modules[m].buf + (idx * STATE_CHUNK_SIZ);
+            uint32_t chunkLen = _state_chunkLen(len, idx);
+            uint8_t *md = hashes[m] + (idx * SHA_DIGEST_LENGTH);
+            SHA1(chunk, chunkLen, md);
+
+            if (!keyFrame && idx < lastNumChunks && memcmp(md, lastFrame.hashes[m] + (idx * SHA_DIGEST_LENGTH), SHA_DIGEST_LENGTH) == 0) {
+                continue; // unchanged since last frame
+            }
+
+            unsigned int packedLen = sizeof(packed);
+            state_encoding_t encoding = STATE_ENCODING_ZLIB;
+            if (zlib_compress_chunk(chunk, chunkLen, packed, &packedLen) != NULL || packedLen >= chunkLen) {
+                encoding = STATE_ENCODING_RAW;
+                packedLen = chunkLen;
+            }
 
-        if (!vm_saveState(&helper)) {
+            hdr[0] = (uint8_t)m;
+            hdr[1] = (uint8_t)encoding;
+            _state_put32(hdr + 2, idx);
+            _state_put32(hdr + 6, packedLen);
+            memcpy(hdr + 10, md, SHA_DIGEST_LENGTH);
+            if (!_buffer_append(frame, hdr, sizeof(hdr))) {
+                return false;
+            }
+            if (!_buffer_append(frame, encoding == STATE_ENCODING_RAW ? chunk : packed, packedLen)) {
+                return false;
+            }
+            ++numRecords;
+        }
+    }
+    _state_put32(frame->buf + numRecordsPos, numRecords);
+
+    // manifest
+    for (unsigned int m = 0; m < NUM_STATE_MODULES; m++) {
+        if (!_buffer_append(frame, hashes[m], _state_numChunks((uint32_t)modules[m].len) * SHA_DIGEST_LENGTH)) {
+            return false;
+        }
+    }
+
+    // trailer
+    _state_put32(frame->buf + STATE_FRAME_MAGICK_LEN, (uint32_t)(frame->len + SHA_DIGEST_LENGTH - (STATE_FRAME_MAGICK_LEN + 4)));
+    uint8_t md[SHA_DIGEST_LENGTH];
+    SHA1(frame->buf, frame->len, md);
+    return _buffer_append(frame, md, SHA_DIGEST_LENGTH);
+}
+
+static void _forget_frame(void) {
+    for (unsigned int m = 0; m < NUM_STATE_MODULES; m++) {
+        if (lastFrame.hashes[m]) {
+            FREE(lastFrame.hashes[m]);
+        }
+    }
+    memset(&lastFrame, 0x0, sizeof(lastFrame));
+}
+
+// Is fd the file (unchanged) that the last frame was appended to?
+static bool _can_append_frame(int fd, const struct stat *stat_buf) {
+    if (!lastFrame.valid) {
+        return false;
+    }
+    if (stat_buf->st_dev != lastFrame.dev || stat_buf->st_ino != lastFrame.ino || stat_buf->st_size != lastFrame.end) {
+        return false;
+    }
+    if (lastFrame.deltaBytes > lastFrame.keyBytes) {
+        return false; // compact : delta frames now outweigh a fresh key frame
+    }
+
+    uint8_t trailer[SHA_DIGEST_LENGTH];
+    ssize_t len = -1;
+    TEMP_FAILURE_RETRY(len = pread(fd, trailer, SHA_DIGEST_LENGTH, lastFrame.end - SHA_DIGEST_LENGTH));
+    return (len == SHA_DIGEST_LENGTH) && (memcmp(trailer, lastFrame.trailer, SHA_DIGEST_LENGTH) == 0);
+}
+
+static bool _save_chunked(int fd, bool delta) {
+    StateBuffer_s modules[NUM_STATE_MODULES] = { { 0 } };
+    StateBuffer_s frame = { 0 };
+    uint8_t *hashes[NUM_STATE_MODULES] = { 0 };
+    bool saved = false;
+
+    do {
+        if (!_save_modules(modules, /*isRewind:*/false)) {
             break;
         }
 
-        if (!cpu65_saveState(&helper)) {
+        struct stat stat_buf;
+        if (UNLIKELY(fstat(fd, &stat_buf) < 0)) {
+            LOG("OOPS, could not stat FD (%s)", strerror(errno));
             break;
         }
 
-        if (!timing_saveState(&helper)) {
+        bool append = delta && _can_append_frame(fd, &stat_buf);
+        if (append) {
+            if (lseek(fd, 0, SEEK_END) < 0) {
+                LOG("OOPS, could not lseek FD (%s)", strerror(errno));
+                break;
+            }
+        } else if (delta) {
+            // start over with a key frame
+            int ret = -1;
+            TEMP_FAILURE_RETRY(ret = ftruncate(fd, 0));
+            if (ret < 0 || lseek(fd, 0, SEEK_SET) < 0) {
+                LOG("OOPS, could not reset save-state FD (%s)", strerror(errno));
+                break;
+            }
+        }
+
+        uint32_t seq = append ? lastFrame.seq + 1 : 0;
+        if (!_build_frame(&frame, modules, /*keyFrame:*/!append, seq, hashes)) {
             break;
         }
 
-        if (!video_saveState(&helper)) {
+        if (!append && !_save_state(fd, (const uint8_t *)SAVE_MAGICK3, SAVE_MAGICK_LEN)) {
             break;
         }
+        if (!_save_state(fd, frame.buf, frame.len)) {
+            break;
+        }
+
+        if (!append) {
+            // key frames are explicit saves or compactions, delta frames can be lost without harm
+            TEMP_FAILURE_RETRY(fsync(fd));
+        }
 
-        if (!mb_saveState(&helper)) {
+        off_t end = lseek(fd, 0, SEEK_CUR);
+        if (end < 0) {
             break;
         }
 
-        TEMP_FAILURE_RETRY(fsync(fd));
+        size_t keyBytes = lastFrame.keyBytes;
+        size_t deltaBytes = lastFrame.deltaBytes;
+        _forget_frame();
+        lastFrame.valid = true;
+        lastFrame.dev = stat_buf.st_dev;
+        lastFrame.ino = stat_buf.st_ino;
+        lastFrame.end = end;
+        lastFrame.seq = seq;
+        lastFrame.keyBytes = append ? keyBytes : frame.len;
+        lastFrame.deltaBytes = append ? deltaBytes + frame.len : 0;
+        memcpy(lastFrame.trailer, frame.buf + frame.len - SHA_DIGEST_LENGTH, SHA_DIGEST_LENGTH);
+        for (unsigned int m = 0; m < NUM_STATE_MODULES; m++) {
+            lastFrame.moduleLen[m] = (uint32_t)modules[m].len;
+            lastFrame.hashes[m] = hashes[m];
+            hashes[m] = NULL;
+        }
+
         saved = true;
     } while (0);
 
+    if (!saved) {
+        _forget_frame();
+    }
+
+    for (unsigned int m = 0; m < NUM_STATE_MODULES; m++) {
+        _buffer_destroy(&modules[m]);
+        if (hashes[m]) {
+            FREE(hashes[m]);
+        }
+    }
+    _buffer_destroy(&frame);
+
     return saved;
 }
 
+// Apply one verified frame to the module buffers
+static bool _apply_frame(const uint8_t *p, size_t frameSiz, bool first, StateBuffer_s modules[NUM_STATE_MODULES], OUTPARM const uint8_t **manifest) {
+    size_t hdrSiz = STATE_FRAME_MAGICK_LEN + 4 + 4 + 4 + (NUM_STATE_MODULES * 4) + 4;
+    if (frameSiz < hdrSiz + SHA_DIGEST_LENGTH) {
+        return false;
+    }
+
+    const uint8_t *end = p + frameSiz - SHA_DIGEST_LENGTH;
+    uint32_t flags = _state_get32(p + 12);
+    if (first && !(flags & STATE_FRAME_KEY)) {
+        LOG("OOPS, save-state does not begin with a key frame");
+        return false;
+    }
+
+    uint32_t numChunks = 0;
+    for (unsigned int m = 0; m < NUM_STATE_MODULES; m++) {
+        uint32_t len = _state_get32(p + 16 + (m * 4));
+        if ((flags & STATE_FRAME_KEY)) {
+            modules[m].len = 0;
+        }
+        size_t oldLen = modules[m].len;
+        if (!_buffer_resize(&modules[m], len)) {
+            return false;
+        }
+        if (len > oldLen) {
+            memset(modules[m].buf + oldLen, 0x0, len - oldLen);
+        }
+        numChunks += _state_numChunks(len);
+    }
+
+    const uint8_t *rec = p + hdrSiz;
+    uint32_t numRecords = _state_get32(rec - 4);
+    for (uint32_t r = 0; r < numRecords; r++) {
+        if (rec + STATE_RECORD_HDR_SIZ > end) {
+            return false;
+        }
+        unsigned int m = rec[0];
+        state_encoding_t encoding = (state_encoding_t)rec[1];
+        uint32_t idx = _state_get32(rec + 2);
+        uint32_t storedLen = _state_get32(rec + 6);
+        const uint8_t *data = rec + STATE_RECORD_HDR_SIZ;
+        if (m >= NUM_STATE_MODULES || idx >= _state_numChunks((uint32_t)modules[m].len) || data + storedLen > end) {
+            return false;
+        }
+
+        uint32_t chunkLen = _state_chunkLen((uint32_t)modules[m].len, idx);
+        uint8_t *chunk = modules[m].buf + (idx * STATE_CHUNK_SIZ);
+        if (encoding == STATE_ENCODING_ZLIB) {
+            const char *err = zlib_uncompress_chunk(data, storedLen, chunk, chunkLen);
+            if (err) {
+                LOG("OOPS, could not inflate save-state chunk : %s", err);
+                return false;
+            }
+        } else if (encoding == STATE_ENCODING_RAW && storedLen == chunkLen) {
+            memcpy(chunk, data, chunkLen);
+        } else {
+            return false;
+        }
+
+        rec = data + storedLen;
+    }
+
+    if (rec + (numChunks * SHA_DIGEST_LENGTH) != end) {
+        return false;
+    }
+    *manifest = rec;
+
+    return true;
+}
+
+// Reconstruct the concatenated module streams from a chunked save-state file positioned after the header magick
+static bool _load_chunked(int fd, StateBuffer_s *stream) {
+    StateBuffer_s file = { 0 };
+    StateBuffer_s modules[NUM_STATE_MODULES] = { { 0 } };
+    bool loaded = false;
+
+    do {
+        struct stat stat_buf;
+        if (UNLIKELY(fstat(fd, &stat_buf) < 0)) {
+            LOG("OOPS, could not stat FD (%s)", strerror(errno));
+            break;
+        }
+        off_t filePos = lseek(fd, 0, SEEK_CUR);
+        if (UNLIKELY(filePos < 0)) {
+            LOG("OOPS, could not lseek FD (%s)", strerror(errno));
+            break;
+        }
+        if (stat_buf.st_size <= filePos || !_buffer_resize(&file, stat_buf.st_size - filePos)) {
+            break;
+        }
+        if (!_load_state(fd, file.buf, file.len)) {
+            break;
+        }
+
+        const uint8_t *manifest = NULL;
+        unsigned int numFrames = 0;
+        size_t pos = 0;
+        while (pos + STATE_FRAME_MAGICK_LEN + 4 <= file.len) {
+            const uint8_t *p = file.buf + pos;
+            if (memcmp(p, STATE_FRAME_MAGICK, STATE_FRAME_MAGICK_LEN) != 0) {
+                break;
+            }
+            size_t frameSiz = STATE_FRAME_MAGICK_LEN + 4 + (size_t)_state_get32(p + STATE_FRAME_MAGICK_LEN);
+            if (frameSiz < SHA_DIGEST_LENGTH || pos + frameSiz > file.len) {
+                break;
+            }
+            uint8_t md[SHA_DIGEST_LENGTH];
+            SHA1(p, frameSiz - SHA_DIGEST_LENGTH, md);
+            if (memcmp(md, p + frameSiz - SHA_DIGEST_LENGTH, SHA_DIGEST_LENGTH) != 0) {
+                break;
+            }
+            if (!_apply_frame(p, frameSiz, /*first:*/numFrames == 0, modules, &manifest)) {
+                LOG("OOPS, malformed save-state frame %u", numFrames);
+                manifest = NULL;
+                break;
+            }
+            ++numFrames;
+            pos += frameSiz;
+        }
+
+        if (!manifest) {
+            LOG("OOPS, no valid frames in save-state file");
+            break;
+        }
+        if (pos != file.len) {
+            LOG("Ignoring %lu trailing bytes of incomplete save-state frame", (unsigned long)(file.len - pos));
+        }
+
+        // verify reconstructed chunks against the manifest of the last good frame, then concatenate
+        bool verified = true;
+        stream->len = 0;
+        for (unsigned int m = 0; m < NUM_STATE_MODULES && verified; m++) {
+            uint32_t len = (uint32_t)modules[m].len;
+            for (uint32_t idx = 0; idx < _state_numChunks(len); idx++) {
+                uint8_t md[SHA_DIGEST_LENGTH];
+                SHA1(modules[m].buf + (idx * STATE_CHUNK_SIZ), _state_chunkLen(len, idx), md);
+                if (memcmp(md, manifest, SHA_DIGEST_LENGTH) != 0) {
+                    LOG("OOPS, save-state chunk %u:%u does not match manifest", m, idx);
+                    verified = false;
+                    break;
+                }
+                manifest += SHA_DIGEST_LENGTH;
+            }
+            verified = verified && _buffer_append(stream, modules[m].buf, len);
+        }
+        stream->pos = 0;
+
+        loaded = verified;
+    } while (0);
+
+    for (unsigned int m = 0; m < NUM_STATE_MODULES; m++) {
+        _buffer_destroy(&modules[m]);
+    }
+    _buffer_destroy(&file);
+
+    return loaded;
+}
+
+// ----------------------------------------------------------------------------
+
+bool emulator_saveState(int fd) {
+#if !TESTING
+    assert(cpu_isPaused() && "should be paused to save state");
+#endif
+
+    return _save_chunked(fd, /*delta:*/false);
+}
+
+bool emulator_saveStateDelta(int fd) {
+#if !TESTING
+    assert(cpu_isPaused() && "should be paused to save state");
+#endif
+
+    return _save_chunked(fd, /*delta:*/true);
+}
+
 bool emulator_loadState(int fd, int fdA, int fdB) {
     bool loaded = false;
+    StateBuffer_s stream = { 0 };
 
 #if !TESTING
     assert(cpu_isPaused() && "should be paused to load state");
@@ -251,6 +766,18 @@ bool emulator_loadState(int fd, int fdA, int fdB) {
             .load = &_load_state,
         };
 
+        if (version >= 3) {
+            if (!_load_chunked(fd, &stream)) {
+                break;
+            }
+            moduleStream = &stream;
+            helper.fd = -1;
+            helper.version = SAVE_VERSION;
+            helper.save = &_save_stream;
+            helper.load = &_load_stream;
+            version = SAVE_VERSION;
+        }
+
         if (!disk6_loadState(&helper)) {
             break;
         }
@@ -281,23 +808,32 @@ bool emulator_loadState(int fd, int fdA, int fdB) {
 
         // sanity-check whole file was read
 
-        struct stat stat_buf;
-        if (fstat(fd, &stat_buf) < 0) {
-            LOG("OOPS, could not stat FD (%s)", strerror(errno));
-        }
-        off_t fileSiz = stat_buf.st_size;
-        off_t filePos = lseek(fd, 0, SEEK_CUR);
-        if (filePos < 0) {
-            LOG("OOPS, could not lseek FD (%s)", strerror(errno));
-        }
+        if (moduleStream) {
+            if (UNLIKELY(stream.pos != stream.len)) {
+                LOG("OOPS, state stream read: %lu total: %lu", (unsigned long)stream.pos, (unsigned long)stream.len);
+            }
+        } else {
+            struct stat stat_buf;
+            if (fstat(fd, &stat_buf) < 0) {
+                LOG("OOPS, could not stat FD (%s)", strerror(errno));
+            }
+            off_t fileSiz = stat_buf.st_size;
+            off_t filePos = lseek(fd, 0, SEEK_CUR);
+            if (filePos < 0) {
+                LOG("OOPS, could not lseek FD (%s)", strerror(errno));
+            }
 
-        if (UNLIKELY(filePos != fileSiz)) {
-            LOG("OOPS, state file read: %lu total: %lu", (unsigned long)filePos, (unsigned long)fileSiz);
+            if (UNLIKELY(filePos != fileSiz)) {
+                LOG("OOPS, state file read: %lu total: %lu", (unsigned long)filePos, (unsigned long)fileSiz);
+            }
         }
 
         loaded = true;
     } while (0);
 
+    moduleStream = NULL;
+    _buffer_destroy(&stream);
+
     if (!loaded) {
         LOG("OOPS, problem(s) encountered loading emulator save-state file");
     }
@@ -307,6 +843,7 @@ bool emulator_loadState(int fd, int fdA, int fdB) {
 
 bool emulator_stateExtractDiskPaths(int fd, JSON_ref json) {
     bool loaded = false;
+    StateBuffer_s stream = { 0 };
 
     do {
         int version = _load_magick(fd);
@@ -323,6 +860,17 @@ bool emulator_stateExtractDiskPaths(int fd, JSON_ref json) {
             .load = &_load_state,
         };
 
+        if (version >= 3) {
+            if (!_load_chunked(fd, &stream)) {
+                break;
+            }
+            moduleStream = &stream;
+            helper.fd = -1;
+            helper.version = SAVE_VERSION;
+            helper.save = &_save_stream;
+            helper.load = &_load_stream;
+        }
+
         if (!disk6_stateExtractDiskPaths(&helper, json)) {
             break;
         }
@@ -330,6 +878,9 @@ bool emulator_stateExtractDiskPaths(int fd, JSON_ref json) {
         loaded = true;
     } while (0);
 
+    moduleStream = NULL;
+    _buffer_destroy(&stream);
+
     if (fd >= 0) {
         // Ensure that we leave the file descriptor ready for a call to emulator_loadState()
         off_t ret = lseek(fd, 0, SEEK_SET);
@@ -345,6 +896,342 @@ bool emulator_stateExtractDiskPaths(int fd, JSON_ref json) {
     return loaded;
 }
 
+// ----------------------------------------------------------------------------
+// Rewind ring
+//
+// The CPU thread captures the module streams every rewindRing.interval frames, split into the same STATE_CHUNK_SIZ
+// chunks as the chunked container.  A chunk identical to the one at the same position of the previous capture (kept
+// raw, compared directly as hashing costs more than the capture itself) is shared by reference with the previous
+// snapshot, so a snapshot only costs the pages dirtied since the one before it.  New chunks are stored zlib-compressed.
+// The oldest snapshots are dropped to stay within the memory budget.
+//
+// The ring is off unless PREF_REWIND_BUDGET (megabytes) is set : a capture runs on the CPU thread under the
+// interface_mutex and costs a few percent of emulation throughput at the default interval.
+
+#define REWIND_INTERVAL_FRAMES 30 // ~0.5 sec
+#define REWIND_MAX_SNAPSHOTS 1024
+
+typedef struct RewindChunk_s {
+    uint32_t refs;
+    uint32_t len;
+    uint32_t storedLen;
+    uint8_t encoding;
+    uint8_t data[];
+} RewindChunk_s;
+
+typedef struct RewindSnapshot_s {
+    unsigned long cycles; // rewind clock at capture
+    uint32_t moduleLen[NUM_STATE_MODULES];
+    RewindChunk_s **chunks[NUM_STATE_MODULES];
+} RewindSnapshot_s;
+
+static struct {
+    unsigned long interval;     // cycles between snapshots
+    size_t budget;              // 0 : disabled
+    size_t used;                // bytes held by chunks and chunk tables
+    unsigned long cycles;       // rewind clock : emulated cycles, continuous across cold boots and rewinds
+    unsigned long mark;         // cycles_count_total when the clock was last advanced
+    unsigned long lastCapture;
+    unsigned int oldest;
+    unsigned int count;
+    RewindSnapshot_s ring[REWIND_MAX_SNAPSHOTS];
+    StateBuffer_s modules[NUM_STATE_MODULES]; // capture/restore scratch streams
+    StateBuffer_s previous[NUM_STATE_MODULES]; // streams of the newest snapshot (when previousValid)
+    bool previousValid;
+    volatile size_t prefBudget; // PREF_REWIND_BUDGET, applied by the CPU thread at the next checkpoint
+    size_t appliedPrefBudget;
+} rewindRing = {
+    .interval = REWIND_INTERVAL_FRAMES * CYCLES_FRAME,
+};
+
+static inline RewindSnapshot_s *_rewind_snapshot(unsigned int n) {
+    return &rewindRing.ring[(rewindRing.oldest + n) % REWIND_MAX_SNAPSHOTS];
+}
+
+static void _rewind_release(RewindSnapshot_s *snap) {
+    for (unsigned int m = 0; m < NUM_STATE_MODULES; m++) {
+        uint32_t numChunks = _state_numChunks(snap->moduleLen[m]);
+        for (uint32_t idx = 0; idx < numChunks && snap->chunks[m]; idx++) {
+            RewindChunk_s *chunk = snap->chunks[m][idx];
+            if (chunk && --chunk->refs == 0) {
+                rewindRing.used -= sizeof(RewindChunk_s) + chunk->storedLen;
+                FREE(chunk);
+            }
+        }
+        if (snap->chunks[m]) {
+            rewindRing.used -= numChunks * sizeof(RewindChunk_s *);
+            FREE(snap->chunks[m]);
+        }
+    }
+    memset(snap, 0x0, sizeof(*snap));
+}
+
+static void _rewind_dropOldest(void) {
+    assert(rewindRing.count);
+    _rewind_release(_rewind_snapshot(0));
+    rewindRing.oldest = (rewindRing.oldest + 1) % REWIND_MAX_SNAPSHOTS;
+    --rewindRing.count;
+}
+
+static void _rewind_dropNewest(void) {
+    assert(rewindRing.count);
+    _rewind_release(_rewind_snapshot(rewindRing.count - 1));
+    --rewindRing.count;
+}
+
+static void _rewind_clear(void) {
+    while (rewindRing.count) {
+        _rewind_dropOldest();
+    }
+    for (unsigned int m = 0; m < NUM_STATE_MODULES; m++) {
+        _buffer_destroy(&rewindRing.modules[m]);
+        _buffer_destroy(&rewindRing.previous[m]);
+    }
+    rewindRing.previousValid = false;
+    assert(rewindRing.used == 0);
+}
+
+// Keep the streams just captured/restored (those of the newest snapshot) for comparison with the next capture
+static void _rewind_keepStreams(void) {
+    for (unsigned int m = 0; m < NUM_STATE_MODULES; m++) {
+        StateBuffer_s swap = rewindRing.previous[m];
+        rewindRing.previous[m] = rewindRing.modules[m];
+        rewindRing.modules[m] = swap;
+    }
+    rewindRing.previousValid = true;
+}
+
+static bool _rewind_capture(void) {
+    StateBuffer_s *modules = rewindRing.modules;
+    for (unsigned int m = 0; m < NUM_STATE_MODULES; m++) {
+        modules[m].len = 0;
+    }
+    if (!_save_modules(modules, /*isRewind:*/true)) {
+        return false;
+    }
+
+    if (rewindRing.count == REWIND_MAX_SNAPSHOTS) {
+        _rewind_dropOldest();
+    }
+    const RewindSnapshot_s *prev = (rewindRing.count && rewindRing.previousValid) ? _rewind_snapshot(rewindRing.count - 1) : NULL;
+    RewindSnapshot_s *snap = _rewind_snapshot(rewindRing.count);
+    assert(snap != prev);
+    snap->cycles = rewindRing.cycles;
+
+    uint8_t packed[STATE_CHUNK_SIZ + (STATE_CHUNK_SIZ>>3)];
+    bool captured = true;
+    for (unsigned int m = 0; m < NUM_STATE_MODULES && captured; m++) {
+        uint32_t len = (uint32_t)modules[m].len;
+        uint32_t numChunks = _state_numChunks(len);
+        uint32_t prevNumChunks = prev ? _state_numChunks(prev->moduleLen[m]) : 0;
+
+        snap->moduleLen[m] = len;
+        snap->chunks[m] = CALLOC(MAX(numChunks, 1), sizeof(RewindChunk_s *));
+        if (!snap->chunks[m]) {
+            snap->moduleLen[m] = 0;
+            captured = false;
+            break;
+        }
+        rewindRing.used += numChunks * sizeof(RewindChunk_s *);
+
+        for (uint32_t idx = 0; idx < numChunks; idx++) {
+            const uint8_t *data = modules[m].buf + (idx * STATE_CHUNK_SIZ);
+            uint32_t chunkLen = _state_chunkLen(len, idx);
+
+            if (idx < prevNumChunks) {
+                RewindChunk_s *shared = prev->chunks[m][idx];
+                if (shared->len == chunkLen && memcmp(rewindRing.previous[m].buf + (idx * STATE_CHUNK_SIZ), data, chunkLen) == 0) {
+                    ++shared->refs; // unchanged since previous snapshot
+                    snap->chunks[m][idx] = shared;
+                    continue;
+                }
+            }
+
+            unsigned int packedLen = sizeof(packed);
+            state_encoding_t encoding = STATE_ENCODING_ZLIB;
+            if (zlib_compress_chunk(data, chunkLen, packed, &packedLen) != NULL || packedLen >= chunkLen) {
+                encoding = STATE_ENCODING_RAW;
+                packedLen = chunkLen;
+            }
+
+            RewindChunk_s *chunk = MALLOC(sizeof(RewindChunk_s) + packedLen);
+            if (!chunk) {
+                captured = false;
+                break;
+            }
+            chunk->refs = 1;
+            chunk->len = chunkLen;
+            chunk->storedLen = packedLen;
+            chunk->encoding = (uint8_t)encoding;
+            memcpy(chunk->data, encoding == STATE_ENCODING_RAW ? data : packed, packedLen);
+            rewindRing.used += sizeof(RewindChunk_s) + packedLen;
+            snap->chunks[m][idx] = chunk;
+        }
+    }
+
+    ++rewindRing.count;
+    if (!captured) {
+        LOG("OOPS, could not capture rewind snapshot");
+        _rewind_dropNewest();
+        return false;
+    }
+    _rewind_keepStreams();
+
+    while (rewindRing.used > rewindRing.budget && rewindRing.count > 1) {
+        _rewind_dropOldest();
+    }
+
+    return true;
+}
+
+static bool _rewind_restore(const RewindSnapshot_s *snap) {
+    static bool (*const loaders[NUM_STATE_MODULES])(StateHelper_s *) = {
+        [STATE_MODULE_DISK] = &disk6_loadState,
+        [STATE_MODULE_VM] = &vm_loadState,
+        [STATE_MODULE_CPU] = &cpu65_loadState,
+        [STATE_MODULE_TIMING] = &timing_loadState,
+        [STATE_MODULE_VIDEO] = &video_loadState,
+        [STATE_MODULE_MB] = &mb_loadState,
+    };
+
+    StateBuffer_s *modules = rewindRing.modules;
+    for (unsigned int m = 0; m < NUM_STATE_MODULES; m++) {
+        uint32_t len = snap->moduleLen[m];
+        if (!_buffer_resize(&modules[m], len)) {
+            return false;
+        }
+        modules[m].pos = 0;
+        uint32_t numChunks = _state_numChunks(len);
+        for (uint32_t idx = 0; idx < numChunks; idx++) {
+            const RewindChunk_s *chunk = snap->chunks[m][idx];
+            uint8_t *data = modules[m].buf + (idx * STATE_CHUNK_SIZ);
+            if (chunk->encoding == STATE_ENCODING_ZLIB) {
+                const char *err = zlib_uncompress_chunk(chunk->data, chunk->storedLen, data, chunk->len);
+                if (err) {
+                    LOG("OOPS, could not inflate rewind chunk : %s", err);
+                    return false;
+                }
+            } else {
+                memcpy(data, chunk->data, chunk->len);
+            }
+        }
+    }
+
+    StateHelper_s helper = {
+        .fd = -1,
+        .version = SAVE_VERSION,
+        .diskFdA = -1,
+        .diskFdB = -1,
+        .save = &_save_stream,
+        .load = &_load_stream,
+        .isRewind = true,
+    };
+
+    bool loaded = true;
+    for (unsigned int m = 0; m < NUM_STATE_MODULES && loaded; m++) {
+        moduleStream = &modules[m];
+        loaded = loaders[m](&helper);
+        if (loaded && UNLIKELY(modules[m].pos != modules[m].len)) {
+            LOG("OOPS, rewind stream %u read: %lu total: %lu", m, (unsigned long)modules[m].pos, (unsigned long)modules[m].len);
+        }
+    }
+    moduleStream = NULL;
+
+    return loaded;
+}
+
+// Advance the rewind clock by the cycles executed since the last call (cycles_count_total restarts on cold boot)
+static void _rewind_advanceClock(void) {
+    unsigned long total = cycles_count_total;
+    rewindRing.cycles += (total >= rewindRing.mark) ? (total - rewindRing.mark) : total;
+    rewindRing.mark = total;
+}
+
+void emulator_rewindConfigure(unsigned long intervalFrames, size_t budget) {
+#if !TESTING
+    assert((cpu_isPaused() || timing_isCPUThread()) && "should be paused to configure rewind");
+#endif
+    _rewind_clear();
+    rewindRing.interval = MAX(intervalFrames, 1) * CYCLES_FRAME;
+    rewindRing.budget = budget;
+    rewindRing.lastCapture = rewindRing.cycles;
+}
+
+bool emulator_rewind(unsigned int seconds) {
+#if !TESTING
+    assert((cpu_isPaused() || timing_isCPUThread()) && "should be paused to rewind");
+#endif
+
+    if (replay_isRecording() || replay_isPlaying()) {
+        LOG("OOPS, cannot rewind during a replay session");
+        return false;
+    }
+    if (!rewindRing.count) {
+        return false;
+    }
+
+    const unsigned long back = (unsigned long)(seconds * CLK_6502);
+    const unsigned long target = (rewindRing.cycles > back) ? (rewindRing.cycles - back) : 0;
+    while (rewindRing.count > 1 && _rewind_snapshot(rewindRing.count - 1)->cycles > target) {
+        _rewind_dropNewest();
+        rewindRing.previousValid = false;
+    }
+
+    const RewindSnapshot_s *snap = _rewind_snapshot(rewindRing.count - 1);
+    if (!_rewind_restore(snap)) {
+        LOG("OOPS, problem(s) encountered restoring rewind snapshot");
+        return false;
+    }
+    _rewind_keepStreams();
+
+    LOG("rewound %.2f secs", (rewindRing.cycles - snap->cycles) / CLK_6502);
+    rewindRing.mark = cycles_count_total;
+    rewindRing.cycles = snap->cycles;
+    rewindRing.lastCapture = snap->cycles;
+
+    return true;
+}
+
+unsigned int emulator_rewindAvailable(void) {
+    if (!rewindRing.count) {
+        return 0;
+    }
+    return (unsigned int)((rewindRing.cycles - _rewind_snapshot(0)->cycles) / CLK_6502);
+}
+
+void emulator_rewindCheckpoint(void) {
+    ASSERT_ON_CPU_THREAD();
+
+    if (UNLIKELY(rewindRing.prefBudget != rewindRing.appliedPrefBudget)) {
+        rewindRing.appliedPrefBudget = rewindRing.prefBudget;
+        emulator_rewindConfigure(REWIND_INTERVAL_FRAMES, rewindRing.appliedPrefBudget);
+    }
+
+    if (!rewindRing.budget) {
+        return;
+    }
+
+    _rewind_advanceClock();
+    if (rewindRing.cycles - rewindRing.lastCapture < rewindRing.interval && rewindRing.count) {
+        return;
+    }
+    rewindRing.lastCapture = rewindRing.cycles;
+
+    _rewind_capture();
+}
+
+static void _rewind_prefsChanged(const char *domain) {
+    (void)domain;
+
+    long lVal = 0;
+    long megs = prefs_parseLongValue(PREF_DOMAIN_VM, PREF_REWIND_BUDGET, &lVal, /*base:*/10) ? lVal : 0;
+    rewindRing.prefBudget = (megs > 0) ? (size_t)megs * 1024 * 1024 : 0;
+}
+
+static __attribute__((constructor)) void _init_rewind(void) {
+    prefs_registerListener(PREF_DOMAIN_VM, &_rewind_prefsChanged);
+}
+
 static void _shutdown_threads(void) {
 #if defined(__linux__) && !defined(ANDROID)
     LOG("Emulator waiting for other threads to clean up...");
@@ -441,12 +1328,30 @@ void emulator_start(void) {
     timing_startCPU();
 }
 
+void emulator_prepareHeadless(void) {
+
+    cpu_pause();
+
+    emulator_ctors();
+
+    prefs_load(); // user prefs
+    prefs_sync(NULL);
+
+    cpu_resume();
+}
+
+void emulator_startHeadless(void) {
+    emulator_prepareHeadless();
+    timing_headlessBegin();
+}
+
 void emulator_shutdown(void) {
     emulatorShuttingDown = true;
     video_shutdown();
     prefs_shutdown();
     timing_stopCPU();
     _shutdown_threads();
+    _rewind_clear();
 }
 
 bool emulator_isShuttingDown(void) {
@@ -484,6 +1389,10 @@ int main(int _argc, char **_argv) {
 #   elif TEST_VM
     extern int test_vm(int, char *[]);
     test_vm(argc, argv);
+#   elif TEST_VMPOOL
+    // pooled machines are headless-only, there is no interactive emulator to start afterwards
+    extern int test_vmpool(int, char *[]);
+    exit(test_vmpool(argc, argv));
 #   else
 #       error "OOPS, no testsuite specified"
 #   endif
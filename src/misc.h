@@ -50,6 +50,12 @@ void emulator_registerStartupCallback(long order, startup_callback_f callback);
 // start emulator (CPU, audio, and video)
 void emulator_start(void);
 
+// load emulator ctors and prefs without beginning any CPU thread (see vmpool_create())
+void emulator_prepareHeadless(void);
+
+// start emulator in headless batch-run mode on the calling thread (see timing_headlessBegin())
+void emulator_startHeadless(void);
+
 // shutdown emulator in preparation for app exit
 void emulator_shutdown(void);
 
@@ -67,17 +73,40 @@ typedef struct StateHelper_s {
     int diskFdB;
     bool (*save)(int fd, const uint8_t * outbuf, ssize_t outmax);
     bool (*load)(int fd, uint8_t * inbuf, ssize_t inmax);
+    bool isRewind; // in-memory rewind snapshot : no disk image I/O, inserted images are kept on load
 } StateHelper_s;
 
-// save current emulator state
+// save current emulator state (full snapshot)
 bool emulator_saveState(int fdState);
 
+// save current emulator state as a delta frame appended to the state file last written through fdState's file,
+// containing only the chunks changed since then.  Falls back to a full snapshot (truncating the file) when the file
+// is new/unknown or when accumulated deltas outgrow the full snapshot.  fdState should be opened O_RDWR without O_TRUNC
+bool emulator_saveStateDelta(int fdState);
+
 // load emulator state from save file descriptor
 bool emulator_loadState(int fdState, int fdA, int fdB);
 
 // extract path(s) and readonly status(es) from save state file into json
 bool emulator_stateExtractDiskPaths(int fdState, JSON_ref json);
 
+//
+// Rewind ring : in-memory snapshots captured every few frames within a memory budget
+//
+
+// configure snapshot interval (in video frames) and memory budget (in bytes, 0 disables), discarding the ring
+void emulator_rewindConfigure(unsigned long intervalFrames, size_t budget);
+
+// restore the newest snapshot taken at least the specified seconds (of emulated time) ago, or the oldest one, dropping
+// the snapshots after it.  Disk image contents are not rewound
+bool emulator_rewind(unsigned int seconds);
+
+// seconds of emulated time currently available to rewind
+unsigned int emulator_rewindAvailable(void);
+
+// capture a snapshot when due (called by the CPU thread between emulation passes)
+void emulator_rewindCheckpoint(void) CALL_ON_CPU_THREAD;
+
 //
 // Crash handling ...
 //
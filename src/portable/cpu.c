@@ -0,0 +1,1776 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 1994 Alexander Jean-Claude Bottema
+ * Copyright 1995 Stephen Lee
+ * Copyright 1997, 1998 Aaron Culliney
+ * Copyright 1998, 1999, 2000 Michael Deutschmann
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+/*
+ * Portable C implementation of the 65c02 core.
+ *
+ * This mirrors x86/cpu.S instruction-for-instruction : same cpu65_run_args_s contract, same memory access ordering
+ * through cpu65_vmem_r/cpu65_vmem_w, same effective address / read-write / data / cycle bookkeeping and same trace hooks.
+ * The 65c02 registers live in locals for the duration of cpu65_run() and are written back on exit, just as the
+ * assembly cores keep them in host registers.
+ *
+ * Dispatch uses computed goto where the compiler supports it, otherwise (or with -DCPU_PORTABLE_SWITCH=1) a switch.
+ */
+
+#include "common.h"
+
+#if CPU_PORTABLE_SWITCH || !defined(__GNUC__)
+#   define OPCODE(op)       case op:
+#   define DISPATCH(op)     switch (op)
+#else
+#   define OPCODE(op)       op_##op:
+#   define DISPATCH(op)     goto *dispatch_table[op];
+#   define USE_COMPUTED_GOTO 1
+#endif
+
+typedef uint8_t (*vmem_read_f)(uint16_t ea);
+typedef void (*vmem_write_f)(uint16_t ea, uint8_t b);
+
+#define VMEM_READ(addr)         (((vmem_read_f *)args->cpu65_vmem_r)[(addr)>>8]((addr)))
+#define VMEM_WRITE(addr,b)      (((vmem_write_f *)args->cpu65_vmem_w)[(addr)>>8]((addr), (b)))
+
+#define FLAGS_ENCODE(fl)        (((uint8_t *)args->cpu65_flags_encode)[(fl)])
+#define FLAGS_DECODE(p)         (((uint8_t *)args->cpu65_flags_decode)[(p)])
+
+#if CPU_TRACING
+#   define TRACE_PROLOGUE() \
+                args->cpu65_pc = pc; \
+                args->cpu65_trace_prologue(ea, opcode);
+#   define TRACE_ARG(b) \
+                args->cpu65_trace_arg(ea, (b));
+#   define TRACE_EPILOGUE() \
+                CommonSaveCPUState(); \
+                args->cpu65_trace_epilogue(ea, opcode);
+#   define TRACE_IRQ() \
+                args->cpu65_trace_irq(ea, opcode);
+#else
+#   define TRACE_PROLOGUE()
+#   define TRACE_ARG(b)
+#   define TRACE_EPILOGUE()
+#   define TRACE_IRQ()
+#endif
+
+#define CommonSaveCPUState() \
+                args->cpu65_ea = ea; \
+                args->cpu65_a = a; \
+                args->cpu65_f = FLAGS_ENCODE(f); \
+                args->cpu65_x = x; \
+                args->cpu65_y = y;
+
+/* -------------------------------------------------------------------------
+    CPU (6502) Helper Routines
+   ------------------------------------------------------------------------- */
+
+// Instruction stream fetch, directly from host memory when the page is plain RAM/ROM (see cpu65_vmem_rbase)
+static inline uint8_t _fetch(cpu65_run_args_s *args, uint16_t addr) {
+#if !CPU_TRACING
+    uint8_t off = args->cpu65_vmem_rbase[addr>>8];
+    if (LIKELY(off)) {
+        uint8_t *base = *(uint8_t **)((uint8_t *)args + off);
+        return base[addr];
+    }
+#endif
+    return VMEM_READ(addr);
+}
+
+// Data access, directly from host memory when the page is plain RAM/ROM (see cpu65_vmem_rbase/cpu65_vmem_wbase)
+static inline uint8_t _read(cpu65_run_args_s *args, uint16_t addr) {
+    uint8_t off = args->cpu65_vmem_rbase[addr>>8];
+    if (LIKELY(off)) {
+        uint8_t *base = *(uint8_t **)((uint8_t *)args + off);
+        return base[addr];
+    }
+    return VMEM_READ(addr);
+}
+
+static inline void _write(cpu65_run_args_s *args, uint16_t addr, uint8_t b) {
+    uint8_t off = args->cpu65_vmem_wbase[addr>>8];
+    if (LIKELY(off)) {
+        uint8_t *base = *(uint8_t **)((uint8_t *)args + off);
+        if (base) {
+            base[addr] = b;
+        }
+        return;
+    }
+    VMEM_WRITE(addr, b);
+}
+
+// Debugger halt map check (see HALTMAP_EXEC et al), made only while the debugger runs free
+static inline bool _halt_bit(const uint8_t *map, unsigned int n) {
+    return (map[n>>3] >> (n & 0x7)) & 0x1;
+}
+
+static bool _halt_hit(const uint8_t *haltmap, uint8_t opcode, uint8_t rw, uint16_t ea, uint16_t pc) {
+    if (_halt_bit(haltmap + HALTMAP_OPCODE, opcode)) {
+        return true;
+    }
+    if ((rw & MEM_READ_FLAG) && _halt_bit(haltmap + HALTMAP_READ, ea)) {
+        return true;
+    }
+    if ((rw & MEM_WRITE_FLAG) && _halt_bit(haltmap + HALTMAP_WRITE, ea)) {
+        return true;
+    }
+    return _halt_bit(haltmap + HALTMAP_EXEC, pc);
+}
+
+#define GetFromPC_B(v) \
+                ea = pc++; \
+                v = _fetch(args, ea); \
+                TRACE_ARG(v);
+
+#define GetFromPC_W(v) \
+                ea = pc; \
+                pc += 2; \
+                lo = _fetch(args, ea); \
+                TRACE_ARG(lo); \
+                ++ea; \
+                hi = _fetch(args, ea); \
+                TRACE_ARG(hi); \
+                v = lo | (hi<<8);
+
+#define CPUStatsReset() \
+                args->cpu65_opcycles = 0; \
+                args->cpu65_rw = 0;
+
+#define GetFromEA_B(v) \
+                args->cpu65_rw |= MEM_READ_FLAG; \
+                v = _read(args, ea);
+
+#define GetFromEA_W(v) \
+                ++ea; \
+                hi = _read(args, ea); \
+                --ea; \
+                lo = _read(args, ea); \
+                v = lo | (hi<<8);
+
+#define PutToEA_B(v) \
+                args->cpu65_rw |= MEM_WRITE_FLAG; \
+                args->cpu65_d = (v); \
+                _write(args, ea, (v));
+
+#define GetFromMem_B(addr,v) \
+                ea = (addr); \
+                v = _read(args, ea);
+
+#define GetFromMem_W(addr,v) \
+                ea = (addr); \
+                GetFromEA_W(v)
+
+#define Continue \
+                goto op_continue;
+
+#define BranchXCycles(off) \
+                ++args->cpu65_opcycles; /* +1 branch taken */ \
+                addrs = pc + (int8_t)(off); \
+                if ((addrs ^ pc) & 0xFF00) { \
+                    ++args->cpu65_opcycles; /* +1 branch new page */ \
+                } \
+                pc = addrs;
+
+#define FlagNZ(r) \
+                f = (f & ~(N_Flag|Z_Flag)) | (((r) & 0x80) ? N_Flag : 0) | ((r) ? 0 : Z_Flag);
+
+#define FlagNZC(r,c) \
+                f = (f & ~(N_Flag|Z_Flag|C_Flag)) | (((r) & 0x80) ? N_Flag : 0) | ((r) ? 0 : Z_Flag) | ((c) ? C_Flag : 0);
+
+#define Push(v) \
+                args->base_stackzp[0x0100 + args->cpu65_sp] = (v); \
+                --args->cpu65_sp;
+
+#define Pop(v) \
+                ++args->cpu65_sp; \
+                v = args->base_stackzp[0x0100 + args->cpu65_sp];
+
+/* Immediate Addressing - the operand is contained in the second byte of the
+   instruction. */
+#if CPU_TRACING
+#define GetImm \
+                ea = pc++; \
+                val = VMEM_READ(ea); \
+                TRACE_ARG(val);
+#else
+#define GetImm \
+                ea = pc++;
+#endif
+
+/* Absolute Addressing - the second byte of the instruction is the low
+   order address, and the third byte is the high order byte. */
+#define GetAbs \
+                GetFromPC_W(addrs); \
+                ea = addrs;
+
+/* Zero Page Addressing - the second byte of the instruction is an
+   address on the zero page */
+#define GetZPage \
+                GetFromPC_B(val); \
+                ea = val;
+
+/* Zero Page Indexed Addressing - The effective address is calculated by
+   adding the second byte to the contents of the index register.  Due
+   to the zero page addressing nature of this mode, no carry is added
+   to the high address byte, and the crossing of page boundaries does
+   not occur. */
+#define GetZPage_X \
+                GetFromPC_B(val); \
+                ea = (uint8_t)(val + x);
+
+#define GetZPage_Y \
+                GetFromPC_B(val); \
+                ea = (uint8_t)(val + y);
+
+/* Absolute Indexed Addressing - The effective address is formed by
+   adding the contents of X or Y to the address contained in the
+   second and third bytes of the instruction. */
+#define _GetAbs_Idx(idx,xcycle) \
+                GetFromPC_W(addrs); \
+                if ((addrs & 0xFF) + (idx) > 0xFF) { \
+                    args->cpu65_opcycles += (xcycle); /* +1 cycle on page boundary */ \
+                } \
+                ea = addrs + (idx);
+
+#define GetAbs_X        _GetAbs_Idx(x, 1)
+#define GetAbs_X_STx    _GetAbs_Idx(x, 0)
+#define GetAbs_Y        _GetAbs_Idx(y, 1)
+#define GetAbs_Y_STA    _GetAbs_Idx(y, 0)
+
+/* Zero Page Indirect Addressing (65c02) - The second byte of the
+   instruction points to a memory location on page zero containing the
+   low order byte of the effective address.  The next location on page
+   zero contains the high order byte of the address. */
+#define _GetIndZPage(zp) \
+                ea = (uint8_t)((zp) + 1); \
+                GetFromEA_B(hi); \
+                ea = (uint8_t)(zp); \
+                GetFromEA_B(lo);
+
+#define GetIndZPage \
+                GetFromPC_B(val); \
+                _GetIndZPage(val); \
+                ea = lo | (hi<<8);
+
+/* Zero Page Indexed Indirect Addressing - The second byte is added to
+   the contents of the X index register; the carry is discarded.  The
+   result of this addition points to a memory location on page zero
+   whose contents is the low order byte of the effective address.  The
+   next memory location in page zero contains the high-order byte of
+   the effective address.  Both memory locations specifying the high
+   and low-order bytes must be in page zero. */
+#define GetIndZPage_X \
+                GetFromPC_B(val); \
+                _GetIndZPage(val + x); \
+                ea = lo | (hi<<8);
+
+/* Indirect Indexed Addressing - The second byte of the instruction
+   points to a memory location in page zero.  The contents of this
+   memory location are added to the contents of the Y index register,
+   the result being the low order byte of the effective address.  The
+   carry from this addition is added to the contents of the next page
+   zero memory location, the result being the high order byte of the
+   effective address. */
+#define _GetIndZPage_Y(xcycle) \
+                GetFromPC_B(val); \
+                _GetIndZPage(val); \
+                if (lo + y > 0xFF) { \
+                    args->cpu65_opcycles += (xcycle); /* +1 cycle on page boundary */ \
+                } \
+                ea = (lo | (hi<<8)) + y;
+
+#define GetIndZPage_Y       _GetIndZPage_Y(1)
+#define GetIndZPage_Y_STA   _GetIndZPage_Y(0)
+
+#define DoADC_b \
+                GetFromEA_B(val); \
+                res = a + val + ((f & C_Flag) ? 1 : 0); \
+                f &= ~(N_Flag|V_Flag|Z_Flag|C_Flag); \
+                if (~(a ^ val) & (a ^ res) & 0x80) { \
+                    f |= V_Flag; \
+                } \
+                a = (uint8_t)res; \
+                f |= (a & 0x80) ? N_Flag : 0; \
+                f |= a ? 0 : Z_Flag; \
+                f |= (res & 0x100) ? C_Flag : 0;
+
+#ifndef NDEBUG
+#define _DebugBCDCheck(v) \
+                if ((((v) & 0x80) && ((v) & 0x60)) || (((v) & 0x08) && ((v) & 0x06))) { \
+                    /* hook is a GLUE_C_WRITE function */ \
+                    ((vmem_write_f)args->debug_illegal_bcd)(ea, (v)); \
+                }
+#define DebugBCDCheck \
+                _DebugBCDCheck(a) \
+                _DebugBCDCheck(val)
+#else
+#define DebugBCDCheck
+#endif
+
+#define DoAND \
+                GetFromEA_B(val); \
+                a &= val; \
+                FlagNZ(a)
+
+#define _DoASL(r) \
+                res = (r) << 1; \
+                r = (uint8_t)res; \
+                FlagNZC(r, res & 0x100)
+
+#define DoASL \
+                GetFromEA_B(val); \
+                _DoASL(val) \
+                PutToEA_B(val)
+
+#define _DoBIT \
+                GetFromEA_B(val);
+
+#define DoBIT \
+                _DoBIT \
+                f &= ~(N_Flag|V_Flag|Z_Flag); \
+                f |= (val & 0x80) ? N_Flag : 0; \
+                f |= (val & 0x40) ? V_Flag : 0; \
+                f |= (a & val) ? 0 : Z_Flag;
+
+#define _DoCMP(r) \
+                GetFromEA_B(val); \
+                res = (uint8_t)((r) - val); \
+                FlagNZC(res, (r) >= val)
+
+#define DoCMP _DoCMP(a)
+#define DoCPX _DoCMP(x)
+#define DoCPY _DoCMP(y)
+
+#define _DoDEC(r) \
+                --r; \
+                FlagNZ(r)
+
+#define DoDEC \
+                GetFromEA_B(val); \
+                _DoDEC(val) \
+                PutToEA_B(val)
+
+#define DoEOR \
+                GetFromEA_B(val); \
+                a ^= val; \
+                FlagNZ(a)
+
+#define _DoINC(r) \
+                ++r; \
+                FlagNZ(r)
+
+#define DoINC \
+                GetFromEA_B(val); \
+                _DoINC(val) \
+                PutToEA_B(val)
+
+#define DoLDA \
+                GetFromEA_B(a); \
+                FlagNZ(a)
+
+#define DoLDX \
+                GetFromEA_B(x); \
+                FlagNZ(x)
+
+#define DoLDY \
+                GetFromEA_B(y); \
+                FlagNZ(y)
+
+#define _DoLSR(r) \
+                res = (r) & 0x1; \
+                r >>= 1; \
+                FlagNZC(r, res)
+
+#define DoLSR \
+                GetFromEA_B(val); \
+                _DoLSR(val) \
+                PutToEA_B(val)
+
+#define DoORA \
+                GetFromEA_B(val); \
+                a |= val; \
+                FlagNZ(a)
+
+#define _DoROL(r) \
+                res = ((r) << 1) | ((f & C_Flag) ? 1 : 0); \
+                r = (uint8_t)res; \
+                FlagNZC(r, res & 0x100)
+
+#define DoROL \
+                GetFromEA_B(val); \
+                _DoROL(val) \
+                PutToEA_B(val)
+
+#define _DoROR(r) \
+                res = (r) & 0x1; \
+                r = ((r) >> 1) | ((f & C_Flag) ? 0x80 : 0); \
+                FlagNZC(r, res)
+
+#define DoROR \
+                GetFromEA_B(val); \
+                _DoROR(val) \
+                PutToEA_B(val)
+
+#define DoSBC_b \
+                GetFromEA_B(val); \
+                val = ~val; \
+                res = a + val + ((f & C_Flag) ? 1 : 0); \
+                f &= ~(N_Flag|V_Flag|Z_Flag|C_Flag); \
+                if (~(a ^ val) & (a ^ res) & 0x80) { \
+                    f |= V_Flag; \
+                } \
+                a = (uint8_t)res; \
+                f |= (a & 0x80) ? N_Flag : 0; \
+                f |= a ? 0 : Z_Flag; \
+                f |= (res & 0x100) ? C_Flag : 0;
+
+#define DoSTA \
+                PutToEA_B(a)
+
+#define DoSTX \
+                PutToEA_B(x)
+
+#define DoSTY \
+                PutToEA_B(y)
+
+#define DoSTZ \
+                PutToEA_B(0x0)
+
+#define DoTRB \
+                GetFromEA_B(val); \
+                f = (f & ~Z_Flag) | ((a & val) ? 0 : Z_Flag); \
+                val &= ~a; \
+                PutToEA_B(val)
+
+#define DoTSB \
+                GetFromEA_B(val); \
+                f = (f & ~Z_Flag) | ((a & val) ? 0 : Z_Flag); \
+                val |= a; \
+                PutToEA_B(val)
+
+#define maybe_DoADC_d \
+                if (f & D_Flag) { /* Decimal mode? */ \
+                    goto op_ADC_dec; /* Yes, jump to decimal version */ \
+                }
+
+#define maybe_DoSBC_d \
+                if (f & D_Flag) { /* Decimal mode? */ \
+                    goto op_SBC_dec; /* Yes, jump to decimal version */ \
+                }
+
+#define _DoBranch(cond) \
+                GetFromPC_B(val); \
+                if (cond) { \
+                    BranchXCycles(val) \
+                }
+
+#define _DoPull(r) \
+                Pop(r); \
+                FlagNZ(r)
+
+#define _DoTransfer(dst,src) \
+                dst = (src); \
+                FlagNZ(dst)
+
+/* -------------------------------------------------------------------------
+        65c02 CPU processing loop entry point
+   ------------------------------------------------------------------------- */
+
+void cpu65_run(void *arg) {
+    cpu65_run_args_s *args = (cpu65_run_args_s *)arg;
+
+#if USE_COMPUTED_GOTO
+#   define _ROW(h) \
+        &&op_0x##h##0, &&op_0x##h##1, &&op_0x##h##2, &&op_0x##h##3, &&op_0x##h##4, &&op_0x##h##5, &&op_0x##h##6, \
+        &&op_0x##h##7, &&op_0x##h##8, &&op_0x##h##9, &&op_0x##h##A, &&op_0x##h##B, &&op_0x##h##C, &&op_0x##h##D, \
+        &&op_0x##h##E, &&op_0x##h##F
+    static const void *const dispatch_table[256] = {
+        _ROW(0), _ROW(1), _ROW(2), _ROW(3), _ROW(4), _ROW(5), _ROW(6), _ROW(7),
+        _ROW(8), _ROW(9), _ROW(A), _ROW(B), _ROW(C), _ROW(D), _ROW(E), _ROW(F),
+    };
+#   undef _ROW
+#endif
+
+    uint16_t pc;
+    uint16_t ea;
+    uint16_t addrs;
+    uint8_t a;
+    uint8_t x;
+    uint8_t y;
+    uint8_t f;
+    uint8_t val;
+    uint8_t lo;
+    uint8_t hi;
+    uint8_t opcode = 0x0;
+    unsigned int res;
+
+    // Restore CPU state when being called from C.
+    ea = args->cpu65_ea;
+    pc = args->cpu65_pc;
+    a = args->cpu65_a;
+    x = args->cpu65_x;
+    y = args->cpu65_y;
+    f = FLAGS_DECODE(args->cpu65_f);
+
+    if (args->emul_reinitialize) {
+        args->emul_reinitialize = 0;
+        goto ex_reset;
+    }
+    goto continue2;
+
+/* -------------------------------------------------------------------------
+        CPU continue
+        Keep executing until we've executed >= cpu65_cycles_to_execute
+   ------------------------------------------------------------------------- */
+
+op_continue:
+    {
+        uint8_t cycles = args->cpu65__opcycles[opcode] + args->cpu65_opcycles;
+        args->cpu65_opcycles = cycles;
+        TRACE_EPILOGUE();
+
+        args->cpu65_cycle_count += cycles;
+        args->gc_cycles_timer_0 -= cycles;
+        args->gc_cycles_timer_1 -= cycles;
+        args->cpu65_cycles_to_execute -= cycles;
+        if (UNLIKELY(args->cpu65_profile != NULL)) {
+            args->cpu65_pc = pc;
+            args->cpu65_profile(ea, cycles);
+        }
+        if (UNLIKELY(args->cpu65_haltmap != NULL) && _halt_hit(args->cpu65_haltmap, opcode, args->cpu65_rw, ea, pc)) {
+            args->cpu65_halted = 1;
+            goto exit_cpu65_run;
+        }
+        if (args->cpu65_cycles_to_execute <= 0) {
+            goto exit_cpu65_run;
+        }
+    }
+
+continue2:
+    if (UNLIKELY(args->cpu65__signal)) {
+        goto exception;
+    }
+    CPUStatsReset();
+
+next_instruction:
+    TRACE_PROLOGUE();
+    GetFromPC_B(opcode);
+    args->cpu65_opcode = opcode;
+
+    DISPATCH(opcode)
+    {
+
+/* ----------------------------------
+       ADC instructions
+       ADd memory to accumulator with Carry
+   ---------------------------------- */
+
+    // Decimal mode
+    op_ADC_dec:
+        ++args->cpu65_opcycles; // +1 cycle
+        GetFromEA_B(val);
+        DebugBCDCheck
+        {
+            unsigned int carry = (f & C_Flag) ? 1 : 0;
+            bool cf = (val + a + carry) > 0xFF;
+            bool af = ((val & 0x0f) + (a & 0x0f) + carry) > 0x0f;
+            bool adjust_hi = false;
+            val = val + a + carry;
+
+            // DAA (as per the x86_64 path of cpu.S)
+            f &= ~(N_Flag|V_Flag|Z_Flag|C_Flag);
+            if ((val & 0x0f) > 9 || af) {
+                adjust_hi = (val + 6) > 0xFF;
+                val += 6; // adjust lo nybble
+            }
+            if (adjust_hi || cf || val > 0x99) {
+                val += 0x60; // adjust hi nybble
+                f |= C_Flag;
+            }
+            f |= (val & 0x80) ? N_Flag : 0;
+            f |= val ? 0 : Z_Flag;
+            a = val;
+        }
+        Continue
+
+    OPCODE(0x69)
+        GetImm
+        maybe_DoADC_d
+        DoADC_b
+        Continue
+
+    OPCODE(0x65)
+        GetZPage
+        maybe_DoADC_d
+        DoADC_b
+        Continue
+
+    OPCODE(0x75)
+        GetZPage_X
+        maybe_DoADC_d
+        DoADC_b
+        Continue
+
+    OPCODE(0x6D)
+        GetAbs
+        maybe_DoADC_d
+        DoADC_b
+        Continue
+
+    OPCODE(0x7D)
+        GetAbs_X
+        maybe_DoADC_d
+        DoADC_b
+        Continue
+
+    OPCODE(0x79)
+        GetAbs_Y
+        maybe_DoADC_d
+        DoADC_b
+        Continue
+
+    OPCODE(0x61)
+        GetIndZPage_X
+        maybe_DoADC_d
+        DoADC_b
+        Continue
+
+    OPCODE(0x71)
+        GetIndZPage_Y
+        maybe_DoADC_d
+        DoADC_b
+        Continue
+
+    // 65c02
+    OPCODE(0x72)
+        GetIndZPage
+        maybe_DoADC_d
+        DoADC_b
+        Continue
+
+/* ----------------------------------
+       AND instructions
+       logical AND memory with accumulator
+   ---------------------------------- */
+
+    OPCODE(0x29)
+        GetImm
+        DoAND
+        Continue
+
+    OPCODE(0x25)
+        GetZPage
+        DoAND
+        Continue
+
+    OPCODE(0x35)
+        GetZPage_X
+        DoAND
+        Continue
+
+    OPCODE(0x2D)
+        GetAbs
+        DoAND
+        Continue
+
+    OPCODE(0x3D)
+        GetAbs_X
+        DoAND
+        Continue
+
+    OPCODE(0x39)
+        GetAbs_Y
+        DoAND
+        Continue
+
+    OPCODE(0x21)
+        GetIndZPage_X
+        DoAND
+        Continue
+
+    OPCODE(0x31)
+        GetIndZPage_Y
+        DoAND
+        Continue
+
+    // 65c02
+    OPCODE(0x32)
+        GetIndZPage
+        DoAND
+        Continue
+
+/* ----------------------------------
+       ASL instructions
+       Arithmetic Shift one bit Left, memory or accumulator
+   ---------------------------------- */
+
+    OPCODE(0x0A)
+        _DoASL(a)
+        Continue
+
+    OPCODE(0x06)
+        GetZPage
+        DoASL
+        Continue
+
+    OPCODE(0x16)
+        GetZPage_X
+        DoASL
+        Continue
+
+    OPCODE(0x0E)
+        GetAbs
+        DoASL
+        Continue
+
+    OPCODE(0x1E)
+        GetAbs_X
+        DoASL
+        Continue
+
+/* ----------------------------------
+       Branch instructions
+   ---------------------------------- */
+
+    OPCODE(0x90) // BCC
+        _DoBranch(!(f & C_Flag))
+        Continue
+
+    OPCODE(0xB0) // BCS
+        _DoBranch(f & C_Flag)
+        Continue
+
+    OPCODE(0xF0) // BEQ
+        _DoBranch(f & Z_Flag)
+        Continue
+
+    OPCODE(0x30) // BMI
+        _DoBranch(f & N_Flag)
+        Continue
+
+    OPCODE(0xD0) // BNE
+        _DoBranch(!(f & Z_Flag))
+        Continue
+
+    OPCODE(0x10) // BPL
+        _DoBranch(!(f & N_Flag))
+        Continue
+
+    OPCODE(0x50) // BVC
+        _DoBranch(!(f & V_Flag))
+        Continue
+
+    OPCODE(0x70) // BVS
+        _DoBranch(f & V_Flag)
+        Continue
+
+    // 65c02
+    OPCODE(0x80) // BRA
+        _DoBranch(true)
+        Continue
+
+/* ----------------------------------
+       BIT instructions
+       BIt Test
+   ---------------------------------- */
+
+    OPCODE(0x24)
+        GetZPage
+        DoBIT
+        Continue
+
+    OPCODE(0x2C)
+        GetAbs
+        DoBIT
+        Continue
+
+    // 65c02
+    OPCODE(0x34)
+        GetZPage_X
+        DoBIT
+        Continue
+
+    // 65c02
+    OPCODE(0x3C)
+        GetAbs_X
+        DoBIT
+        Continue
+
+    /* BIT immediate is anomalous in that it does not affect the
+     * N and V flags, unlike in other addressing modes.
+     */
+    // 65c02
+    OPCODE(0x89)
+        GetImm
+        _DoBIT
+        f = (f & ~Z_Flag) | ((a & val) ? 0 : Z_Flag);
+        Continue
+
+/* ----------------------------------
+       BRK instruction
+   ---------------------------------- */
+
+    OPCODE(0x00)
+        ++pc;
+        Push(pc>>8);
+        Push(pc & 0xFF);
+        f |= (B_Flag|X_Flag);
+        Push(FLAGS_ENCODE(f));
+        f |= I_Flag;
+        ea = 0xFFFE; // ROM interrupt vector
+        GetFromEA_W(pc);
+        Continue
+
+/* ----------------------------------
+       Flag instructions
+   ---------------------------------- */
+
+    OPCODE(0x18) // CLC
+        f &= ~C_Flag;
+        Continue
+
+    OPCODE(0xD8) // CLD
+        f &= ~D_Flag;
+        Continue
+
+    OPCODE(0x58) // CLI
+        f &= ~I_Flag;
+        Continue
+
+    OPCODE(0xB8) // CLV
+        f &= ~V_Flag;
+        Continue
+
+    OPCODE(0x38) // SEC
+        f |= C_Flag;
+        Continue
+
+    OPCODE(0xF8) // SED
+        f |= D_Flag;
+        Continue
+
+    OPCODE(0x78) // SEI
+        f |= I_Flag;
+        Continue
+
+/* ----------------------------------
+       CMP instructions
+       CoMPare memory and accumulator
+   ---------------------------------- */
+
+    OPCODE(0xC9)
+        GetImm
+        DoCMP
+        Continue
+
+    OPCODE(0xC5)
+        GetZPage
+        DoCMP
+        Continue
+
+    OPCODE(0xD5)
+        GetZPage_X
+        DoCMP
+        Continue
+
+    OPCODE(0xCD)
+        GetAbs
+        DoCMP
+        Continue
+
+    OPCODE(0xDD)
+        GetAbs_X
+        DoCMP
+        Continue
+
+    OPCODE(0xD9)
+        GetAbs_Y
+        DoCMP
+        Continue
+
+    OPCODE(0xC1)
+        GetIndZPage_X
+        DoCMP
+        Continue
+
+    OPCODE(0xD1)
+        GetIndZPage_Y
+        DoCMP
+        Continue
+
+    // 65c02
+    OPCODE(0xD2)
+        GetIndZPage
+        DoCMP
+        Continue
+
+/* ----------------------------------
+       CPX instructions
+       ComPare memory and X register
+   ---------------------------------- */
+
+    OPCODE(0xE0)
+        GetImm
+        DoCPX
+        Continue
+
+    OPCODE(0xE4)
+        GetZPage
+        DoCPX
+        Continue
+
+    OPCODE(0xEC)
+        GetAbs
+        DoCPX
+        Continue
+
+/* ----------------------------------
+       CPY instructions
+       ComPare memory and Y register
+   ---------------------------------- */
+
+    OPCODE(0xC0)
+        GetImm
+        DoCPY
+        Continue
+
+    OPCODE(0xC4)
+        GetZPage
+        DoCPY
+        Continue
+
+    OPCODE(0xCC)
+        GetAbs
+        DoCPY
+        Continue
+
+/* ----------------------------------
+       DEC instructions
+       DECrement memory or accumulator by one
+   ---------------------------------- */
+
+    // 65c02
+    OPCODE(0x3A) // DEA
+        _DoDEC(a)
+        Continue
+
+    OPCODE(0xC6)
+        GetZPage
+        DoDEC
+        Continue
+
+    OPCODE(0xD6)
+        GetZPage_X
+        DoDEC
+        Continue
+
+    OPCODE(0xCE)
+        GetAbs
+        DoDEC
+        Continue
+
+    OPCODE(0xDE)
+        GetAbs_X_STx
+        DoDEC
+        Continue
+
+    OPCODE(0xCA) // DEX
+        _DoDEC(x)
+        Continue
+
+    OPCODE(0x88) // DEY
+        _DoDEC(y)
+        Continue
+
+/* ----------------------------------
+       EOR instructions
+       Exclusive OR memory with accumulator
+   ---------------------------------- */
+
+    OPCODE(0x49)
+        GetImm
+        DoEOR
+        Continue
+
+    OPCODE(0x45)
+        GetZPage
+        DoEOR
+        Continue
+
+    OPCODE(0x55)
+        GetZPage_X
+        DoEOR
+        Continue
+
+    OPCODE(0x4D)
+        GetAbs
+        DoEOR
+        Continue
+
+    OPCODE(0x5D)
+        GetAbs_X
+        DoEOR
+        Continue
+
+    OPCODE(0x59)
+        GetAbs_Y
+        DoEOR
+        Continue
+
+    OPCODE(0x41)
+        GetIndZPage_X
+        DoEOR
+        Continue
+
+    OPCODE(0x51)
+        GetIndZPage_Y
+        DoEOR
+        Continue
+
+    // 65c02
+    OPCODE(0x52)
+        GetIndZPage
+        DoEOR
+        Continue
+
+/* ----------------------------------
+       INC instructions
+       INCrement memory or accumulator by one
+   ---------------------------------- */
+
+    // 65c02
+    OPCODE(0x1A) // INA
+        _DoINC(a)
+        Continue
+
+    OPCODE(0xE6)
+        GetZPage
+        DoINC
+        Continue
+
+    OPCODE(0xF6)
+        GetZPage_X
+        DoINC
+        Continue
+
+    OPCODE(0xEE)
+        GetAbs
+        DoINC
+        Continue
+
+    OPCODE(0xFE)
+        GetAbs_X_STx
+        DoINC
+        Continue
+
+    OPCODE(0xE8) // INX
+        _DoINC(x)
+        Continue
+
+    OPCODE(0xC8) // INY
+        _DoINC(y)
+        Continue
+
+/* ----------------------------------
+       JMP instructions
+       JuMP to new location
+   ---------------------------------- */
+
+    OPCODE(0x4C)
+        GetAbs
+        pc = ea;
+        Continue
+
+    OPCODE(0x6C)
+        GetFromPC_W(addrs);
+        if ((addrs & 0xFF) != 0xFF) {
+            GetFromMem_W(addrs, pc);
+        } else {
+            // see JMP indirect note in _Understanding the Apple IIe_ 4-25
+            GetFromMem_B(addrs - 0xFF, hi);
+            GetFromMem_B(addrs, lo);
+            pc = lo | (hi<<8);
+        }
+        Continue
+
+    // 65c02
+    OPCODE(0x7C)
+        GetFromPC_W(addrs);
+        GetFromMem_W(addrs + x, pc);
+        Continue
+
+/* ----------------------------------
+       JSR instruction
+   ---------------------------------- */
+
+    OPCODE(0x20)
+        GetAbs
+        addrs = pc - 1;
+        Push(addrs>>8);
+        Push(addrs & 0xFF);
+        pc = ea;
+        Continue
+
+/* ----------------------------------
+       LDA instructions
+       LoaD Accumulator with memory
+   ---------------------------------- */
+
+    OPCODE(0xA9)
+        GetImm
+        DoLDA
+        Continue
+
+    OPCODE(0xA5)
+        GetZPage
+        DoLDA
+        Continue
+
+    OPCODE(0xB5)
+        GetZPage_X
+        DoLDA
+        Continue
+
+    OPCODE(0xAD)
+        GetAbs
+        DoLDA
+        Continue
+
+    OPCODE(0xBD)
+        GetAbs_X
+        DoLDA
+        Continue
+
+    OPCODE(0xB9)
+        GetAbs_Y
+        DoLDA
+        Continue
+
+    OPCODE(0xA1)
+        GetIndZPage_X
+        DoLDA
+        Continue
+
+    OPCODE(0xB1)
+        GetIndZPage_Y
+        DoLDA
+        Continue
+
+    // 65c02
+    OPCODE(0xB2)
+        GetIndZPage
+        DoLDA
+        Continue
+
+/* ----------------------------------
+       LDX instructions
+   ---------------------------------- */
+
+    OPCODE(0xA2)
+        GetImm
+        DoLDX
+        Continue
+
+    OPCODE(0xA6)
+        GetZPage
+        DoLDX
+        Continue
+
+    OPCODE(0xB6)
+        GetZPage_Y
+        DoLDX
+        Continue
+
+    OPCODE(0xAE)
+        GetAbs
+        DoLDX
+        Continue
+
+    OPCODE(0xBE)
+        GetAbs_Y
+        DoLDX
+        Continue
+
+/* ----------------------------------
+       LDY instructions
+   ---------------------------------- */
+
+    OPCODE(0xA0)
+        GetImm
+        DoLDY
+        Continue
+
+    OPCODE(0xA4)
+        GetZPage
+        DoLDY
+        Continue
+
+    OPCODE(0xB4)
+        GetZPage_X
+        DoLDY
+        Continue
+
+    OPCODE(0xAC)
+        GetAbs
+        DoLDY
+        Continue
+
+    OPCODE(0xBC)
+        GetAbs_X
+        DoLDY
+        Continue
+
+/* ----------------------------------
+       LSR instructions
+   ---------------------------------- */
+
+    OPCODE(0x4A)
+        _DoLSR(a)
+        Continue
+
+    OPCODE(0x46)
+        GetZPage
+        DoLSR
+        Continue
+
+    OPCODE(0x56)
+        GetZPage_X
+        DoLSR
+        Continue
+
+    OPCODE(0x4E)
+        GetAbs
+        DoLSR
+        Continue
+
+    OPCODE(0x5E)
+        GetAbs_X
+        DoLSR
+        Continue
+
+/* ----------------------------------
+       ORA instructions
+   ---------------------------------- */
+
+    OPCODE(0x09)
+        GetImm
+        DoORA
+        Continue
+
+    OPCODE(0x05)
+        GetZPage
+        DoORA
+        Continue
+
+    OPCODE(0x15)
+        GetZPage_X
+        DoORA
+        Continue
+
+    OPCODE(0x0D)
+        GetAbs
+        DoORA
+        Continue
+
+    OPCODE(0x1D)
+        GetAbs_X
+        DoORA
+        Continue
+
+    OPCODE(0x19)
+        GetAbs_Y
+        DoORA
+        Continue
+
+    OPCODE(0x01)
+        GetIndZPage_X
+        DoORA
+        Continue
+
+    OPCODE(0x11)
+        GetIndZPage_Y
+        DoORA
+        Continue
+
+    // 65c02
+    OPCODE(0x12)
+        GetIndZPage
+        DoORA
+        Continue
+
+/* ----------------------------------
+       Stack instructions
+   ---------------------------------- */
+
+    OPCODE(0x48) // PHA
+        Push(a);
+        Continue
+
+    OPCODE(0x08) // PHP
+        Push(FLAGS_ENCODE(f));
+        Continue
+
+    // 65c02
+    OPCODE(0xDA) // PHX
+        Push(x);
+        Continue
+
+    // 65c02
+    OPCODE(0x5A) // PHY
+        Push(y);
+        Continue
+
+    OPCODE(0x68) // PLA
+        _DoPull(a)
+        Continue
+
+    OPCODE(0x28) // PLP
+        Pop(val);
+        f = FLAGS_DECODE(val) | (B_Flag|X_Flag);
+        Continue
+
+    // 65c02
+    OPCODE(0xFA) // PLX
+        _DoPull(x)
+        Continue
+
+    // 65c02
+    OPCODE(0x7A) // PLY
+        _DoPull(y)
+        Continue
+
+/* ----------------------------------
+       ROL instructions
+   ---------------------------------- */
+
+    OPCODE(0x2A)
+        _DoROL(a)
+        Continue
+
+    OPCODE(0x26)
+        GetZPage
+        DoROL
+        Continue
+
+    OPCODE(0x36)
+        GetZPage_X
+        DoROL
+        Continue
+
+    OPCODE(0x2E)
+        GetAbs
+        DoROL
+        Continue
+
+    OPCODE(0x3E)
+        GetAbs_X
+        DoROL
+        Continue
+
+/* ----------------------------------
+       ROR instructions
+   ---------------------------------- */
+
+    OPCODE(0x6A)
+        _DoROR(a)
+        Continue
+
+    OPCODE(0x66)
+        GetZPage
+        DoROR
+        Continue
+
+    OPCODE(0x76)
+        GetZPage_X
+        DoROR
+        Continue
+
+    OPCODE(0x6E)
+        GetAbs
+        DoROR
+        Continue
+
+    OPCODE(0x7E)
+        GetAbs_X
+        DoROR
+        Continue
+
+/* ----------------------------------
+       RTI instruction
+   ---------------------------------- */
+
+    OPCODE(0x40)
+        Pop(val);
+        f = FLAGS_DECODE(val) | (B_Flag|X_Flag);
+        Pop(lo);
+        Pop(hi);
+        pc = lo | (hi<<8);
+        Continue
+
+/* ----------------------------------
+       RTS instruction
+   ---------------------------------- */
+
+    OPCODE(0x60)
+        Pop(lo);
+        Pop(hi);
+        pc = (lo | (hi<<8)) + 1;
+        Continue
+
+/* ----------------------------------
+       SBC instructions
+       SuBtract memory from accumulator with Borrow
+   ---------------------------------- */
+
+    // Decimal mode
+    op_SBC_dec:
+        ++args->cpu65_opcycles; // +1 cycle
+        GetFromEA_B(val);
+        DebugBCDCheck
+        {
+            unsigned int borrow = (f & C_Flag) ? 0 : 1;
+            bool cf = (unsigned int)val + borrow > a;
+            bool af = (unsigned int)(val & 0x0f) + borrow > (a & 0x0f);
+            bool adjust_hi = false;
+            val = a - val - borrow;
+
+            // DAS (as per the x86_64 path of cpu.S)
+            f &= ~(N_Flag|V_Flag|Z_Flag);
+            f |= C_Flag;
+            if ((val & 0x0f) > 9 || af) {
+                adjust_hi = val < 6;
+                val -= 6; // adjust lo nybble
+            }
+            if (adjust_hi || cf || val > 0x99) {
+                val -= 0x60; // adjust hi nybble
+                f &= ~C_Flag;
+            }
+            f |= (val & 0x80) ? N_Flag : 0;
+            f |= val ? 0 : Z_Flag;
+            a = val;
+        }
+        Continue
+
+    OPCODE(0xE9)
+        GetImm
+        maybe_DoSBC_d
+        DoSBC_b
+        Continue
+
+    OPCODE(0xE5)
+        GetZPage
+        maybe_DoSBC_d
+        DoSBC_b
+        Continue
+
+    OPCODE(0xF5)
+        GetZPage_X
+        maybe_DoSBC_d
+        DoSBC_b
+        Continue
+
+    OPCODE(0xED)
+        GetAbs
+        maybe_DoSBC_d
+        DoSBC_b
+        Continue
+
+    OPCODE(0xFD)
+        GetAbs_X
+        maybe_DoSBC_d
+        DoSBC_b
+        Continue
+
+    OPCODE(0xF9)
+        GetAbs_Y
+        maybe_DoSBC_d
+        DoSBC_b
+        Continue
+
+    OPCODE(0xE1)
+        GetIndZPage_X
+        maybe_DoSBC_d
+        DoSBC_b
+        Continue
+
+    OPCODE(0xF1)
+        GetIndZPage_Y
+        maybe_DoSBC_d
+        DoSBC_b
+        Continue
+
+    // 65c02
+    OPCODE(0xF2)
+        GetIndZPage
+        maybe_DoSBC_d
+        DoSBC_b
+        Continue
+
+/* ----------------------------------
+       STA instructions
+   ---------------------------------- */
+
+    OPCODE(0x85)
+        GetZPage
+        DoSTA
+        Continue
+
+    OPCODE(0x95)
+        GetZPage_X
+        DoSTA
+        Continue
+
+    OPCODE(0x8D)
+        GetAbs
+        DoSTA
+        Continue
+
+    OPCODE(0x9D)
+        GetAbs_X_STx
+        DoSTA
+        Continue
+
+    OPCODE(0x99)
+        GetAbs_Y_STA
+        DoSTA
+        Continue
+
+    OPCODE(0x81)
+        GetIndZPage_X
+        DoSTA
+        Continue
+
+    OPCODE(0x91)
+        GetIndZPage_Y_STA
+        DoSTA
+        Continue
+
+    // 65c02
+    OPCODE(0x92)
+        GetIndZPage
+        DoSTA
+        Continue
+
+/* ----------------------------------
+       STX instructions
+   ---------------------------------- */
+
+    OPCODE(0x86)
+        GetZPage
+        DoSTX
+        Continue
+
+    OPCODE(0x96)
+        GetZPage_Y
+        DoSTX
+        Continue
+
+    OPCODE(0x8E)
+        GetAbs
+        DoSTX
+        Continue
+
+/* ----------------------------------
+       STY instructions
+   ---------------------------------- */
+
+    OPCODE(0x84)
+        GetZPage
+        DoSTY
+        Continue
+
+    OPCODE(0x94)
+        GetZPage_X
+        DoSTY
+        Continue
+
+    OPCODE(0x8C)
+        GetAbs
+        DoSTY
+        Continue
+
+/* ----------------------------------
+       STZ instructions
+       65c02 only
+   ---------------------------------- */
+
+    OPCODE(0x64)
+        GetZPage
+        DoSTZ
+        Continue
+
+    OPCODE(0x74)
+        GetZPage_X
+        DoSTZ
+        Continue
+
+    OPCODE(0x9C)
+        GetAbs
+        DoSTZ
+        Continue
+
+    OPCODE(0x9E)
+        GetAbs_X_STx
+        DoSTZ
+        Continue
+
+/* ----------------------------------
+       Transfer instructions
+   ---------------------------------- */
+
+    OPCODE(0xAA) // TAX
+        _DoTransfer(x, a)
+        Continue
+
+    OPCODE(0xA8) // TAY
+        _DoTransfer(y, a)
+        Continue
+
+    OPCODE(0xBA) // TSX
+        _DoTransfer(x, args->cpu65_sp)
+        Continue
+
+    OPCODE(0x8A) // TXA
+        _DoTransfer(a, x)
+        Continue
+
+    OPCODE(0x9A) // TXS
+        args->cpu65_sp = x;
+        Continue
+
+    OPCODE(0x98) // TYA
+        _DoTransfer(a, y)
+        Continue
+
+/* ----------------------------------
+       TRB instructions
+       65c02 only
+   ---------------------------------- */
+
+    OPCODE(0x1C)
+        GetAbs
+        DoTRB
+        Continue
+
+    OPCODE(0x14)
+        GetZPage
+        DoTRB
+        Continue
+
+/* ----------------------------------
+       TSB instructions
+       65c02 only
+   ---------------------------------- */
+
+    OPCODE(0x0C)
+        GetAbs
+        DoTSB
+        Continue
+
+    OPCODE(0x04)
+        GetZPage
+        DoTSB
+        Continue
+
+/* ----------------------------------
+       NOP, ??? (defined as NOPs by spec) and UNIMPLEMENTED : documented in the W65C02S datasheet ...
+         BBRx 0x0F-0x7F
+         BBSx 0x8F-0xFF
+         RMBx 0x07-0x77
+         SMBx 0x87-0xF7
+         STP  0xDB
+         WAI  0xCB
+   ---------------------------------- */
+
+    OPCODE(0xEA)
+    OPCODE(0x02) OPCODE(0x03) OPCODE(0x0B) OPCODE(0x13) OPCODE(0x1B) OPCODE(0x22) OPCODE(0x23) OPCODE(0x2B)
+    OPCODE(0x33) OPCODE(0x3B) OPCODE(0x42) OPCODE(0x43) OPCODE(0x44) OPCODE(0x4B) OPCODE(0x53) OPCODE(0x54)
+    OPCODE(0x5B) OPCODE(0x5C) OPCODE(0x62) OPCODE(0x63) OPCODE(0x6B) OPCODE(0x73) OPCODE(0x7B) OPCODE(0x82)
+    OPCODE(0x83) OPCODE(0x8B) OPCODE(0x93) OPCODE(0x9B) OPCODE(0xA3) OPCODE(0xAB) OPCODE(0xB3) OPCODE(0xBB)
+    OPCODE(0xC2) OPCODE(0xC3) OPCODE(0xD3) OPCODE(0xD4) OPCODE(0xDC) OPCODE(0xE2) OPCODE(0xE3) OPCODE(0xEB)
+    OPCODE(0xF3) OPCODE(0xF4) OPCODE(0xFB) OPCODE(0xFC)
+    OPCODE(0x0F) OPCODE(0x1F) OPCODE(0x2F) OPCODE(0x3F) OPCODE(0x4F) OPCODE(0x5F) OPCODE(0x6F) OPCODE(0x7F)
+    OPCODE(0x8F) OPCODE(0x9F) OPCODE(0xAF) OPCODE(0xBF) OPCODE(0xCF) OPCODE(0xDF) OPCODE(0xEF) OPCODE(0xFF)
+    OPCODE(0x07) OPCODE(0x17) OPCODE(0x27) OPCODE(0x37) OPCODE(0x47) OPCODE(0x57) OPCODE(0x67) OPCODE(0x77)
+    OPCODE(0x87) OPCODE(0x97) OPCODE(0xA7) OPCODE(0xB7) OPCODE(0xC7) OPCODE(0xD7) OPCODE(0xE7) OPCODE(0xF7)
+    OPCODE(0xDB) OPCODE(0xCB)
+        Continue
+
+    } // DISPATCH
+
+/* -------------------------------------------------------------------------
+        Exception handlers
+   ------------------------------------------------------------------------- */
+
+exception:
+    if (args->cpu65__signal & ResetSig) {
+        if (args->joy_button0 || args->joy_button1) { // OpenApple || ClosedApple
+            goto exit_reinit;
+        }
+        goto ex_reset;
+    }
+
+    // ex_irq
+    if (f & I_Flag) { // Already interrupted?
+        CPUStatsReset(); // Yes (ignored) ...
+        goto next_instruction;
+    }
+    TRACE_IRQ(); // No (handle IRQ) ...
+    Push(pc>>8);
+    Push(pc & 0xFF);
+    f |= X_Flag;
+    Push(FLAGS_ENCODE(f));
+    f |= (B_Flag|I_Flag);
+    //f &= ~D_Flag; // AppleWin clears Decimal bit?
+    ea = 0xFFFE;
+    GetFromEA_W(pc);
+    if (UNLIKELY(args->cpu65_profile != NULL)) {
+        args->cpu65_pc = pc;
+        args->cpu65_profile(ea, PROFILE_IRQ);
+    }
+    CPUStatsReset();
+    args->cpu65_opcycles += 7; // IRQ handling will take additional 7 cycles
+    goto next_instruction;
+
+ex_reset:
+    args->cpu65__signal = 0;
+    ea = 0xFFFC; // ROM reset vector
+    GetFromEA_W(pc);
+    if (UNLIKELY(args->cpu65_profile != NULL)) {
+        args->cpu65_pc = pc;
+        args->cpu65_profile(ea, PROFILE_RESET);
+    }
+    CPUStatsReset();
+    goto next_instruction;
+
+/* -------------------------------------------------------------------------
+        65c02 CPU processing loop exit point
+   ------------------------------------------------------------------------- */
+
+exit_cpu65_run:
+    // Save CPU state when returning from being called from C
+    args->cpu65_pc = pc;
+    CommonSaveCPUState();
+    return;
+
+exit_reinit:
+    args->cpu65__signal = 0;
+    args->emul_reinitialize = 1;
+}
+
+/* -------------------------------------------------------------------------
+        Debugger hooks
+   ------------------------------------------------------------------------- */
+
+void cpu65_direct_write(int ea, int data) {
+    ((vmem_write_f *)run_args.cpu65_vmem_w)[(uint16_t)ea>>8]((uint16_t)ea, (uint8_t)data);
+}
+
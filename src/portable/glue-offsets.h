@@ -0,0 +1,30 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+// The portable core is plain C, so offsets are taken directly from the cpu65_run_args_s layout rather than from the
+// generated per-ABI tables used by the assembly cores.
+
+#define BASE_RAMRD offsetof(cpu65_run_args_s, base_ramrd)
+#define BASE_RAMWRT offsetof(cpu65_run_args_s, base_ramwrt)
+#define BASE_TEXTRD offsetof(cpu65_run_args_s, base_textrd)
+#define BASE_TEXTWRT offsetof(cpu65_run_args_s, base_textwrt)
+#define BASE_HGRRD offsetof(cpu65_run_args_s, base_hgrrd)
+#define BASE_HGRWRT offsetof(cpu65_run_args_s, base_hgrwrt)
+#define BASE_STACKZP offsetof(cpu65_run_args_s, base_stackzp)
+#define BASE_D000_RD offsetof(cpu65_run_args_s, base_d000_rd)
+#define BASE_E000_RD offsetof(cpu65_run_args_s, base_e000_rd)
+#define BASE_D000_WRT offsetof(cpu65_run_args_s, base_d000_wrt)
+#define BASE_E000_WRT offsetof(cpu65_run_args_s, base_e000_wrt)
+#define BASE_C3ROM offsetof(cpu65_run_args_s, base_c3rom)
+#define BASE_C4ROM offsetof(cpu65_run_args_s, base_c4rom)
+#define BASE_C5ROM offsetof(cpu65_run_args_s, base_c5rom)
+#define BASE_CXROM offsetof(cpu65_run_args_s, base_cxrom)
+#define SOFTSWITCHES offsetof(cpu65_run_args_s, softswitches)
@@ -0,0 +1,91 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+#include "common.h"
+
+/*
+ * These "glue" macros become the C memory access functions installed in cpu65_vmem_r/cpu65_vmem_w for the portable
+ * cpu65_run() core.  Read functions are uint8_t func(uint16_t ea), write functions are void func(uint16_t ea, uint8_t b)
+ */
+
+#undef GLUE_BANK_READ
+#undef GLUE_BANK_MAYBE_READ_C3
+#undef GLUE_BANK_MAYBE_READ_CX
+#undef GLUE_BANK_WRITE
+#undef GLUE_BANK_MAYBEWRITE
+#undef GLUE_INLINE_READ
+#undef GLUE_EXTERN_C_READ
+#undef GLUE_NOP
+#undef GLUE_C_WRITE
+#undef GLUE_C_READ
+#undef GLUE_C_READ_ALTZP
+
+#define _BANK_POINTER(pointer) (*(uint8_t **)((uint8_t *)&run_args + (pointer)))
+
+#define GLUE_EXTERN_C_READ(func)
+
+#define GLUE_BANK_MAYBE_READ_CX(func,pointer) \
+uint8_t func(uint16_t ea) { \
+    if (!(run_args.softswitches & SS_CXROM)) { \
+        return ((uint8_t (*)(uint16_t))_BANK_POINTER(pointer))(ea); \
+    } \
+    return _BANK_POINTER(pointer)[ea]; \
+}
+
+#define GLUE_BANK_MAYBE_READ_C3(func,pointer) \
+uint8_t func(uint16_t ea) { \
+    if (!(run_args.softswitches & (SS_CXROM|SS_C3ROM))) { \
+        return ((uint8_t (*)(uint16_t))_BANK_POINTER(pointer))(ea); \
+    } \
+    return _BANK_POINTER(pointer)[ea]; \
+}
+
+#define GLUE_BANK_READ(func,pointer) \
+uint8_t func(uint16_t ea) { \
+    return _BANK_POINTER(pointer)[ea]; \
+}
+
+#define GLUE_BANK_WRITE(func,pointer) \
+void func(uint16_t ea, uint8_t b) { \
+    _BANK_POINTER(pointer)[ea] = b; \
+}
+
+#define GLUE_BANK_MAYBEWRITE(func,pointer) \
+void func(uint16_t ea, uint8_t b) { \
+    uint8_t *base = _BANK_POINTER(pointer); \
+    if (base) { \
+        base[ea] = b; \
+    } \
+}
+
+#define GLUE_INLINE_READ(func,off) \
+uint8_t func(uint16_t ea) { \
+    return *((uint8_t *)&run_args + (off)); \
+}
+
+#define GLUE_NOP(func) \
+void func(uint16_t ea, uint8_t b) { \
+}
+
+#define GLUE_C_WRITE(func) \
+void c_##func(uint16_t ea, uint8_t b); \
+void func(uint16_t ea, uint8_t b) { \
+    c_##func(ea, b); \
+}
+
+#define GLUE_C_READ(func) \
+uint8_t c_##func(uint16_t ea); \
+uint8_t func(uint16_t ea) { \
+    return c_##func(ea); \
+}
+
+#define GLUE_C_READ_ALTZP(func, ...) GLUE_C_READ(func)
+
@@ -31,6 +31,7 @@
 #define PREF_MOCKINGBOARD_ENABLED "mbEnabled"
 #define PREF_MOCKINGBOARD_VOLUME "mbVolume"
 #define PREF_SPEAKER_VOLUME "speakerVolume"
+#define PREF_SPEAKER_QUALITY "speakerQuality"
 #define PREF_AUDIO_LATENCY "audioLatency"
 
 // interface
@@ -40,6 +41,7 @@
 #define PREF_DISK_PATH "diskPath"
 #define PREF_DISK_ANIMATIONS_ENABLED "diskAnimationsEnabled"
 #define PREF_DISK_FAST_LOADING "diskFastLoading"
+#define PREF_DISK_ACCELERATED_IO "diskAcceleratedIO"
 #define PREF_SOFTHUD_COLOR "hudColorMode"
 
 // joystick
@@ -84,6 +86,7 @@
 #define PREF_COLOR_MODE "colorMode"
 #define PREF_MONO_MODE "monoMode"
 #define PREF_SHOW_HALF_SCANLINES "showHalfScanlines"
+#define PREF_NTSC_KERNEL "ntscKernel"
 
 // vm
 #define PREF_CPU_SCALE "cpuScale"
@@ -92,6 +95,7 @@
 #define PREF_DISK_PATH_A_RO "driveAInsertedDiskRO"
 #define PREF_DISK_PATH_B "driveBInsertedDisk"
 #define PREF_DISK_PATH_B_RO "driveBInsertedDiskRO"
+#define PREF_REWIND_BUDGET "rewindBudgetMB"
 
 typedef void (*prefs_change_callback_f)(const char * _NONNULL domain);
 
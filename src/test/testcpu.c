@@ -7407,6 +7407,51 @@ TEST test_TXS(uint8_t regX) {
     PASS();
 }
 
+// ----------------------------------------------------------------------------
+// Headless run API
+
+TEST test_headless_run_until_pc() {
+    // NOTE : testing builds hand each completed frame to a test thread, so this stays within the first video frame
+    timing_headlessBegin();
+
+    static const uint8_t prog[] = {
+        0xA2, 0x00,             // 0300 LDX #$00
+        0xE8,                   // 0302 INX
+        0xD0, 0xFD,             // 0303 BNE $0302
+        0xA9, 0x5A,             // 0305 LDA #$5A
+        0x4C, 0x07, 0x03,       // 0307 JMP $0307
+    };
+    memcpy(&apple_ii_64k[0][0x0300], prog, sizeof(prog));
+    run_args.cpu65_pc = 0x0300;
+    run_args.cpu65_a = 0x00;
+
+    // stops on the instruction boundary after the loop, in the middle of a quantum
+    ASSERT(timing_headlessRunUntilPC(0x0305, 100000));
+    ASSERT(run_args.cpu65_pc == 0x0305);
+    ASSERT(run_args.cpu65_x  == 0x00);
+    ASSERT(run_args.cpu65_a  == 0x00);
+
+    ASSERT(timing_headlessRunUntilPC(0x0307, 100000));
+    ASSERT(run_args.cpu65_pc == 0x0307);
+    ASSERT(run_args.cpu65_a  == 0x5A);
+
+    // already there
+    ASSERT(timing_headlessRunUntilPC(0x0307, 0));
+
+    // never reached, gives up after maxCycles
+    ASSERT(!timing_headlessRunUntilPC(0x0300, 5000));
+    ASSERT(run_args.cpu65_pc == 0x0307);
+
+    // halt map is disarmed afterwards
+    ASSERT(run_args.cpu65_haltmap == NULL);
+    ASSERT(timing_headlessRunCycles(5000) >= 5000);
+    ASSERT(run_args.cpu65_pc == 0x0307);
+
+    timing_headlessEnd();
+
+    PASS();
+}
+
 // ----------------------------------------------------------------------------
 // Test Suite
 
@@ -8048,6 +8093,11 @@ GREATEST_SUITE(test_suite_cpu) {
 #endif
         }
     } while (0);
+
+    // --------------------------------
+
+    fprintf(GREATEST_STDOUT, "\ntest_headless_run_until_pc :\n");
+    RUN_TEST(test_headless_run_until_pc);
 }
 
 SUITE(test_suite_cpu);
@@ -320,6 +320,87 @@ TEST test_savehello_po() {
     PASS();
 }
 
+TEST test_savehello_dsk_accelerated() {
+
+    prefs_setBoolValue(PREF_DOMAIN_INTERFACE, PREF_DISK_ACCELERATED_IO, true);
+    prefs_sync(PREF_DOMAIN_INTERFACE);
+
+    test_setup_boot_disk(BLANK_DSK, 0);
+    BOOT_TO_DOS();
+
+    ASSERT(apple_ii_64k[0][WATCHPOINT_ADDR] != TEST_FINISHED);
+
+    unsigned long calls = disk6_acceleratedCalls();
+
+    apple_ii_64k[0][WATCHPOINT_ADDR] = 0x0;
+    test_type_input("SAVE HELLO\r");
+    test_type_input("POKE7987,255:REM TRIGGER DEBUGGER\r");
+
+    debugger_go();
+
+    ASSERT(apple_ii_64k[0][WATCHPOINT_ADDR] == TEST_FINISHED);
+    WAIT_FOR_FB_SHA(SAVE_SHA1);
+    ASSERT(disk6_acceleratedCalls() > calls);
+
+    // read the VTOC through the RWTS interface, stashing the returned A and P
+    static const uint8_t rwts_call[] = {
+        0xA0, 0x20,             // LDY #$20
+        0xA9, 0x03,             // LDA #$03
+        0x20, 0xD9, 0x03,       // JSR $03D9
+        0x8D, 0x18, 0x03,       // STA $0318
+        0x08,                   // PHP
+        0x68,                   // PLA
+        0x8D, 0x19, 0x03,       // STA $0319
+        0xA9, 0xFF,             // LDA #$FF
+        0x8D, 0x33, 0x1F,       // STA $1F33
+        0x60,                   // RTS
+    };
+    static const uint8_t rwts_iob[] = {
+        0x01, 0x60, 0x01, 0x00, // type, slot*16, drive, volume
+        0x11, 0x00,             // track, sector
+        0xFB, 0xB7,             // DCT
+        0x00, 0x40,             // buffer
+        0x00, 0x00,
+        0x01,                   // READ
+        0xFF, 0x00, 0x00, 0x00, // error, volume found, last slot*16, last drive
+    };
+    memcpy(&apple_ii_64k[0][0x300], rwts_call, sizeof(rwts_call));
+    memcpy(&apple_ii_64k[0][0x320], rwts_iob, sizeof(rwts_iob));
+    memset(&apple_ii_64k[0][0x4000], 0xAA, 0x100);
+    apple_ii_64k[0][0x318] = 0xAA;
+    apple_ii_64k[0][0x319] = 0xFF;
+
+    calls = disk6_acceleratedCalls();
+
+    apple_ii_64k[0][WATCHPOINT_ADDR] = 0x0;
+    test_type_input("CALL768\r");
+
+    debugger_go();
+
+    ASSERT(apple_ii_64k[0][WATCHPOINT_ADDR] == TEST_FINISHED);
+    ASSERT(disk6_acceleratedCalls() == calls+1);
+    ASSERT(apple_ii_64k[0][0x318] == 0x00);             // A : no error
+    ASSERT((apple_ii_64k[0][0x319] & 0x01) == 0x00);    // carry clear
+    ASSERT(apple_ii_64k[0][0x320+0x0D] == 0x00);        // IOB error
+    ASSERT(apple_ii_64k[0][0x320+0x0E] == 0xFE);        // IOB volume found
+    ASSERT(apple_ii_64k[0][0x4001] == 0x11);            // VTOC : first catalog track
+    ASSERT(apple_ii_64k[0][0x4002] == 0x0F);            // VTOC : first catalog sector
+    ASSERT(apple_ii_64k[0][0x4003] == 0x03);            // VTOC : DOS release
+    ASSERT(apple_ii_64k[0][0x4034] == 0x23);            // VTOC : tracks per disk
+
+    REBOOT_TO_DOS();
+    debugger_go();
+    ASSERT(apple_ii_64k[0][WATCHPOINT_ADDR] == TEST_FINISHED);
+    WAIT_FOR_FB_SHA(BOOT_SCREEN);
+
+    disk6_eject(0);
+
+    prefs_setBoolValue(PREF_DOMAIN_INTERFACE, PREF_DISK_ACCELERATED_IO, false);
+    prefs_sync(PREF_DOMAIN_INTERFACE);
+
+    PASS();
+}
+
 #if CONFORMANT_TRACKS
 #   define EXPECTED_DISKWRITE_TRACE_DSK_FILE_SIZE 85915
 #   define EXPECTED_DISKWRITE_TRACE_DSK_SHA "05A9043B09605546F2BCFD31CB2E48C779227D95"
@@ -1443,7 +1524,8 @@ static int _test_disk_invalid_gzipped(int readonly) {
                 ASSERT(disk6.disk[0].nibblized == false);
                 ASSERT(disk6.disk[0].is_protected == false);
                 ASSERT(disk6.disk[0].track_valid == false);
-                ASSERT(disk6.disk[0].track_dirty == false);
+                ASSERT(disk6.disk[0].tracks_nibblized == 0);
+                ASSERT(disk6.disk[0].tracks_dirty == 0);
                 ASSERT(disk6.disk[0].skew_table == NULL);
                 ASSERT(disk6.disk[0].track_width == 0);
             }
@@ -1472,6 +1554,162 @@ TEST test_disk_invalid_gzipped_rw() {
     return _test_disk_invalid_gzipped(/*readonly:*/0);
 }
 
+TEST test_hdd_insert_2mg() {
+    const char *homedir = HOMEDIR;
+    char *image = NULL;
+    ASPRINTF(&image, "%s/a2_hdd_test.2mg", homedir);
+    ASSERT(image);
+    unlink(image);
+
+    // 2MG header + 1600 ProDOS-order blocks (800K), block N tagged with its number
+    const unsigned int num_blocks = 1600;
+    uint8_t header[64] = { '2', 'I', 'M', 'G' };
+    header[0x08] = 64;
+    header[0x0C] = 1;
+    header[0x14] = num_blocks & 0xFF; header[0x15] = num_blocks >> 8;
+    header[0x18] = 64;
+    header[0x1C] = (num_blocks*HDD_BLOCK_SIZE) & 0xFF; header[0x1D] = ((num_blocks*HDD_BLOCK_SIZE) >> 8) & 0xFF;
+    header[0x1E] = (num_blocks*HDD_BLOCK_SIZE) >> 16;
+
+    int fd = open(image, O_RDWR|O_CREAT|O_TRUNC, 0644);
+    ASSERT(fd >= 0);
+    ASSERT(write(fd, header, sizeof(header)) == sizeof(header));
+    uint8_t block[HDD_BLOCK_SIZE] = { 0 };
+    for (unsigned int i=0; i<num_blocks; i++) {
+        block[0] = i & 0xFF;
+        block[1] = i >> 8;
+        ASSERT(write(fd, block, sizeof(block)) == sizeof(block));
+    }
+
+    ASSERT(hdd_insert(fd, 0, image, /*readonly:*/0) == NULL);
+    TEMP_FAILURE_RETRY(close(fd));
+
+    ASSERT(hdd_blockCount(0) == num_blocks);
+
+    // ProDOS block device signature now present
+    const uint16_t cn = 0xC000 | (HDD_SLOT<<8);
+    ASSERT(hdd_romRead(cn+0x01) == 0x20);
+    ASSERT(hdd_romRead(cn+0x03) == 0x00);
+    ASSERT(hdd_romRead(cn+0x05) == 0x03);
+    ASSERT(hdd_romRead(cn+0x07) != 0x00);
+
+    hdd_eject(0);
+    ASSERT(hdd_blockCount(0) == 0);
+
+    unlink(image);
+    FREE(image);
+
+    PASS();
+}
+
+TEST test_hdd_firmware_io() {
+    const char *homedir = HOMEDIR;
+    char *image = NULL;
+    ASPRINTF(&image, "%s/a2_hdd_test.hdv", homedir);
+    ASSERT(image);
+    unlink(image);
+
+    // 280 blocks, block N tagged with its number
+    const unsigned int num_blocks = 280;
+    int fd = open(image, O_RDWR|O_CREAT|O_TRUNC, 0644);
+    ASSERT(fd >= 0);
+    uint8_t block[HDD_BLOCK_SIZE] = { 0 };
+    for (unsigned int i=0; i<num_blocks; i++) {
+        for (unsigned int j=2; j<HDD_BLOCK_SIZE; j++) {
+            block[j] = (i + j) & 0xFF;
+        }
+        block[0] = i & 0xFF;
+        block[1] = i >> 8;
+        ASSERT(write(fd, block, sizeof(block)) == sizeof(block));
+    }
+
+    // boot the floppy first, a mounted hard disk boots ahead of it
+    BOOT_TO_DOS();
+
+    ASSERT(hdd_insert(fd, 0, image, /*readonly:*/0) == NULL);
+
+    // STATUS, READ block 5 to $4000, WRITE it to block 6, READ block 6 back to $5000 ... all through the $Cn firmware
+    // driver entry point, stashing A and P after each call (and X/Y block count after STATUS)
+    const uint8_t cn = 0xC0 | HDD_SLOT;
+    const uint8_t drv = hdd_romRead((cn<<8) | 0xFF);
+    const uint8_t hdd_calls[] = {
+        0xA9, 0x00, 0x85, 0x42,             // LDA #STATUS : STA $42
+        0xA9, HDD_SLOT<<4, 0x85, 0x43,      // LDA #$n0 : STA $43
+        0x20, drv, cn,                      // JSR $Cnxx
+        0x8D, 0x80, 0x03,                   // STA $0380
+        0x08, 0x68, 0x8D, 0x81, 0x03,       // PHP : PLA : STA $0381
+        0x8E, 0x82, 0x03,                   // STX $0382
+        0x8C, 0x83, 0x03,                   // STY $0383
+
+        0xA9, 0x01, 0x85, 0x42,             // LDA #READ : STA $42
+        0xA9, 0x00, 0x85, 0x44,             // LDA #$00 : STA $44
+        0xA9, 0x40, 0x85, 0x45,             // LDA #$40 : STA $45
+        0xA9, 0x05, 0x85, 0x46,             // LDA #$05 : STA $46
+        0xA9, 0x00, 0x85, 0x47,             // LDA #$00 : STA $47
+        0x20, drv, cn,                      // JSR $Cnxx
+        0x8D, 0x84, 0x03,                   // STA $0384
+        0x08, 0x68, 0x8D, 0x85, 0x03,       // PHP : PLA : STA $0385
+
+        0xA9, 0x02, 0x85, 0x42,             // LDA #WRITE : STA $42
+        0xA9, 0x06, 0x85, 0x46,             // LDA #$06 : STA $46
+        0x20, drv, cn,                      // JSR $Cnxx
+        0x8D, 0x86, 0x03,                   // STA $0386
+        0x08, 0x68, 0x8D, 0x87, 0x03,       // PHP : PLA : STA $0387
+
+        0xA9, 0x01, 0x85, 0x42,             // LDA #READ : STA $42
+        0xA9, 0x50, 0x85, 0x45,             // LDA #$50 : STA $45
+        0x20, drv, cn,                      // JSR $Cnxx
+        0x8D, 0x88, 0x03,                   // STA $0388
+        0x08, 0x68, 0x8D, 0x89, 0x03,       // PHP : PLA : STA $0389
+
+        0xA9, 0xFF, 0x8D, 0x33, 0x1F,       // LDA #$FF : STA $1F33
+        0x60,                               // RTS
+    };
+    ASSERT(sizeof(hdd_calls) <= 0x80);
+    memcpy(&apple_ii_64k[0][0x300], hdd_calls, sizeof(hdd_calls));
+    memset(&apple_ii_64k[0][0x380], 0xAA, 0x10);
+    memset(&apple_ii_64k[0][0x4000], 0x00, HDD_BLOCK_SIZE);
+    memset(&apple_ii_64k[0][0x5000], 0x00, HDD_BLOCK_SIZE);
+
+    apple_ii_64k[0][WATCHPOINT_ADDR] = 0x00;
+    test_type_input("CALL768\r");
+
+    debugger_go();
+
+    ASSERT(apple_ii_64k[0][WATCHPOINT_ADDR] == TEST_FINISHED);
+
+    // STATUS : no error, block count in X/Y
+    ASSERT(apple_ii_64k[0][0x380] == 0x00);
+    ASSERT((apple_ii_64k[0][0x381] & 0x01) == 0x00);
+    ASSERT(apple_ii_64k[0][0x382] == (num_blocks & 0xFF));
+    ASSERT(apple_ii_64k[0][0x383] == (num_blocks >> 8));
+
+    // READ/WRITE/READ : no error
+    for (unsigned int i=0x384; i<0x38A; i+=2) {
+        ASSERT(apple_ii_64k[0][i] == 0x00);
+        ASSERT((apple_ii_64k[0][i+1] & 0x01) == 0x00);
+    }
+
+    // block 5 read to $4000, and read back from block 6 to $5000
+    ASSERT(apple_ii_64k[0][0x4000] == 5);
+    ASSERT(apple_ii_64k[0][0x4001] == 0);
+    ASSERT(apple_ii_64k[0][0x41FF] == ((5 + 0x1FF) & 0xFF));
+    ASSERT(memcmp(&apple_ii_64k[0][0x4000], &apple_ii_64k[0][0x5000], HDD_BLOCK_SIZE) == 0);
+
+    // write reached the image file
+    hdd_eject(0);
+    ASSERT(pread(fd, block, sizeof(block), 6*HDD_BLOCK_SIZE) == sizeof(block));
+    ASSERT(memcmp(block, &apple_ii_64k[0][0x4000], HDD_BLOCK_SIZE) == 0);
+    ASSERT(pread(fd, block, sizeof(block), 7*HDD_BLOCK_SIZE) == sizeof(block));
+    ASSERT(block[0] == 7);
+    TEMP_FAILURE_RETRY(close(fd));
+
+    unlink(image);
+    FREE(image);
+
+    PASS();
+}
+
 #if TEST_DISK_EDGE_CASES
 #define DROL_DSK "Drol.dsk.gz"
 #define DROL_CRACK_SCREEN_SHA "ADC037D745304F17202D6F6BD6696AA443E8F8DC"
@@ -1533,6 +1771,7 @@ GREATEST_SUITE(test_suite_disk) {
     RUN_TESTp(test_savehello_dsk);
     RUN_TESTp(test_savehello_nib);
     RUN_TESTp(test_savehello_po);
+    RUN_TESTp(test_savehello_dsk_accelerated);
 
     RUN_TESTp(test_disk_bytes_savehello_dsk);
     RUN_TESTp(test_disk_bytes_savehello_nib);
@@ -1569,6 +1808,9 @@ GREATEST_SUITE(test_suite_disk) {
     RUN_TESTp(test_disk_invalid_gzipped_ro);
     RUN_TESTp(test_disk_invalid_gzipped_rw);
 
+    RUN_TESTp(test_hdd_insert_2mg);
+    RUN_TESTp(test_hdd_firmware_io);
+
     // edge-case tests may require testing copyrighted images (which I have in my possession by legally owning the
     // original disk image (yep, I do ;-)
 #if TEST_DISK_EDGE_CASES
@@ -10,6 +10,7 @@
  */
 
 #include "testcommon.h"
+#include "video/ntsc.h"
 
 static bool test_thread_running = false;
 
@@ -523,6 +524,58 @@ TEST test_80col_hires() {
     PASS();
 }
 
+// ----------------------------------------------------------------------------
+// NTSC kernels : per-column plotting and every span kernel supported on this host must match the original per-pixel
+// plotter
+
+TEST test_ntsc_kernels() {
+    static PIXEL_TYPE fbReference[SCANWIDTH<<1];
+    static PIXEL_TYPE fbKernel[SCANWIDTH<<1];
+
+    uint16_t bits14[CYCLES_VIS];
+    for (unsigned int col = 0; col < CYCLES_VIS; col++) {
+        bits14[col] = (uint16_t)(random() & 0x3FFF);
+    }
+
+    ntsc_kernel_t savedKernel = ntsc_getKernel();
+    const color_mode_t modes[] = { COLOR_MODE_MONO, COLOR_MODE_COLOR_MONITOR, COLOR_MODE_MONO_TV, COLOR_MODE_COLOR_TV };
+
+    for (unsigned int m = 0; m < sizeof(modes)/sizeof(modes[0]); m++) {
+        color_mode_t mode = modes[m];
+
+        // start from a flushed signal history
+        ntsc_flushScanlineReference(mode, fbReference);
+
+        memset(fbReference, 0, sizeof(fbReference));
+        for (unsigned int col = 0; col < CYCLES_VIS; col++) {
+            ntsc_plotBitsReference(mode, bits14[col], fbReference + (col * FONT_WIDTH_PIXELS));
+        }
+        ntsc_flushScanlineReference(mode, fbReference + _SCANWIDTH);
+
+        for (ntsc_kernel_t kernel = NTSC_KERNEL_SCALAR; kernel < NUM_NTSC_KERNELS; kernel++) {
+            if (!ntsc_setKernel(kernel)) {
+                continue;
+            }
+
+            memset(fbKernel, 0, sizeof(fbKernel));
+            for (unsigned int col = 0; col < CYCLES_VIS; col++) {
+                ntsc_plotBits(mode, bits14[col], fbKernel + (col * FONT_WIDTH_PIXELS));
+            }
+            ntsc_flushScanline(mode, fbKernel + _SCANWIDTH);
+            ASSERT(memcmp(fbReference, fbKernel, sizeof(fbReference)) == 0);
+
+            memset(fbKernel, 0, sizeof(fbKernel));
+            ntsc_plotSpan(mode, bits14, CYCLES_VIS, fbKernel);
+            ntsc_flushScanline(mode, fbKernel + _SCANWIDTH);
+            ASSERT(memcmp(fbReference, fbKernel, sizeof(fbReference)) == 0);
+        }
+    }
+
+    ntsc_setKernel(savedKernel);
+
+    PASS();
+}
+
 // ----------------------------------------------------------------------------
 // Test Suite
 
@@ -645,6 +698,10 @@ GREATEST_SUITE(test_suite_display) {
 
     RUN_TEST(test_80col_hires);
 
+    // NTSC kernels
+
+    RUN_TEST(test_ntsc_kernels);
+
     // ...
     disk6_eject(0);
     pthread_mutex_unlock(&interface_mutex);
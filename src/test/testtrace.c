@@ -10,6 +10,8 @@
  */
 
 #include "testcommon.h"
+#include "audio/AY8910.h"
+#include "meta/cputrace.h"
 
 #define TESTING_DISK "testvm1.dsk.gz"
 #define BLANK_DSK "blank.dsk.gz"
@@ -232,6 +234,398 @@ TEST test_mockingboard_1() {
     PASS();
 }
 
+// ----------------------------------------------------------------------------
+// AY-3-8910 renderers : known register sequences must render the same voices with every renderer (expected output is
+// that of the original per-sample FUSE renderer)
+
+#define AY_RATE 44100
+#define AY_FRAMESIZ (AY_RATE/60)
+#define AY_FRAMES 4
+#define AY_SAMPLES (AY_FRAMES*AY_FRAMESIZ)
+#define AY_FRAME_CYCLES (CLK_6502_INT/60)
+
+#define AY_SILENCE_SHA "F2CBDF9CD5E77F1A790546D59C742DC2029D2A04"
+
+typedef struct ay_write_t {
+    unsigned int frame;
+    unsigned int cycle; // within the frame
+    int reg;
+    int val;
+} ay_write_t;
+
+#define AY_WRITES_END { UINT_MAX, 0, 0, 0 }
+
+static int16_t ay_voices[3][AY_SAMPLES];
+
+static void _ay_render(ay8910_renderer_t renderer, const ay_write_t *writes) {
+    static struct CAY8910 chip;
+    _ay8910_testInitChip(&chip, CLK_6502_INT, AY_RATE);
+
+    ay8910_renderer_t savedRenderer = AY8910_getRenderer();
+    AY8910_setRenderer(renderer);
+
+    for (unsigned int frame = 0; frame < AY_FRAMES; frame++) {
+        for (const ay_write_t *w = writes; w->frame != UINT_MAX; w++) {
+            if (w->frame == frame) {
+                sound_ay_write(&chip, w->reg, w->val, w->cycle);
+            }
+        }
+        int16_t *buffers[3] = {
+            ay_voices[0] + frame*AY_FRAMESIZ,
+            ay_voices[1] + frame*AY_FRAMESIZ,
+            ay_voices[2] + frame*AY_FRAMESIZ,
+        };
+        _ay8910_testRenderFrame(&chip, buffers, AY_FRAMESIZ);
+    }
+
+    AY8910_setRenderer(savedRenderer);
+}
+
+static void _ay_voiceSHA(unsigned int voice, char *mdstr) {
+    uint8_t md[SHA_DIGEST_LENGTH];
+    SHA1((const unsigned char *)ay_voices[voice], sizeof(ay_voices[voice]), md);
+    sha1_to_str(md, mdstr);
+}
+
+// 996Hz square wave on channel A at full volume
+#define AY_TONE_A_SHA "062D54F62980813C475CC442AAB5BE317BD4BED4"
+TEST test_ay8910_tone() {
+    const ay_write_t writes[] = {
+        { 0, 0, 0, 0x40 },  // A tone period $040
+        { 0, 0, 1, 0x00 },
+        { 0, 0, 7, 0x3E },  // mixer : tone A only
+        { 0, 0, 8, 0x0F },  // A volume 15
+        AY_WRITES_END
+    };
+
+    char mdstr[(SHA_DIGEST_LENGTH*2)+1];
+    for (ay8910_renderer_t renderer = AY8910_RENDERER_SCALAR; renderer < NUM_AY8910_RENDERERS; renderer++) {
+        _ay_render(renderer, writes);
+
+        // full swing square wave : ~133 half periods over 4 frames
+        unsigned int edges = 0;
+        for (unsigned int i = 1; i < AY_SAMPLES; i++) {
+            ASSERT(ay_voices[0][i] >= -10752 && ay_voices[0][i] <= 10752);
+            if ((ay_voices[0][i-1] < 0) != (ay_voices[0][i] < 0)) {
+                ++edges;
+            }
+        }
+        ASSERT(edges >= 130 && edges <= 136);
+
+        _ay_voiceSHA(0, mdstr);
+        ASSERT(strcmp(mdstr, AY_TONE_A_SHA) == 0);
+        _ay_voiceSHA(1, mdstr);
+        ASSERT(strcmp(mdstr, AY_SILENCE_SHA) == 0);
+        _ay_voiceSHA(2, mdstr);
+        ASSERT(strcmp(mdstr, AY_SILENCE_SHA) == 0);
+    }
+
+    PASS();
+}
+
+// noise only on channel B
+#define AY_NOISE_B_SHA "0447314594B35CEADF631244BC461E711A438791"
+TEST test_ay8910_noise() {
+    const ay_write_t writes[] = {
+        { 0, 0, 6, 0x10 },  // noise period $10
+        { 0, 0, 7, 0x2F },  // mixer : noise B only
+        { 0, 0, 9, 0x0C },  // B volume 12
+        AY_WRITES_END
+    };
+
+    char mdstr[(SHA_DIGEST_LENGTH*2)+1];
+    for (ay8910_renderer_t renderer = AY8910_RENDERER_SCALAR; renderer < NUM_AY8910_RENDERERS; renderer++) {
+        _ay_render(renderer, writes);
+
+        // noise gates channel B between silence and its volume level
+        for (unsigned int i = 0; i < AY_SAMPLES; i++) {
+            ASSERT(ay_voices[1][i] >= 0 && ay_voices[1][i] <= 6133);
+        }
+
+        _ay_voiceSHA(0, mdstr);
+        ASSERT(strcmp(mdstr, AY_SILENCE_SHA) == 0);
+        _ay_voiceSHA(1, mdstr);
+        ASSERT(strcmp(mdstr, AY_NOISE_B_SHA) == 0);
+        _ay_voiceSHA(2, mdstr);
+        ASSERT(strcmp(mdstr, AY_SILENCE_SHA) == 0);
+    }
+
+    PASS();
+}
+
+// tone on channel C with its volume driven by a triangle envelope
+#define AY_ENVELOPE_C_SHA "B85AAB2E8015A58F951130AD3871E1A28B46BD9D"
+TEST test_ay8910_envelope() {
+    const ay_write_t writes[] = {
+        { 0, 0, 4, 0x80 },  // C tone period $080
+        { 0, 0, 5, 0x00 },
+        { 0, 0, 7, 0x3B },  // mixer : tone C only
+        { 0, 0, 10, 0x10 }, // C volume from envelope
+        { 0, 0, 11, 0x00 }, // envelope period $0200
+        { 0, 0, 12, 0x02 },
+        { 0, 0, 13, 0x0E }, // envelope shape : triangle, starting up
+        AY_WRITES_END
+    };
+
+    char mdstr[(SHA_DIGEST_LENGTH*2)+1];
+    for (ay8910_renderer_t renderer = AY8910_RENDERER_SCALAR; renderer < NUM_AY8910_RENDERERS; renderer++) {
+        _ay_render(renderer, writes);
+
+        // envelope starts from silence
+        ASSERT(ay_voices[2][0] == 0);
+
+        _ay_voiceSHA(0, mdstr);
+        ASSERT(strcmp(mdstr, AY_SILENCE_SHA) == 0);
+        _ay_voiceSHA(1, mdstr);
+        ASSERT(strcmp(mdstr, AY_SILENCE_SHA) == 0);
+        _ay_voiceSHA(2, mdstr);
+        ASSERT(strcmp(mdstr, AY_ENVELOPE_C_SHA) == 0);
+    }
+
+    PASS();
+}
+
+// all channels with tone, noise and envelope, changing registers mid-frame
+#define AY_MIXED_A_SHA "FBB00E87D6DE93F7330D8EF162581BE829CE41A2"
+#define AY_MIXED_B_SHA "0181874E95E312C033C4D0634D812A5A5A25A710"
+#define AY_MIXED_C_SHA "E9CB4B7F8972EA4DD009EBCBA6D6D00E9FBB42BB"
+TEST test_ay8910_mixed() {
+    const ay_write_t writes[] = {
+        { 0, 0, 0, 0x55 },  // A tone period $155
+        { 0, 0, 1, 0x01 },
+        { 0, 0, 2, 0x2A },  // B tone period $02A
+        { 0, 0, 3, 0x00 },
+        { 0, 0, 4, 0xC3 },  // C tone period $0C3
+        { 0, 0, 5, 0x00 },
+        { 0, 0, 6, 0x07 },  // noise period $07
+        { 0, 0, 7, 0x1C },  // mixer : tone A, B, noise A, B
+        { 0, 0, 8, 0x0D },  // A volume 13
+        { 0, 0, 9, 0x10 },  // B volume from envelope
+        { 0, 0, 10, 0x08 }, // C volume 8
+        { 0, 0, 11, 0x80 }, // envelope period $0080
+        { 0, 0, 12, 0x00 },
+        { 0, 0, 13, 0x08 }, // envelope shape : sawtooth down
+        { 1, AY_FRAME_CYCLES/2, 0, 0x20 }, // mid-frame A period and volume change
+        { 1, AY_FRAME_CYCLES/2, 8, 0x06 },
+        { 2, AY_FRAME_CYCLES/4, 7, 0x38 }, // mixer : tones only
+        { 2, (AY_FRAME_CYCLES*3)/4, 13, 0x0A }, // retrigger envelope : triangle, starting down
+        { 3, AY_FRAME_CYCLES/8, 9, 0x00 },
+        { 3, (AY_FRAME_CYCLES*5)/8, 10, 0x0F },
+        AY_WRITES_END
+    };
+
+    char mdstr[(SHA_DIGEST_LENGTH*2)+1];
+    for (ay8910_renderer_t renderer = AY8910_RENDERER_SCALAR; renderer < NUM_AY8910_RENDERERS; renderer++) {
+        _ay_render(renderer, writes);
+
+        _ay_voiceSHA(0, mdstr);
+        ASSERT(strcmp(mdstr, AY_MIXED_A_SHA) == 0);
+        _ay_voiceSHA(1, mdstr);
+        ASSERT(strcmp(mdstr, AY_MIXED_B_SHA) == 0);
+        _ay_voiceSHA(2, mdstr);
+        ASSERT(strcmp(mdstr, AY_MIXED_C_SHA) == 0);
+    }
+
+    PASS();
+}
+
+// ----------------------------------------------------------------------------
+// Mockingboard mixer : 12 voices (4 chips x 3) into stereo, chips 0,2 left and chips 1,3 right
+
+#define MB_MIX_SAMPLES 21 // not a multiple of the SIMD width
+
+TEST test_mockingboard_mixer() {
+    static short levels[4][MB_MIX_SAMPLES];
+    const short chipLevel[4] = { 1000, -3000, 2000, -9000 };
+    short *voices[12];
+    for (unsigned int v = 0; v < 12; v++) {
+        for (unsigned int i = 0; i < MB_MIX_SAMPLES; i++) {
+            levels[v/3][i] = chipLevel[v/3];
+        }
+        voices[v] = levels[v/3];
+    }
+
+    short mix[MB_MIX_SAMPLES*2];
+    for (unsigned int scalar = 0; scalar < 2; scalar++) {
+        // left : 3*(1000+2000), right : 3*(-3000-9000) clamped
+        _mb_testMixVoices(voices, MB_MIX_SAMPLES, /*phasor:*/false, 1.f, mix, scalar);
+        for (unsigned int i = 0; i < MB_MIX_SAMPLES; i++) {
+            ASSERT(mix[i*2+0] == 9000);
+            ASSERT(mix[i*2+1] == -32768);
+        }
+
+        // Phasor attenuates each voice to 2/3 (truncated) : left 3*(666+1333), right 3*(-2000-6000)
+        _mb_testMixVoices(voices, MB_MIX_SAMPLES, /*phasor:*/true, 1.f, mix, scalar);
+        for (unsigned int i = 0; i < MB_MIX_SAMPLES; i++) {
+            ASSERT(mix[i*2+0] == 5997);
+            ASSERT(mix[i*2+1] == -24000);
+        }
+
+        _mb_testMixVoices(voices, MB_MIX_SAMPLES, /*phasor:*/true, 0.5f, mix, scalar);
+        for (unsigned int i = 0; i < MB_MIX_SAMPLES; i++) {
+            ASSERT(mix[i*2+0] == 2998);
+            ASSERT(mix[i*2+1] == -12000);
+        }
+    }
+
+    // rendered voices mix identically through the scalar and SIMD mixers
+    _ay_render(AY8910_RENDERER_BLOCK, (const ay_write_t[]){
+        { 0, 0, 0, 0x40 }, { 0, 0, 2, 0x2A }, { 0, 0, 6, 0x07 }, { 0, 0, 7, 0x00 },
+        { 0, 0, 8, 0x0F }, { 0, 0, 9, 0x0F }, { 0, 0, 10, 0x0F }, AY_WRITES_END
+    });
+    for (unsigned int v = 0; v < 12; v++) {
+        voices[v] = ay_voices[v % 3];
+    }
+    short *mixScalar = MALLOC(AY_SAMPLES * 2 * sizeof(short));
+    short *mixSIMD = MALLOC(AY_SAMPLES * 2 * sizeof(short));
+    for (unsigned int phasor = 0; phasor < 2; phasor++) {
+        _mb_testMixVoices(voices, AY_SAMPLES, phasor, 0.7f, mixScalar, /*scalar:*/true);
+        _mb_testMixVoices(voices, AY_SAMPLES, phasor, 0.7f, mixSIMD, /*scalar:*/false);
+        ASSERT(memcmp(mixScalar, mixSIMD, AY_SAMPLES * 2 * sizeof(short)) == 0);
+    }
+    FREE(mixScalar);
+    FREE(mixSIMD);
+
+    PASS();
+}
+
+// ----------------------------------------------------------------------------
+// Speaker BLEP renderer : known toggle sequences rendered as band-limited steps
+
+#define SPKR_CYCLES_PER_SAMPLE 23.0 // //e cycles per 44.1kHz sample, truncated as speaker.c does
+#define SPKR_SAMPLES 1024
+#define SPKR_CYCLES ((unsigned long)((SPKR_SAMPLES+0.5)*SPKR_CYCLES_PER_SAMPLE)) // margin for the sample phase rounding
+#define SPKR_LEVEL SPKR_DATA_INIT
+
+static const unsigned int spkr_taps[NUM_SPEAKER_QUALITY] = { 0, 8, 32 };
+
+static int16_t spkr_stereo[SPKR_SAMPLES*NUM_CHANNELS];
+static int16_t spkr_samples[SPKR_SAMPLES];
+
+// renders SPKR_SAMPLES, returns false if fewer were rendered or the channels differ
+static bool _spkr_render(long quality, const unsigned long *toggles, unsigned int numToggles) {
+    memset(spkr_stereo, 0x0, sizeof(spkr_stereo));
+    unsigned long count = _speaker_testRenderBlep(quality, SPKR_CYCLES_PER_SAMPLE, toggles, numToggles, SPKR_CYCLES, spkr_stereo, SPKR_SAMPLES*NUM_CHANNELS);
+    if (count != SPKR_SAMPLES*NUM_CHANNELS) {
+        return false;
+    }
+    for (unsigned int i = 0; i < SPKR_SAMPLES; i++) {
+        spkr_samples[i] = spkr_stereo[i*NUM_CHANNELS];
+        if (spkr_stereo[i*NUM_CHANNELS + NUM_CHANNELS-1] != spkr_samples[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _spkr_samplesSHA(char *mdstr) {
+    uint8_t md[SHA_DIGEST_LENGTH];
+    SHA1((const unsigned char *)spkr_samples, sizeof(spkr_samples), md);
+    sha1_to_str(md, mdstr);
+}
+
+// single step up, on a sample boundary and at every sub-sample offset
+static const int16_t spkr_step_fast[8] = { 2, 25, -227, 2048, 4322, 4070, 4093, 4095 };
+TEST test_speaker_blep_step() {
+    const unsigned int at = 100;
+    for (long quality = SPEAKER_QUALITY_BLEP_FAST; quality < NUM_SPEAKER_QUALITY; quality++) {
+        const unsigned int taps = spkr_taps[quality];
+        int16_t prevMid = SHRT_MAX;
+        for (unsigned int offset = 0; offset < (unsigned int)SPKR_CYCLES_PER_SAMPLE; offset++) {
+            unsigned long toggle = (unsigned long)(at*SPKR_CYCLES_PER_SAMPLE) + offset;
+            ASSERT(_spkr_render(quality, &toggle, 1));
+
+            // quiet until the step, then settled exactly on the new level once the kernel has passed
+            for (unsigned int i = 0; i < at; i++) {
+                ASSERT(spkr_samples[i] == 0);
+            }
+            for (unsigned int i = at+taps; i < SPKR_SAMPLES; i++) {
+                ASSERT(spkr_samples[i] == SPKR_LEVEL);
+            }
+
+            // ringing stays within the Gibbs overshoot of the ideal step
+            for (unsigned int i = at; i < at+taps; i++) {
+                ASSERT(spkr_samples[i] > -SPKR_LEVEL/8);
+                ASSERT(spkr_samples[i] < SPKR_LEVEL + SPKR_LEVEL/8);
+            }
+
+            // a later step is resolved to sub-sample position : the midpoint of the transition can only get lower
+            int16_t mid = spkr_samples[at + taps/2];
+            ASSERT(mid <= prevMid);
+            prevMid = mid;
+
+            // time-invariant : the same step one sample later is the same output one sample later
+            int16_t step[32];
+            memcpy(step, &spkr_samples[at], taps*sizeof(int16_t));
+            toggle += (unsigned long)SPKR_CYCLES_PER_SAMPLE;
+            ASSERT(_spkr_render(quality, &toggle, 1));
+            ASSERT(spkr_samples[at] == 0);
+            ASSERT(memcmp(step, &spkr_samples[at+1], taps*sizeof(int16_t)) == 0);
+
+            if (quality == SPEAKER_QUALITY_BLEP_FAST && offset == 0) {
+                ASSERT(memcmp(step, spkr_step_fast, sizeof(spkr_step_fast)) == 0);
+            }
+        }
+
+        // the midpoint moved across the sub-sample offsets
+        unsigned long toggle = (unsigned long)(at*SPKR_CYCLES_PER_SAMPLE);
+        ASSERT(_spkr_render(quality, &toggle, 1));
+        ASSERT(spkr_samples[at + taps/2] > prevMid);
+    }
+
+    PASS();
+}
+
+// ~1kHz square wave, then a toggle pair closer than one sample and a quiet tail
+#define SPKR_SQUARE_FAST_SHA "DAF4B8894C59C0FA8E32C4C367731D8C98E83F26"
+#define SPKR_SQUARE_BEST_SHA "4A26367A0FC2FFB38BAEDF7ACF174CF0154B0255"
+TEST test_speaker_blep_square() {
+    const unsigned long period = 511; // cycles per half wave, ~22.2 samples
+    unsigned long toggles[32];
+    unsigned int numToggles = 0;
+    for (unsigned long t = 50; numToggles < 30; t += period) {
+        toggles[numToggles++] = t;
+    }
+    toggles[numToggles] = toggles[numToggles-1] + period; // click : +level and back to -level within 5 cycles
+    ++numToggles;
+    toggles[numToggles] = toggles[numToggles-1] + 5;
+    ++numToggles;
+    const unsigned long lastToggle = toggles[numToggles-1];
+
+    char mdstr[(SHA_DIGEST_LENGTH*2)+1];
+    for (long quality = SPEAKER_QUALITY_BLEP_FAST; quality < NUM_SPEAKER_QUALITY; quality++) {
+        const unsigned int taps = spkr_taps[quality];
+        ASSERT(_spkr_render(quality, toggles, numToggles));
+
+        if (taps < period/SPKR_CYCLES_PER_SAMPLE) {
+            // short kernel settles on the square wave level before each toggle
+            for (unsigned int i = 1; i < 30; i++) {
+                int16_t expected = (i & 1) ? SPKR_LEVEL : -SPKR_LEVEL;
+                ASSERT(spkr_samples[(unsigned int)(toggles[i]/SPKR_CYCLES_PER_SAMPLE) - 1] == expected);
+            }
+        }
+
+        // the click is a brief blip that returns to the low level
+        unsigned int lastSample = (unsigned int)(lastToggle/SPKR_CYCLES_PER_SAMPLE);
+        int16_t peak = SHRT_MIN;
+        for (unsigned int i = lastSample; i < lastSample+taps; i++) {
+            if (spkr_samples[i] > peak) {
+                peak = spkr_samples[i];
+            }
+        }
+        ASSERT(peak > -SPKR_LEVEL);
+        ASSERT(peak < 0);
+        for (unsigned int i = lastSample+taps; i < SPKR_SAMPLES; i++) {
+            ASSERT(spkr_samples[i] == -SPKR_LEVEL);
+        }
+
+        _spkr_samplesSHA(mdstr);
+        ASSERT(strcmp(mdstr, (quality == SPEAKER_QUALITY_BLEP_FAST) ? SPKR_SQUARE_FAST_SHA : SPKR_SQUARE_BEST_SHA) == 0);
+    }
+
+    PASS();
+}
+
 // ----------------------------------------------------------------------------
 // CPU tracing
 
@@ -461,6 +855,78 @@ TEST test_cputrace_hello_dsk() {
     PASS();
 }
 
+TEST test_cputrace_hello_dsk_binary() {
+    test_setup_boot_disk(BLANK_DSK, 0);
+
+    BOOT_TO_DOS();
+
+    const char *homedir = HOMEDIR;
+    char *input = NULL;
+    char *output = NULL;
+    ASPRINTF(&input, "%s/a2_cputrace_hello_dsk.bin", homedir);
+    ASPRINTF(&output, "%s/a2_cputrace_hello_dsk.txt", homedir);
+    if (input) {
+        unlink(input);
+        cpu65_trace_beginBinary(input);
+    }
+
+    apple_ii_64k[0][WATCHPOINT_ADDR] = 0x00;
+    test_type_input_deterministically("RUN HELLO\r");
+    debugger_go();
+
+    cpu65_trace_end();
+    disk6_eject(0);
+
+    // decoded binary trace matches the text trace
+    do {
+        FILE *fpIn = fopen(input, "r");
+        FILE *fpOut = fopen(output, "w");
+        ASSERT(fpIn && fpOut);
+
+        cputrace_header_s header = { { 0 } };
+        ASSERT(fread(&header, sizeof(header), 1, fpIn) == 1);
+        ASSERT(memcmp(header.magick, CPUTRACE_MAGICK, CPUTRACE_MAGICK_LEN) == 0);
+        ASSERT(header.recordSize == sizeof(cputrace_record_s));
+
+        unsigned long cycles = (unsigned long)header.cyclesBase;
+        cputrace_record_s rec;
+        while (fread(&rec, sizeof(rec), 1, fpIn) == 1) {
+            cycles += rec.cyclesDelta;
+            cputrace_printRecord(fpOut, &rec, cycles, /*showEA:*/false);
+        }
+        fclose(fpIn);
+        fclose(fpOut);
+    } while (0);
+
+    do {
+        uint8_t md[SHA_DIGEST_LENGTH];
+        char mdstr0[(SHA_DIGEST_LENGTH*2)+1];
+
+        FILE *fp = fopen(output, "r");
+        fseek(fp, 0, SEEK_END);
+        long expectedSize = ftell(fp);
+        ASSERT(expectedSize == EXPECTED_CPUTRACE_HELLO_FILE_SIZE);
+        fseek(fp, 0, SEEK_SET);
+        unsigned char *buf = MALLOC(EXPECTED_CPUTRACE_HELLO_FILE_SIZE);
+        if (fread(buf, 1, EXPECTED_CPUTRACE_HELLO_FILE_SIZE, fp) != EXPECTED_CPUTRACE_HELLO_FILE_SIZE) {
+            ASSERT(false);
+        }
+        fclose(fp); fp = NULL;
+        SHA1(buf, EXPECTED_CPUTRACE_HELLO_FILE_SIZE, md);
+        FREE(buf);
+
+        sha1_to_str(md, mdstr0);
+        ASSERT(strcmp(mdstr0, EXPECTED_CPUTRACE_HELLO_SHA) == 0);
+    } while(0);
+
+    unlink(input);
+    unlink(output);
+    FREE(input);
+    FREE(output);
+
+    PASS();
+}
+
 #define EXPECTED_CPUTRACE_HELLO_NIB_FILE_SIZE 17318711
 #define EXPECTED_CPUTRACE_HELLO_NIB_SHA "4DD390FCC46A1928D967F286C33ABD18AE2B9EEC"
 TEST test_cputrace_hello_nib() {
@@ -721,6 +1187,13 @@ GREATEST_SUITE(test_suite_trace) {
 #if NULL_AUDIO_RENDERER_IS_FIXED_FOR_THIS_TEST
     RUN_TESTp(test_mockingboard_1);
 #endif
+    RUN_TESTp(test_ay8910_tone);
+    RUN_TESTp(test_ay8910_noise);
+    RUN_TESTp(test_ay8910_envelope);
+    RUN_TESTp(test_ay8910_mixed);
+    RUN_TESTp(test_mockingboard_mixer);
+    RUN_TESTp(test_speaker_blep_step);
+    RUN_TESTp(test_speaker_blep_square);
 
     RUN_TESTp(test_boot_disk_cputrace);
 #if CPU_TRACING_WITH_IRQ_HANDLING_SAME_AS_BASELINE
@@ -729,6 +1202,7 @@ GREATEST_SUITE(test_suite_trace) {
     RUN_TESTp(test_boot_disk_cputrace3);
 
     RUN_TESTp(test_cputrace_hello_dsk);
+    RUN_TESTp(test_cputrace_hello_dsk_binary);
     RUN_TESTp(test_cputrace_hello_nib);
     RUN_TESTp(test_cputrace_hello_po);
 
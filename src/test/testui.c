@@ -64,7 +64,7 @@ static int _assert_blank_boot(void) {
     ASSERT(disk6.disk[0].nib_image_data != NULL);
     ASSERT(disk6.disk[0].track_width == BLANK_TRACK_WIDTH);
     ASSERT(!disk6.disk[0].nibblized);
-    ASSERT(!disk6.disk[0].track_dirty);
+    ASSERT(!disk6.disk[0].tracks_dirty);
     extern int skew_table_6_do[16];
     ASSERT(disk6.disk[0].skew_table == skew_table_6_do);
 
@@ -202,6 +202,184 @@ TEST test_load_state_1() {
     PASS();
 }
 
+static int _load_state_fd(int fdState) {
+    ASSERT(lseek(fdState, 0, SEEK_SET) == 0);
+
+    bool ret = false;
+    int fdA = -1;
+    int fdB = -1;
+    {
+        JSON_ref jsonData;
+        int siz = json_createFromString("{}", &jsonData);
+        ASSERT(siz > 0);
+        ret = emulator_stateExtractDiskPaths(fdState, jsonData);
+        ASSERT(ret);
+        _get_fds(jsonData, &fdA, &fdB);
+        json_destroy(&jsonData);
+    }
+
+    ret = emulator_loadState(fdState, fdA, fdB);
+    ASSERT(ret);
+
+    TEMP_FAILURE_RETRY(close(fdA));
+    TEMP_FAILURE_RETRY(close(fdB));
+
+    PASS();
+}
+
+TEST test_save_state_delta() {
+    test_setup_boot_disk(BLANK_DSK, 1);
+
+    BOOT_TO_DOS();
+
+    char *savData = NULL;
+    ASPRINTF(&savData, "%s/emulator-test-delta.a2state", HOMEDIR);
+
+    int fd = -1;
+    TEMP_FAILURE_RETRY(fd = open(savData, O_RDWR|O_CREAT|O_TRUNC, S_IRUSR|S_IWUSR));
+    ASSERT(fd > 0);
+
+    struct stat stat_buf;
+
+    // first save is a key frame
+    apple_ii_64k[0][0x300] = 0x11;
+    ASSERT(emulator_saveStateDelta(fd));
+    ASSERT(fstat(fd, &stat_buf) == 0);
+    off_t keySiz = stat_buf.st_size;
+
+    // subsequent saves append only changed chunks
+    apple_ii_64k[0][0x300] = 0x22;
+    ASSERT(emulator_saveStateDelta(fd));
+    ASSERT(fstat(fd, &stat_buf) == 0);
+    off_t delta1Siz = stat_buf.st_size;
+    ASSERT(delta1Siz - keySiz < keySiz/4);
+
+    apple_ii_64k[0][0x300] = 0x33;
+    ASSERT(emulator_saveStateDelta(fd));
+    ASSERT(fstat(fd, &stat_buf) == 0);
+    off_t delta2Siz = stat_buf.st_size;
+    ASSERT(delta2Siz - delta1Siz < keySiz/4);
+
+    // latest frame is loaded
+    apple_ii_64k[0][0x300] = 0x00;
+    ASSERT(_load_state_fd(fd) == 0);
+    ASSERT(apple_ii_64k[0][0x300] == 0x33);
+
+    // torn trailing frame (interrupted autosave) falls back to the previous frame
+    ASSERT(ftruncate(fd, delta2Siz - 7) == 0);
+    ASSERT(_load_state_fd(fd) == 0);
+    ASSERT(apple_ii_64k[0][0x300] == 0x22);
+
+    // a full save over the file starts over with a key frame
+    ASSERT(lseek(fd, 0, SEEK_SET) == 0);
+    ASSERT(ftruncate(fd, 0) == 0);
+    ASSERT(emulator_saveState(fd));
+    ASSERT(fstat(fd, &stat_buf) == 0);
+    ASSERT(stat_buf.st_size < keySiz + 64 && stat_buf.st_size > keySiz - 64);
+
+    TEMP_FAILURE_RETRY(close(fd));
+
+    unlink(savData);
+    FREE(savData);
+
+    PASS();
+}
+
+TEST test_rewind() {
+    test_setup_boot_disk(BLANK_DSK, 1);
+
+    BOOT_TO_DOS();
+
+    emulator_rewindConfigure(/*intervalFrames:*/1, /*budget:*/4*1024*1024);
+
+    apple_ii_64k[0][0x300] = 0x11;
+    debugger_setTimeout(1);
+    debugger_clearWatchpoints();
+    debugger_go();
+    debugger_setTimeout(0);
+
+    // newest snapshot predates this change
+    apple_ii_64k[0][0x300] = 0x22;
+    ASSERT(emulator_rewind(0));
+    ASSERT(apple_ii_64k[0][0x300] == 0x11);
+
+    // rewinding past the oldest snapshot restores the oldest one
+    ASSERT(emulator_rewind(60));
+    ASSERT(apple_ii_64k[0][0x300] == 0x11);
+    ASSERT(emulator_rewindAvailable() == 0);
+
+    emulator_rewindConfigure(/*intervalFrames:*/1, /*budget:*/0);
+    ASSERT(!emulator_rewind(0));
+
+    PASS();
+}
+
+TEST test_rewind_machine_state() {
+    test_setup_boot_disk(BLANK_DSK, 1);
+
+    BOOT_TO_DOS();
+
+    emulator_rewindConfigure(/*intervalFrames:*/1, /*budget:*/4*1024*1024);
+
+    debugger_setTimeout(1);
+    debugger_clearWatchpoints();
+    debugger_go();
+    debugger_setTimeout(0);
+
+    char *savA = NULL;
+    char *savB = NULL;
+    ASPRINTF(&savA, "%s/emulator-test-rewind-A.a2state", HOMEDIR);
+    ASPRINTF(&savB, "%s/emulator-test-rewind-B.a2state", HOMEDIR);
+
+    int fdA = -1;
+    int fdB = -1;
+    TEMP_FAILURE_RETRY(fdA = open(savA, O_RDWR|O_CREAT|O_TRUNC, S_IRUSR|S_IWUSR));
+    ASSERT(fdA > 0);
+    TEMP_FAILURE_RETRY(fdB = open(savB, O_RDWR|O_CREAT|O_TRUNC, S_IRUSR|S_IWUSR));
+    ASSERT(fdB > 0);
+
+    // machine state as of the newest snapshot
+    ASSERT(emulator_rewind(0));
+    ASSERT(emulator_saveState(fdA));
+
+    // scribble over memory, registers and softswitches, then rewind to the same snapshot
+    apple_ii_64k[0][0x300] ^= 0xFF;
+    apple_ii_64k[1][0x2000] ^= 0xFF;
+    language_card[0][0x100] ^= 0xFF;
+    run_args.cpu65_pc += 3;
+    run_args.cpu65_a ^= 0xFF;
+    run_args.cpu65_x ^= 0xFF;
+    run_args.cpu65_sp -= 2;
+    run_args.softswitches ^= SS_TEXT;
+    ASSERT(emulator_rewind(0));
+    ASSERT(emulator_saveState(fdB));
+
+    struct stat statA;
+    struct stat statB;
+    ASSERT(fstat(fdA, &statA) == 0);
+    ASSERT(fstat(fdB, &statB) == 0);
+    ASSERT(statA.st_size == statB.st_size);
+
+    uint8_t *bufA = MALLOC(statA.st_size);
+    uint8_t *bufB = MALLOC(statB.st_size);
+    ASSERT(pread(fdA, bufA, statA.st_size, 0) == statA.st_size);
+    ASSERT(pread(fdB, bufB, statB.st_size, 0) == statB.st_size);
+    ASSERT(memcmp(bufA, bufB, statA.st_size) == 0);
+    FREE(bufA);
+    FREE(bufB);
+
+    TEMP_FAILURE_RETRY(close(fdA));
+    TEMP_FAILURE_RETRY(close(fdB));
+    unlink(savA);
+    unlink(savB);
+    FREE(savA);
+    FREE(savB);
+
+    emulator_rewindConfigure(/*intervalFrames:*/1, /*budget:*/0);
+
+    PASS();
+}
+
 TEST test_load_A2VM_good1() {
 
     // ensure stable test
@@ -271,7 +449,7 @@ TEST test_load_A2VM_good1() {
     //ASSERT(disk6.disk[0].nib_image_data != NULL);
     //ASSERT(disk6.disk[0].track_width == BLANK_TRACK_WIDTH);
     ASSERT(!disk6.disk[0].nibblized);
-    ASSERT(!disk6.disk[0].track_dirty);
+    ASSERT(!disk6.disk[0].tracks_dirty);
     //extern int skew_table_6_do[16];
     //ASSERT(disk6.disk[0].skew_table == skew_table_6_do);
 
@@ -385,7 +563,7 @@ TEST test_load_A2V2_good1() {
     //ASSERT(disk6.disk[0].nib_image_data != NULL);
     //ASSERT(disk6.disk[0].track_width == BLANK_TRACK_WIDTH);
     ASSERT(!disk6.disk[0].nibblized);
-    ASSERT(!disk6.disk[0].track_dirty);
+    ASSERT(!disk6.disk[0].tracks_dirty);
     //extern int skew_table_6_do[16];
     //ASSERT(disk6.disk[0].skew_table == skew_table_6_do);
 
@@ -511,7 +689,7 @@ TEST test_load_A2V2_good2() {
     //ASSERT(disk6.disk[0].nib_image_data != NULL);
     //ASSERT(disk6.disk[0].track_width == BLANK_TRACK_WIDTH);
     ASSERT(!disk6.disk[0].nibblized);
-    ASSERT(!disk6.disk[0].track_dirty);
+    ASSERT(!disk6.disk[0].tracks_dirty);
     //extern int skew_table_6_do[16];
     //ASSERT(disk6.disk[0].skew_table == skew_table_6_do);
 
@@ -630,12 +808,12 @@ TEST test_load_A2V2_good3() {
     ASSERT(disk6.disk[0].phase == 6);
     ASSERT(disk6.disk[0].run_byte == 1141);
     ASSERT(!disk6.disk[0].nibblized);
-    ASSERT(!disk6.disk[0].track_dirty);
+    ASSERT(!disk6.disk[0].tracks_dirty);
 
     ASSERT(disk6.disk[1].phase == 50);
     ASSERT(disk6.disk[1].run_byte == 5277);
     ASSERT(!disk6.disk[1].nibblized);
-    ASSERT(!disk6.disk[1].track_dirty);
+    ASSERT(!disk6.disk[1].tracks_dirty);
 
     // VM ...
     ASSERT(run_args.softswitches  == 0x000140f4);
@@ -706,6 +884,9 @@ GREATEST_SUITE(test_suite_ui) {
 
     RUN_TESTp(test_save_state_1);
     RUN_TESTp(test_load_state_1);
+    RUN_TESTp(test_save_state_delta);
+    RUN_TESTp(test_rewind);
+    RUN_TESTp(test_rewind_machine_state);
 
     RUN_TESTp(test_load_A2VM_good1);
 
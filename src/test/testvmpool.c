@@ -0,0 +1,156 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+//
+// Tests for pooled headless emulator instances (VM_MULTI_INSTANCE build)
+//
+
+#include "testcommon.h"
+
+#if !VM_MULTI_INSTANCE
+#   error "OOPS, pooled machine tests require a VM_MULTI_INSTANCE build"
+#endif
+
+#define POOL_COUNT 2
+
+#define PROG_ADDR  0x0300
+#define PROG_VALUE 0x0310
+#define PROG_COUNT 0x0311
+
+typedef struct pool_probe_s {
+    uint8_t main[POOL_COUNT];
+    uint8_t aux[POOL_COUNT];
+    uint8_t lc[POOL_COUNT];
+    uint8_t rd[POOL_COUNT];
+    uint8_t tag[POOL_COUNT];
+    uint8_t count[POOL_COUNT];
+    uint16_t pc[POOL_COUNT];
+} pool_probe_s;
+
+static void testvmpool_setup(void *unused) {
+}
+
+static void testvmpool_teardown(void *unused) {
+}
+
+static void _pool_clear(unsigned int instance, void *ctx) {
+    apple_ii_64k[0][0x2000] = 0x00;
+    apple_ii_64k[1][0x2000] = 0x00;
+    language_card[0][0x0100] = 0x00;
+}
+
+static void _pool_scribble(unsigned int instance, void *ctx) {
+    if (instance != 0) {
+        return;
+    }
+    apple_ii_64k[0][0x2000] = 0xA5;
+    apple_ii_64k[1][0x2000] = 0x5A;
+    language_card[0][0x0100] = 0xC3;
+    vm_writeByte(0x2001, 0x3C);
+}
+
+static void _pool_probe(unsigned int instance, void *ctx) {
+    pool_probe_s *probe = (pool_probe_s *)ctx;
+    probe->main[instance] = apple_ii_64k[0][0x2000];
+    probe->aux[instance] = apple_ii_64k[1][0x2000];
+    probe->lc[instance] = language_card[0][0x0100];
+    probe->rd[instance] = vm_readByte(0x2001);
+    probe->tag[instance] = apple_ii_64k[0][PROG_VALUE];
+    probe->count[instance] = apple_ii_64k[0][PROG_COUNT];
+    probe->pc[instance] = run_args.cpu65_pc;
+}
+
+// Each instance loops storing its own tag and bumping a counter
+static void _pool_loadProgram(unsigned int instance, void *ctx) {
+    const uint8_t prog[] = {
+        0xA9, 0x40+instance,    // LDA #tag
+        0x8D, 0x10, 0x03,       // STA $0310
+        0xEE, 0x11, 0x03,       // INC $0311
+        0x4C, 0x00, 0x03,       // JMP $0300
+    };
+    memcpy(&apple_ii_64k[0][PROG_ADDR], prog, sizeof(prog));
+    apple_ii_64k[0][PROG_VALUE] = 0x00;
+    apple_ii_64k[0][PROG_COUNT] = 0x00;
+    run_args.cpu65_pc = PROG_ADDR;
+}
+
+// ----------------------------------------------------------------------------
+// VM pool TESTS ...
+
+TEST test_pool_memory_isolation() {
+    vmpool_s *pool = vmpool_create(POOL_COUNT, &_pool_clear, NULL);
+    ASSERT(pool);
+    ASSERT(vmpool_count(pool) == POOL_COUNT);
+
+    vmpool_dispatch(pool, &_pool_scribble, NULL);
+
+    pool_probe_s probe = { { 0 } };
+    vmpool_dispatch(pool, &_pool_probe, &probe);
+
+    // writes to the first machine ...
+    ASSERT(probe.main[0] == 0xA5);
+    ASSERT(probe.aux[0] == 0x5A);
+    ASSERT(probe.lc[0] == 0xC3);
+    ASSERT(probe.rd[0] == 0x3C);
+
+    // ... do not appear in the second
+    ASSERT(probe.main[1] == 0x00);
+    ASSERT(probe.aux[1] == 0x00);
+    ASSERT(probe.lc[1] == 0x00);
+    ASSERT(probe.rd[1] != 0x3C);
+
+    vmpool_destroy(&pool);
+    ASSERT(pool == NULL);
+
+    PASS();
+}
+
+TEST test_pool_cpu_isolation() {
+    vmpool_s *pool = vmpool_create(POOL_COUNT, &_pool_loadProgram, NULL);
+    ASSERT(pool);
+
+    unsigned long cycles = vmpool_runCycles(pool, 10000);
+    ASSERT(cycles >= POOL_COUNT * 10000);
+
+    pool_probe_s probe = { { 0 } };
+    vmpool_dispatch(pool, &_pool_probe, &probe);
+
+    // each machine ran its own program
+    for (unsigned int i=0; i<POOL_COUNT; i++) {
+        ASSERT(probe.pc[i] >= PROG_ADDR && probe.pc[i] < PROG_ADDR+11);
+        ASSERT(probe.tag[i] == 0x40+i);
+        ASSERT(probe.count[i] != 0x00);
+    }
+
+    vmpool_destroy(&pool);
+
+    PASS();
+}
+
+// ----------------------------------------------------------------------------
+// Test Suite
+
+GREATEST_SUITE(test_suite_vmpool) {
+    GREATEST_SET_SETUP_CB(testvmpool_setup, NULL);
+    GREATEST_SET_TEARDOWN_CB(testvmpool_teardown, NULL);
+
+    RUN_TEST(test_pool_memory_isolation);
+    RUN_TEST(test_pool_cpu_isolation);
+}
+
+SUITE(test_suite_vmpool);
+GREATEST_MAIN_DEFS();
+
+int test_vmpool(int argc, char **argv) {
+    GREATEST_MAIN_BEGIN();
+    RUN_SUITE(test_suite_vmpool);
+    GREATEST_MAIN_END();
+}
@@ -21,11 +21,11 @@
 #define DISK_MOTOR_QUIET_NSECS (NANOSECONDS_PER_SECOND>2)
 
 // cycle counting
-double cycles_persec_target = CLK_6502;
-unsigned long cycles_count_total = 0;           // Running at spec ~1MHz, this will approach overflow in ~4000secs (for 32bit architectures)
-unsigned int cycles_video_frame = 0;
-int cycles_speaker_feedback = 0;
-static int32_t cycles_checkpoint_count = 0;
+VM_LOCAL double cycles_persec_target = CLK_6502;
+VM_LOCAL unsigned long cycles_count_total = 0;           // Running at spec ~1MHz, this will approach overflow in ~4000secs (for 32bit architectures)
+VM_LOCAL unsigned int cycles_video_frame = 0;
+VM_LOCAL int cycles_speaker_feedback = 0;
+static VM_LOCAL int32_t cycles_checkpoint_count = 0;
 
 // scaling and speed adjustments
 static bool auto_adjust_speed = true;
@@ -43,7 +43,9 @@ static bool emul_pause_audio = false;
 static bool emul_resume_audio = false;
 static bool emul_video_dirty = false;
 static bool cpu_shutting_down = false;
-pthread_t cpu_thread_id = 0;
+static VM_LOCAL bool is_headless = false;
+static VM_LOCAL bool is_headless_running = false;
+VM_LOCAL pthread_t cpu_thread_id = 0;
 pthread_mutex_t interface_mutex = PTHREAD_MUTEX_INITIALIZER;
 pthread_cond_t dbg_thread_cond = PTHREAD_COND_INITIALIZER;
 pthread_cond_t cpu_thread_cond = PTHREAD_COND_INITIALIZER;
@@ -97,6 +99,190 @@ struct timespec timespec_add(struct timespec start, unsigned long nsecs) {
     return start;
 }
 
+// -----------------------------------------------------------------------------
+// Peripheral event scheduler : binary min-heap of pending events ordered by deadline
+
+typedef struct timing_event_s {
+    unsigned long deadline;
+    timing_event_fn fn;
+} timing_event_s;
+
+static VM_LOCAL timing_event_s events[NUM_TIMING_EVENTS] = { { 0 } };
+static VM_LOCAL uint8_t event_heap[NUM_TIMING_EVENTS] = { 0 };  // pending event ids, earliest deadline first
+static VM_LOCAL uint8_t event_pos[NUM_TIMING_EVENTS] = { 0 };   // heap index + 1 of each event (0 : not pending)
+static VM_LOCAL unsigned int event_count = 0;
+
+static inline bool _event_before(uint8_t a, uint8_t b) {
+    return (long)(events[a].deadline - events[b].deadline) < 0; // wraparound-safe
+}
+
+static inline void _event_place(uint8_t event, unsigned int idx) {
+    event_heap[idx] = event;
+    event_pos[event] = (uint8_t)(idx+1);
+}
+
+static void _event_siftUp(unsigned int idx) {
+    uint8_t event = event_heap[idx];
+    while (idx > 0) {
+        unsigned int parent = (idx-1) >> 1;
+        if (!_event_before(event, event_heap[parent])) {
+            break;
+        }
+        _event_place(event_heap[parent], idx);
+        idx = parent;
+    }
+    _event_place(event, idx);
+}
+
+static void _event_siftDown(unsigned int idx) {
+    uint8_t event = event_heap[idx];
+    do {
+        unsigned int child = (idx<<1) + 1;
+        if (child >= event_count) {
+            break;
+        }
+        if (child+1 < event_count && _event_before(event_heap[child+1], event_heap[child])) {
+            ++child;
+        }
+        if (!_event_before(event_heap[child], event)) {
+            break;
+        }
+        _event_place(event_heap[child], idx);
+        idx = child;
+    } while (1);
+    _event_place(event, idx);
+}
+
+static void _event_remove(uint8_t event) {
+    unsigned int idx = event_pos[event] - 1;
+    event_pos[event] = 0;
+    --event_count;
+    if (idx == event_count) {
+        return;
+    }
+    event_heap[idx] = event_heap[event_count];
+    event_pos[event_heap[idx]] = (uint8_t)(idx+1);
+    _event_siftUp(idx);
+    _event_siftDown(event_pos[event_heap[idx]] - 1);
+}
+
+// cycles_count_total including the (not yet checkpointed) cycles of the current run
+static inline unsigned long _timing_currentCycles(void) {
+    return cycles_count_total + (unsigned long)(run_args.cpu65_cycle_count - cycles_checkpoint_count);
+}
+
+void timing_scheduleEvent(timing_event_t event, unsigned long deadline, timing_event_fn fn) {
+#if !TESTING
+    assert(cpu_isPaused() || (pthread_self() == cpu_thread_id));
+#endif
+    assert(event < NUM_TIMING_EVENTS);
+
+    events[event].deadline = deadline;
+    events[event].fn = fn;
+    if (event_pos[event]) {
+        unsigned int idx = event_pos[event] - 1;
+        _event_siftUp(idx);
+        _event_siftDown(event_pos[event] - 1);
+    } else {
+        _event_place(event, event_count++);
+        _event_siftUp(event_count - 1);
+    }
+
+    if (event_heap[0] == event) {
+        // end the current run at the new earliest deadline
+        long until = (long)(deadline - _timing_currentCycles());
+        if (until < run_args.cpu65_cycles_to_execute) {
+            run_args.cpu65_cycles_to_execute = (until > 0) ? (int32_t)until : 1;
+        }
+    }
+}
+
+void timing_cancelEvent(timing_event_t event) {
+#if !TESTING
+    assert(cpu_isPaused() || (pthread_self() == cpu_thread_id));
+#endif
+    assert(event < NUM_TIMING_EVENTS);
+    if (event_pos[event]) {
+        _event_remove(event);
+    }
+}
+
+static void _timing_resetEvents(void) {
+    memset(event_pos, 0x0, sizeof(event_pos));
+    event_count = 0;
+}
+
+static void _timing_dispatchEvents(void) {
+    if (!event_count) {
+        return;
+    }
+    timing_checkpointCycles();
+    while (event_count) {
+        uint8_t event = event_heap[0];
+        if ((long)(events[event].deadline - cycles_count_total) > 0) {
+            break;
+        }
+        _event_remove(event);
+        events[event].fn();
+    }
+}
+
+// Cycles until the earliest pending deadline (at least 1), or the given limit if that comes first
+static int32_t _timing_cyclesUntilNextEvent(int32_t limit) {
+    if (event_count) {
+        long until = (long)(events[event_heap[0]].deadline - _timing_currentCycles());
+        if (until < limit) {
+            return (until > 0) ? (int32_t)until : 1;
+        }
+    }
+    return limit;
+}
+
+// Cycles until the deadline of the given event (at least 1), or the given limit if that comes first or it is not pending
+static int32_t _timing_cyclesUntilEvent(timing_event_t event, int32_t limit) {
+    if (event_pos[event]) {
+        long until = (long)(events[event].deadline - _timing_currentCycles());
+        if (until < limit) {
+            return (until > 0) ? (int32_t)until : 1;
+        }
+    }
+    return limit;
+}
+
+#if !TESTING
+static
+#endif
+void reinitialize(void);
+
+// Execute run_args.cpu65_cycles_to_execute cycles, ending each cpu65_run() at the next device deadline.  The cycle
+// count of the whole pass accumulates in run_args.cpu65_cycle_count
+static void _timing_runCPU(void) {
+    const int32_t budget = run_args.cpu65_cycles_to_execute;
+
+    if (UNLIKELY(replay_isStarting())) {
+        // record/replay sessions begin with a cold boot, taken by the caller like an Open-Apple reset
+        run_args.emul_reinitialize = 1;
+        return;
+    }
+
+    run_args.cpu65_cycle_count = 0;
+    cycles_checkpoint_count = 0;
+
+    do {
+        replay_drainInput();
+
+        run_args.cpu65_cycles_to_execute = _timing_cyclesUntilNextEvent(budget - run_args.cpu65_cycle_count);
+
+        cpu65_run(&run_args);
+
+        _timing_dispatchEvents();
+
+        if (UNLIKELY(run_args.emul_reinitialize || run_args.cpu65_halted)) {
+            break;
+        }
+    } while (run_args.cpu65_cycle_count < budget);
+}
+
 static void _timing_initialize(double scale) {
     is_fullspeed = (scale > CPU_SCALE_FASTEST_PIVOT);
     if (!is_fullspeed) {
@@ -114,8 +300,10 @@ void reinitialize(void) {
     ASSERT_ON_CPU_THREAD();
 #endif
 
+    const unsigned long previous_cycles = cycles_count_total;
     cycles_count_total = 0;
     cycles_video_frame = 0;
+    _timing_resetEvents();
 #if !TEST_CPU
     video_scannerReset();
 #endif
@@ -127,6 +315,8 @@ void reinitialize(void) {
     }
 #endif
 
+    replay_reinitialize(previous_cycles);
+
     vm_initialize();
 
     cpu65_init();
@@ -140,6 +330,10 @@ void timing_initialize(void) {
 #if !TESTING
     assert(cpu_isPaused() || (pthread_self() == cpu_thread_id));
 #endif
+    if (is_headless || replay_isPlaying()) {
+        _timing_initialize(CPU_SCALE_FASTEST);
+        return;
+    }
     _timing_initialize(alt_speed_enabled ? cpu_altscale_factor : cpu_scale_factor);
 }
 
@@ -150,6 +344,10 @@ void timing_toggleCPUSpeed(void) {
 }
 
 static void timing_reinitializeAudio(void) {
+    if (is_headless) {
+        return; // no audio output in headless mode
+    }
+
     ASSERT_NOT_ON_CPU_THREAD();
 
     SPIN_LOCK_FULL(&_pause_spinLock);
@@ -205,7 +403,8 @@ void cpu_resume(void) {
 }
 
 bool cpu_isPaused(void) {
-    return is_paused;
+    // in headless mode the CPU only runs within the timing_headlessRun*() calls
+    return is_paused || (is_headless && !is_headless_running);
 }
 
 #if TESTING
@@ -216,7 +415,7 @@ void timing_setVideoDirty(void) {
 
 bool timing_shouldAutoAdjustSpeed(void) {
     double speed = alt_speed_enabled ? cpu_altscale_factor : cpu_scale_factor;
-    return auto_adjust_speed && (speed <= CPU_SCALE_FASTEST_PIVOT);
+    return auto_adjust_speed && (speed <= CPU_SCALE_FASTEST_PIVOT) && !replay_isPlaying();
 }
 
 static void *cpu_thread(void *dummyptr) {
@@ -316,6 +515,10 @@ cpu_runloop:
                 if (!is_fullspeed) {
                     // Speaker backend (real-time soundcard) actually drives us!
                     run_args.cpu65_cycles_to_execute += cycles_speaker_feedback;
+                } else {
+                    // nothing paces full speed, so run up to the end-of-frame deadline, servicing any earlier device
+                    // deadlines within the pass
+                    run_args.cpu65_cycles_to_execute = _timing_cyclesUntilEvent(TIMING_EVENT_VIDEO_FRAME, CYCLES_FRAME);
                 }
                 if (UNLIKELY(run_args.cpu65_cycles_to_execute <= 0)) {
                     run_args.cpu65_cycles_to_execute = 0;
@@ -335,13 +538,12 @@ cpu_runloop:
 
             do {
                 if (UNLIKELY(is_debugging)) {
-                    run_args.cpu65_cycles_to_execute = 1;
+                    // with the debugger halt map armed the CPU core itself stops on breakpoints/watchpoints, otherwise
+                    // single-step so that debugger_shouldBreak() sees every instruction
+                    run_args.cpu65_cycles_to_execute = run_args.cpu65_haltmap ? MAX(debugging_cycles, 1) : 1;
                 }
 
-                run_args.cpu65_cycle_count = 0;
-                cycles_checkpoint_count = 0;
-
-                cpu65_run(&run_args); // run emulation for cpu65_cycles_to_execute cycles ...
+                _timing_runCPU(); // run emulation for cpu65_cycles_to_execute cycles ...
 
 #if DEBUG_TIMING
                 dbg_cycles_executed += run_args.cpu65_cycle_count;
@@ -351,7 +553,15 @@ cpu_runloop:
                     debugging_cycles -= run_args.cpu65_cycle_count;
                     timing_checkpointCycles();
 
-                    if (debugger_shouldBreak() || (debugging_cycles <= 0)) {
+                    bool should_break = false;
+                    if (run_args.cpu65_haltmap) {
+                        should_break = run_args.cpu65_halted && debugger_shouldBreak();
+                        run_args.cpu65_halted = 0;
+                    } else {
+                        should_break = debugger_shouldBreak();
+                    }
+
+                    if (should_break || (debugging_cycles <= 0)) {
                         int err = 0;
                         if ((err = pthread_cond_signal(&dbg_thread_cond))) {
                             LOG("pthread_cond_signal : %d", err);
@@ -380,6 +590,8 @@ cpu_runloop:
             video_scannerUpdate();
             TRACE_CPU_END();
 
+            emulator_rewindCheckpoint();
+
             clock_gettime(CLOCK_MONOTONIC, &tj);
             pthread_mutex_unlock(&interface_mutex);
             // -UNLOCK--------------------------------------------------------------------------------------- SAMPLE tj
@@ -488,6 +700,8 @@ cpu_runloop:
         }
     } while (1);
 
+    replay_end();
+
     speaker_destroy();
     MB_Destroy();
     audio_shutdown();
@@ -506,6 +720,9 @@ bool timing_isCPUThread(void) {
 }
 
 void timing_startCPU(void) {
+#if VM_MULTI_INSTANCE
+    assert(false && "VM_MULTI_INSTANCE builds are headless-only, use timing_headlessBegin() or vmpool_create()");
+#endif
     cpu_shutting_down = false;
     assert(cpu_thread_id == 0);
     int err = TEMP_FAILURE_RETRY(pthread_create(&cpu_thread_id, NULL, (void *)&cpu_thread, (void *)NULL));
@@ -513,6 +730,11 @@ void timing_startCPU(void) {
 }
 
 void timing_stopCPU(void) {
+    if (is_headless) {
+        timing_headlessEnd();
+        return;
+    }
+
     cpu_shutting_down = true;
 
     LOG("Emulator waiting for CPU thread clean up...");
@@ -543,6 +765,176 @@ void timing_checkpointCycles(void) {
     cycles_checkpoint_count = run_args.cpu65_cycle_count;
 }
 
+// ----------------------------------------------------------------------------
+// Headless batch-run mode
+
+void timing_headlessBegin(void) {
+    assert(cpu_thread_id == 0 && "headless mode cannot be used with the CPU thread");
+
+    cpu_thread_id = pthread_self();
+    is_headless = true;
+    LOG("timing : begin headless mode ...");
+
+    video_chooseBackend(NULL);
+    audio_chooseBackend(NULL);
+
+    audio_init();
+    speaker_init();
+    MB_Initialize();
+
+    reinitialize();
+#if TEST_CPU
+    // reinitialize() leaves the scanner alone for the CPU tests, but headless runs advance it
+    video_scannerReset();
+#endif
+    run_args.emul_reinitialize = 0;
+}
+
+void timing_headlessEnd(void) {
+    ASSERT_ON_CPU_THREAD();
+    LOG("timing : end headless mode ...");
+
+    replay_end();
+
+    speaker_destroy();
+    MB_Destroy();
+    audio_shutdown();
+
+    disk6_eject(0);
+    disk6_eject(1);
+
+    // hand back a machine at the start of a frame, a later reinitialize() may not reset the scanner (TEST_CPU)
+    cycles_video_frame = 0;
+    _timing_resetEvents();
+    video_scannerReset();
+
+    is_headless = false;
+    cpu_thread_id = 0;
+}
+
+bool timing_isHeadless(void) {
+    return is_headless;
+}
+
+// Executes at most one quantum (clamped to the next video frame boundary) and performs bookkeeping.  Returns the count
+// of cycles executed, which may overshoot the requested count by the length of the last instruction.
+static unsigned long _headless_runQuantum(unsigned long cycles) {
+    assert(cycles_video_frame < CYCLES_FRAME);
+    unsigned long frame_remaining = CYCLES_FRAME - cycles_video_frame;
+    if (cycles > frame_remaining) {
+        cycles = frame_remaining;
+    }
+
+    run_args.cpu65_cycles_to_execute = (int32_t)cycles;
+    run_args.cpu65_cycle_count = 0;
+    cycles_checkpoint_count = 0;
+
+    is_headless_running = true;
+    MB_StartOfCpuExecute();
+    _timing_runCPU();
+    MB_UpdateCycles();
+    is_headless_running = false;
+
+    video_scannerUpdate(); // checkpoints cycles and handles end-of-frame
+    emulator_rewindCheckpoint();
+
+    unsigned long executed = (unsigned long)run_args.cpu65_cycle_count;
+
+    if (UNLIKELY(run_args.emul_reinitialize)) {
+        reinitialize(); // cpu65_run() then takes the reset vector and clears the flag
+    }
+
+    return executed;
+}
+
+unsigned long timing_headlessRunCycles(unsigned long cycles) {
+    ASSERT_ON_CPU_THREAD();
+    assert(is_headless);
+
+    unsigned long executed = 0;
+    while (executed < cycles) {
+        executed += _headless_runQuantum(cycles - executed);
+    }
+
+    return executed;
+}
+
+#if CPU65_HALTMAP_INLINE
+// exec halt map armed by timing_headlessRunUntilPC()
+static VM_LOCAL uint8_t headless_haltmap[HALTMAP_SIZ] = { 0 };
+#endif
+
+bool timing_headlessRunUntilPC(uint16_t pc, unsigned long maxCycles) {
+    ASSERT_ON_CPU_THREAD();
+    assert(is_headless);
+
+    unsigned long executed = 0;
+
+#if CPU65_HALTMAP_INLINE
+    // run whole quanta, the core halts as soon as the next PC is the target
+    uint8_t *haltmap = run_args.cpu65_haltmap;
+    headless_haltmap[HALTMAP_EXEC + (pc>>3)] |= (1 << (pc & 0x7));
+    run_args.cpu65_haltmap = headless_haltmap;
+    run_args.cpu65_halted = 0;
+
+    while (run_args.cpu65_pc != pc && executed < maxCycles) {
+        executed += _headless_runQuantum(maxCycles - executed);
+        run_args.cpu65_halted = 0;
+    }
+
+    headless_haltmap[HALTMAP_EXEC + (pc>>3)] &= ~(1 << (pc & 0x7));
+    run_args.cpu65_haltmap = haltmap;
+
+    return run_args.cpu65_pc == pc;
+#else
+    // core does not check the halt map, single instruction steps but only advance the scanner when a frame boundary
+    // is crossed
+    while (run_args.cpu65_pc != pc) {
+        if (executed >= maxCycles) {
+            return false;
+        }
+        run_args.cpu65_cycles_to_execute = 1;
+
+        is_headless_running = true;
+        MB_StartOfCpuExecute();
+        _timing_runCPU();
+        MB_UpdateCycles();
+        is_headless_running = false;
+
+        timing_checkpointCycles();
+        executed += (unsigned long)run_args.cpu65_cycle_count;
+
+        if (cycles_video_frame >= CYCLES_FRAME) {
+            video_scannerUpdate();
+            emulator_rewindCheckpoint();
+        }
+
+        if (UNLIKELY(run_args.emul_reinitialize)) {
+            reinitialize(); // cpu65_run() then takes the reset vector and clears the flag
+        }
+    }
+
+    return true;
+#endif
+}
+
+unsigned long timing_headlessRunFrames(unsigned long frames) {
+    ASSERT_ON_CPU_THREAD();
+    assert(is_headless);
+
+    unsigned long executed = 0;
+    while (frames) {
+        unsigned long frame_remaining = CYCLES_FRAME - cycles_video_frame;
+        unsigned long cycles = _headless_runQuantum(frame_remaining);
+        executed += cycles;
+        if (cycles >= frame_remaining) {
+            --frames;
+        }
+    }
+
+    return executed;
+}
+
 // ----------------------------------------------------------------------------
 
 bool timing_saveState(StateHelper_s *helper) {
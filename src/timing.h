@@ -63,17 +63,17 @@
 #   define CPU_SCALE_STEP 0.05
 #endif
 
-extern unsigned long cycles_count_total;    // cumulative cycles count from machine reset
-extern unsigned int cycles_video_frame;     // unprocessed video frame cycles count
-extern double cycles_persec_target;         // CLK_6502 * current CPU scale
-extern int cycles_speaker_feedback;         // current -/+ speaker requested feedback
-
-extern double cpu_scale_factor;             // scale factor #1
-extern double cpu_altscale_factor;          // scale factor #2
-extern bool is_fullspeed;                   // emulation in full native speed?
+extern VM_LOCAL unsigned long cycles_count_total;   // cumulative cycles count from machine reset
+extern VM_LOCAL unsigned int cycles_video_frame;    // unprocessed video frame cycles count
+extern VM_LOCAL double cycles_persec_target;        // CLK_6502 * current CPU scale
+extern VM_LOCAL int cycles_speaker_feedback;        // current -/+ speaker requested feedback
+
+extern double cpu_scale_factor;                     // scale factor #1
+extern double cpu_altscale_factor;                  // scale factor #2
+extern bool is_fullspeed;                           // emulation in full native speed?
 extern bool alt_speed_enabled;
 
-extern READONLY pthread_t cpu_thread_id;
+extern VM_LOCAL READONLY pthread_t cpu_thread_id;
 
 /*
  * calculate the difference between two timespec structures
@@ -137,6 +137,76 @@ bool cpu_isPaused(void);
  */
 void timing_checkpointCycles(void) CALL_ON_CPU_THREAD;
 
+// ----------------------------------------------------------------------------
+// Peripheral event scheduler
+//
+// Devices register the cycle (in cycles_count_total time) of their next deadline.  The CPU thread ends each
+// cpu65_run() call at the earliest pending deadline and fires the event callback on that instruction boundary, so
+// device timing doesn't depend on the execution quantum.  Events are one-shot (callbacks reschedule as needed) and are
+// all dropped on machine reset.
+
+typedef enum timing_event_t {
+    TIMING_EVENT_VIDEO_FRAME = 0,   // end of video frame
+    TIMING_EVENT_MB_TIMER,          // Mockingboard 6522 timer 1 underflow
+    TIMING_EVENT_REPLAY,            // next input of a replay log (meta/replay.h)
+    TIMING_EVENT_DISK_MOTOR,        // Disk II motor spin-down
+    NUM_TIMING_EVENTS,
+} timing_event_t;
+
+typedef void (*timing_event_fn)(void);
+
+/*
+ * Schedule (or reschedule) an event to fire once cycles_count_total reaches deadline.  Safe to call from I/O handlers
+ * while cpu65_run() is executing, in which case the current run is cut short as needed.
+ */
+void timing_scheduleEvent(timing_event_t event, unsigned long deadline, timing_event_fn fn) CALL_ON_CPU_THREAD;
+
+/*
+ * Cancel a pending event (no-op if not scheduled)
+ */
+void timing_cancelEvent(timing_event_t event) CALL_ON_CPU_THREAD;
+
+// ----------------------------------------------------------------------------
+// Headless batch-run mode
+//
+// Drives the emulated machine synchronously on the calling thread (which becomes the CPU thread) using the null video
+// and audio backends.  Emulation is not paced to the wall clock : there is no sleeping, no interface_mutex locking, no
+// clock sampling and no audio submission.  cpu65_run() is invoked in quanta that end on video frame boundaries, with
+// peripheral and scanner bookkeeping performed once per quantum.
+//
+// NOTE : headless mode is mutually exclusive with timing_startCPU()
+
+/*
+ * Enter headless mode on the calling thread and reset the machine.  Emulator ctors and prefs should already be loaded.
+ */
+void timing_headlessBegin(void);
+
+/*
+ * Leave headless mode, tearing down audio and ejecting disks.
+ */
+void timing_headlessEnd(void) CALL_ON_CPU_THREAD;
+
+/*
+ * Is the emulator running in headless mode?
+ */
+bool timing_isHeadless(void);
+
+/*
+ * Run for (at least) the specified count of 65c02 cycles.  Returns the count of cycles actually executed.
+ */
+unsigned long timing_headlessRunCycles(unsigned long cycles) CALL_ON_CPU_THREAD;
+
+/*
+ * Run until the program counter reaches pc (checked on instruction boundaries), or until maxCycles have elapsed.
+ * Returns true if pc was reached.
+ */
+bool timing_headlessRunUntilPC(uint16_t pc, unsigned long maxCycles) CALL_ON_CPU_THREAD;
+
+/*
+ * Run until the specified count of video frames have completed.  Returns the count of cycles executed.
+ */
+unsigned long timing_headlessRunFrames(unsigned long frames) CALL_ON_CPU_THREAD;
+
 // ----------------------------------------------------------------------------
 // save/restore state
 
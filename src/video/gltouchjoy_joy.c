@@ -43,14 +43,14 @@ static interface_device_t touchjoy_variant(void) {
 }
 
 static inline void _reset_button_state(void) {
-    run_args.joy_button0 = 0;
-    run_args.joy_button1 = 0;
+    replay_input(REPLAY_INPUT_BUTTON0, 0);
+    replay_input(REPLAY_INPUT_BUTTON1, 0);
     joys.currButtonDisplayChar = ' ';
 }
 
 static inline void _reset_axis_state(void) {
-    joy_x = HALF_JOY_RANGE;
-    joy_y = HALF_JOY_RANGE;
+    replay_input(REPLAY_INPUT_JOY_X, HALF_JOY_RANGE);
+    replay_input(REPLAY_INPUT_JOY_Y, HALF_JOY_RANGE);
 }
 
 static void touchjoy_resetState(void) {
@@ -98,8 +98,8 @@ static void touchjoy_axisMove(int x, int y) {
         y = 0xff;
     }
 
-    joy_x = x;
-    joy_y = y;
+    replay_input(REPLAY_INPUT_JOY_X, x);
+    replay_input(REPLAY_INPUT_JOY_Y, y);
 }
 
 static void touchjoy_axisUp(int x, int y) {
@@ -115,8 +115,8 @@ static void touchjoy_axisUp(int x, int y) {
 
 static void _fire_current_buttons(void) {
     TOUCH_JOY_LOG("\t\t\tfire buttons 0:%02x 1:%02X char:%02x", joys.currJoyButtonValue0, joys.currJoyButtonValue1, joys.currButtonDisplayChar);
-    run_args.joy_button0 = joys.currJoyButtonValue0;
-    run_args.joy_button1 = joys.currJoyButtonValue1;
+    replay_input(REPLAY_INPUT_BUTTON0, joys.currJoyButtonValue0);
+    replay_input(REPLAY_INPUT_BUTTON1, joys.currJoyButtonValue1);
     joys.lastButtonDisplayChar = joys.currButtonDisplayChar;
 }
 
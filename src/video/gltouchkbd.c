@@ -188,14 +188,14 @@ static void touchkbd_frameCallback(uint8_t textFlashCounter) {
         --kbd.button0Count;
     }
     if (!kbd.button0Count) {
-        run_args.joy_button0 = 0x0;
+        replay_input(REPLAY_INPUT_BUTTON0, 0x0);
     }
 
     if (kbd.button1Count) {
         --kbd.button1Count;
     }
     if (!kbd.button1Count) {
-        run_args.joy_button1 = 0x0;
+        replay_input(REPLAY_INPUT_BUTTON1, 0x0);
     }
 
     if (!kbd.button0Count && !kbd.button1Count) {
@@ -372,8 +372,8 @@ static inline int64_t _tap_key_at_point(float x, float y) {
     _rerender_selected(kbd.selectedCol, kbd.selectedRow);
 
     if (!_is_point_on_keyboard(x, y)) {
-        run_args.joy_button0 = 0x0;
-        run_args.joy_button1 = 0x0;
+        replay_input(REPLAY_INPUT_BUTTON0, 0x0);
+        replay_input(REPLAY_INPUT_BUTTON1, 0x0);
         kbd.selectedCol = -1;
         kbd.selectedRow = -1;
         return false;
@@ -462,7 +462,7 @@ static inline int64_t _tap_key_at_point(float x, float y) {
             break;
 
         case MOUSETEXT_OPENAPPLE:
-            run_args.joy_button0 = 0x80;
+            replay_input(REPLAY_INPUT_BUTTON0, 0x80);
             kbd.button0Count = KBD_BUTTON_HOLD_FRAMES;
             kbd.frameCallback = touchkbd_frameCallback;
             break;
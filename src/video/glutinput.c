@@ -180,23 +180,25 @@ static void gldriver_joystick_callback(unsigned int buttonMask, int x, int y, in
 
     // sample buttons only if apple keys aren't pressed. keys get set to 0xff, and js buttons are set to 0x80.
     if (!(run_args.joy_button0 & 0x7f)) {
-        run_args.joy_button0 = (buttonMask & 0x01) ? 0x80 : 0x0;
+        replay_input(REPLAY_INPUT_BUTTON0, (buttonMask & 0x01) ? 0x80 : 0x0);
     }
     if (!(run_args.joy_button1 & 0x7f)) {
-        run_args.joy_button1 = (buttonMask & 0x02) ? 0x80 : 0x0;
+        replay_input(REPLAY_INPUT_BUTTON1, (buttonMask & 0x02) ? 0x80 : 0x0);
     }
 
     // normalize GLUT range
     static const float normalizer = 256.f/2000.f;
 
-    joy_x = (uint16_t)((x+1000)*normalizer);
-    joy_y = (uint16_t)((y+1000)*normalizer);
-    if (joy_x > 0xFF) {
-        joy_x = 0xFF;
+    uint16_t jx = (uint16_t)((x+1000)*normalizer);
+    uint16_t jy = (uint16_t)((y+1000)*normalizer);
+    if (jx > 0xFF) {
+        jx = 0xFF;
     }
-    if (joy_y > 0xFF) {
-        joy_y = 0xFF;
+    if (jy > 0xFF) {
+        jy = 0xFF;
     }
+    replay_input(REPLAY_INPUT_JOY_X, jx);
+    replay_input(REPLAY_INPUT_JOY_Y, jy);
 }
 
 //----------------------------------------------------------------------------
@@ -13,9 +13,6 @@
 
 #include <regex.h>
 
-// HACK NOTE : display.c "fbDone" buffer is the crtModel->texPixels to avoid a memcpy
-#define FB_PIXELS_PASS_THRU 1
-
 static int viewportX = 0;
 static int viewportY = 0;
 static int viewportWidth = SCANWIDTH*1.5;
@@ -158,11 +155,6 @@ static void glvideo_init(void) {
     // ----------------------------
     // Create Cathode Ray Tube (CRT) model ... which currently is just a simple texture quad model ...
 
-#if FB_PIXELS_PASS_THRU
-    if (crtModel) {
-        crtModel->texPixels = NULL;
-    }
-#endif
     mdlDestroyModel(&crtModel);
     glActiveTexture(TEXTURE_ACTIVE_FRAMEBUFFER);
 #warning HACK FIXME TODO ^^^^^^^ is glActiveTexture() call needed here?
@@ -177,10 +169,8 @@ static void glvideo_init(void) {
             .tex_h = SCANHEIGHT,
             .texcoordUsageHint = GL_DYNAMIC_DRAW, // but texture (Apple //e framebuffer) does
         }, (GLCustom){ 0 });
-#if FB_PIXELS_PASS_THRU
+    // NOTE : texture is uploaded directly from the display framebuffers
     FREE(crtModel->texPixels);
-    crtModel->texPixels = display_getCurrentFramebuffer();
-#endif
 
     // ----------------------------
     // Load/setup shaders
@@ -273,11 +263,6 @@ static void glvideo_shutdown(void) {
 
     // Cleanup all OpenGL objects
 
-#if FB_PIXELS_PASS_THRU
-    if (crtModel) {
-        crtModel->texPixels = NULL;
-    }
-#endif
     mdlDestroyModel(&crtModel);
 
     // detach and delete the main shaders
@@ -342,26 +327,48 @@ static void glvideo_render(void) {
     if (!wasDirty) {
         // Framebuffer is not dirty, so stall here to wait for cpu thread to (potentially) complete the video frame ...
         // This seems to improve "stuttering" of Dagen Brock's Flappy Bird
-        SCOPE_TRACE_VIDEO("sleep");
-
-        struct timespec deltat = {
-            .tv_sec = 0,
-            .tv_nsec = NANOSECONDS_PER_SECOND / 240,
-        };
-        nanosleep(&deltat, NULL); // approx 4.714ms
+        SCOPE_TRACE_VIDEO("wait");
+        display_waitForFrame(NANOSECONDS_PER_SECOND / 240); // approx 4.714ms at most
 
         wasDirty = (video_clearDirty(FB_DIRTY_FLAG) & FB_DIRTY_FLAG);
     }
 
     if (wasDirty) {
-        SCOPE_TRACE_VIDEO("glvideo texImage2D");
-        _HACKAROUND_GLTEXIMAGE2D_PRE(TEXTURE_ACTIVE_FRAMEBUFFER, crtModel->textureName);
-        void *fb = display_getCurrentFramebuffer(); // NOTE: has an INTERFACE_CLASSIC side-effect ...
-#if !FB_PIXELS_PASS_THRU
-        memcpy(/*dest:*/crtModel->texPixels, /*src:*/fb, (SCANWIDTH*SCANHEIGHT*sizeof(PIXEL_TYPE)));
-#endif
-        (void)fb;
-        glTexImage2D(GL_TEXTURE_2D, /*level*/0, TEX_FORMAT_INTERNAL, SCANWIDTH, SCANHEIGHT, /*border*/0, TEX_FORMAT, TEX_TYPE, crtModel->texPixels);
+        PIXEL_TYPE *fb = display_getCurrentFramebuffer(); // NOTE: has an INTERFACE_CLASSIC side-effect ...
+
+        // upload only the band of changed framebuffer rows
+        uint32_t dirtyScanlines[DIRTY_SCANLINE_WORDS] = { 0 };
+        display_getDirtyScanlines(dirtyScanlines);
+        int firstRow = -1;
+        int lastRow = -1;
+        for (unsigned int i = 0; i < (SCANHEIGHT>>1); i++) {
+            if (dirtyScanlines[i>>5] & (1U << (i & 0x1F))) {
+                if (firstRow < 0) {
+                    firstRow = (i<<1);
+                }
+                lastRow = (i<<1) + 1;
+            }
+        }
+        if (firstRow < 0 || hackAroundBrokenAdreno205) {
+            // nothing tracked (or texture must be recreated anyway) ... upload everything
+            firstRow = 0;
+            lastRow = SCANHEIGHT-1;
+        }
+        // NTSC plotting overdraws into the extra pixels of neighboring rows
+        firstRow = (firstRow > 0) ? firstRow-1 : 0;
+        lastRow = (lastRow < SCANHEIGHT-1) ? lastRow+1 : SCANHEIGHT-1;
+
+        unsigned int off = firstRow * SCANWIDTH;
+        unsigned int rows = lastRow - firstRow + 1;
+
+        if (rows == SCANHEIGHT) {
+            SCOPE_TRACE_VIDEO("glvideo texImage2D");
+            _HACKAROUND_GLTEXIMAGE2D_PRE(TEXTURE_ACTIVE_FRAMEBUFFER, crtModel->textureName);
+            glTexImage2D(GL_TEXTURE_2D, /*level*/0, TEX_FORMAT_INTERNAL, SCANWIDTH, SCANHEIGHT, /*border*/0, TEX_FORMAT, TEX_TYPE, fb);
+        } else {
+            SCOPE_TRACE_VIDEO("glvideo texSubImage2D");
+            glTexSubImage2D(GL_TEXTURE_2D, /*level*/0, /*xoffset*/0, /*yoffset*/firstRow, SCANWIDTH, rows, TEX_FORMAT, TEX_TYPE, fb + off);
+        }
     }
 
     // Bind our vertex array object
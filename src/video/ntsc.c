@@ -36,18 +36,31 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #include "common.h"
 #include "video/ntsc.h"
 
+#if !USE_RGBA4444 && (defined(__x86_64__) || defined(__i386__))
+#   define NTSC_X86_KERNELS 1
+#   include <immintrin.h>
+#endif
+#if !USE_RGBA4444 && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#   define NTSC_NEON_KERNEL 1
+#   include <arm_neon.h>
+#endif
+
 #define NTSC_NUM_PHASES     4
 #define NTSC_NUM_SEQUENCES  4096
+#define NTSC_SPAN_PIXELS    (_SCANWIDTH + 4) // full scanline + flush pixels
 
-typedef void (*fb_plotter_fn)(color_mode_t, uint16_t, PIXEL_TYPE *);
-typedef PIXEL_TYPE (*fb_scanline_fn)(PIXEL_TYPE color0, PIXEL_TYPE color2);
+// A kernel resolves precomputed (phase, signal) table indices into the scanline row and the half-scanline row below it
+typedef void (*ntsc_kernel_fn)(const PIXEL_TYPE *table, const uint32_t *indices, unsigned int count, bool half, PIXEL_TYPE *fb_ptr);
 
 static uint8_t half_scanlines = 1;
-static fb_plotter_fn pixelPlotter[NUM_COLOROPTS] = { NULL };
-static fb_scanline_fn getHalfColor[NUM_COLOROPTS][2] = { { NULL } };
+static ntsc_kernel_t ntsc_kernel = NTSC_KERNEL_SCALAR;
+static ntsc_kernel_t ntsc_bestKernel = NTSC_KERNEL_SCALAR;
+static ntsc_kernel_fn kernels[NUM_NTSC_KERNELS] = { NULL };
+static const PIXEL_TYPE *pixelTable[NUM_COLOROPTS] = { NULL };
+static unsigned int phaseStride[NUM_COLOROPTS] = { 0 };
 
-static unsigned int ntsc_color_phase = 0;
-unsigned int ntsc_signal_bits = 0;
+static VM_LOCAL unsigned int ntsc_color_phase = 0;
+VM_LOCAL unsigned int ntsc_signal_bits = 0;
 
 static PIXEL_TYPE monoPixelsMonitor [NTSC_NUM_SEQUENCES];
 static PIXEL_TYPE monoPixelsTV      [NTSC_NUM_SEQUENCES];
@@ -56,131 +69,277 @@ static PIXEL_TYPE colorPixelsMonitor[NTSC_NUM_PHASES][NTSC_NUM_SEQUENCES];
 static PIXEL_TYPE colorPixelsTV     [NTSC_NUM_PHASES][NTSC_NUM_SEQUENCES];
 
 // ----------------------------------------------------------------------------
-// TV pixel updates
-
-static PIXEL_TYPE halfScanlineTV(PIXEL_TYPE color0, PIXEL_TYPE color2) {
-#if APPLE2IX
-    (void)color2;
-    PIXEL_TYPE color1 = ((color0 & 0xFEFEFEFE) >> 1) | (0xFF << SHIFT_A);
-    return color1;
-#else
-    // HACK NOTE : original code for sampling color2 from 2 scanlines below requires at least 2.X full CYCLES_FRAME iterations
-    //      - first pass does not pick up potentially changed color2
-    //      - second pass will pick up correct color2
-    //      - this leads to "interesting" artifacts for moving sprites
-#error FIXME TODO ...
-    PIXEL_TYPE color1;
-
-    int r = (color0 >> SHIFT_R) & 0xFF;
-    int g = (color0 >> SHIFT_G) & 0xFF;
-    int b = (color0 >> SHIFT_B) & 0xFF;
-    uint32_t color2_prime = (color2 & 0xFCFCFCFC) >> 2;
-    r -= (color2_prime >> SHIFT_R) & 0xFF; if (r<0) { r=0; }    // clamp to 0 on underflow
-    g -= (color2_prime >> SHIFT_G) & 0xFF; if (g<0) { g=0; }    // clamp to 0 on underflow
-    b -= (color2_prime >> SHIFT_B) & 0xFF; if (b<0) { b=0; }    // clamp to 0 on underflow
-    color1 = (r<<SHIFT_R) | (g<<SHIFT_G) | (b<<SHIFT_B) | (0xFF<<SHIFT_A);
-
-    return color1;
-#endif
-}
+// Half scanline color
+//
+// Both TV and Monitor modes darken the odd scanline by 50% (or double the even scanline).
+//
+// HACK NOTE : original AppleWin code for TV modes samples color2 from 2 scanlines below which requires at least 2.X full
+// CYCLES_FRAME iterations
+//      - first pass does not pick up potentially changed color2
+//      - second pass will pick up correct color2
+//      - this leads to "interesting" artifacts for moving sprites
+
+#define HALF_MASK(half)  ((half) ? 0xFEFEFEFE : 0xFFFFFFFF)
+#define HALF_ALPHA(half) ((half) ? (0xFFU << SHIFT_A) : 0x0)
 
-static PIXEL_TYPE doubleScanlineTV(PIXEL_TYPE color0, PIXEL_TYPE color2) {
-#if APPLE2IX
-    (void)color2;
-    return color0;
-#else
-#error FIXME TODO ...
-    PIXEL_TYPE color1 = ((color0 & 0xFEFEFEFE) >> 1) + ((color2 & 0xFEFEFEFE) >> 1); // 50% Blend
-    return color1 | (0xFF<<SHIFT_A);
-#endif
+// ----------------------------------------------------------------------------
+// Signal history
+//
+// Shift each pixel of signal (LSB first) into the 12-bit history and record the index of its color in the (phase-major)
+// pixel table.  Mono tables are phase-agnostic (zero stride), but the color phase still advances per pixel.
+
+static void _ntsc_signalIndices(color_mode_t mode, const uint16_t *bits14, unsigned int count, unsigned int npixels, uint32_t *indices) {
+    const unsigned int stride = phaseStride[mode];
+    unsigned int signal = ntsc_signal_bits;
+    unsigned int phase = ntsc_color_phase;
+
+    for (unsigned int col = 0; col < count; col++) {
+        unsigned int bits = bits14[col];
+        unsigned int n = (npixels < 14) ? npixels : 14;
+        npixels -= n;
+        for (unsigned int i = 0; i < n; i++) {
+            signal = ((signal << 1) | (bits & 0x1)) & 0xFFF; // 12-bit ?
+            bits >>= 1;
+            *indices++ = (phase * stride) + signal;
+            phase = (phase + 1) & 0x03;
+        }
+    }
+
+    ntsc_signal_bits = signal;
+    ntsc_color_phase = phase;
 }
 
-static void updateFBCommon(color_mode_t mode, uint16_t signal, PIXEL_TYPE *fb_ptr, PIXEL_TYPE *color_table) {
-    PIXEL_TYPE *fb_ptr0 = fb_ptr;
-    PIXEL_TYPE *fb_ptr1 = fb_ptr + (SCANWIDTH<<0);
-    PIXEL_TYPE *fb_ptr2 = fb_ptr + (SCANWIDTH<<1);
+// ----------------------------------------------------------------------------
+// Kernels
+
+static void _ntsc_kernelScalar(const PIXEL_TYPE *table, const uint32_t *indices, unsigned int count, bool half, PIXEL_TYPE *fb_ptr) {
+    PIXEL_TYPE *fb_ptr1 = fb_ptr + SCANWIDTH;
+    const PIXEL_TYPE mask = HALF_MASK(half);
+    const PIXEL_TYPE alpha = HALF_ALPHA(half);
+    const unsigned int shift = half ? 1 : 0;
+
+    for (unsigned int i = 0; i < count; i++) {
+        PIXEL_TYPE color0 = table[indices[i]];
+        fb_ptr[i] = color0;
+        fb_ptr1[i] = ((color0 & mask) >> shift) | alpha;
+    }
+}
 
-    PIXEL_TYPE color0;
-    {
-        ntsc_signal_bits = ((ntsc_signal_bits << 1) | signal) & 0xFFF; // 12-bit ?
-        color0 = color_table[ntsc_signal_bits];
+#if NTSC_X86_KERNELS
+__attribute__((target("sse2")))
+static void _ntsc_kernelSSE2(const PIXEL_TYPE *table, const uint32_t *indices, unsigned int count, bool half, PIXEL_TYPE *fb_ptr) {
+    PIXEL_TYPE *fb_ptr1 = fb_ptr + SCANWIDTH;
+    const __m128i mask = _mm_set1_epi32((int)HALF_MASK(half));
+    const __m128i alpha = _mm_set1_epi32((int)HALF_ALPHA(half));
+    const __m128i shift = _mm_cvtsi32_si128(half ? 1 : 0);
+
+    unsigned int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i color0 = _mm_set_epi32((int)table[indices[i+3]], (int)table[indices[i+2]], (int)table[indices[i+1]], (int)table[indices[i+0]]);
+        __m128i color1 = _mm_or_si128(_mm_srl_epi32(_mm_and_si128(color0, mask), shift), alpha);
+        _mm_storeu_si128((__m128i *)(fb_ptr + i), color0);
+        _mm_storeu_si128((__m128i *)(fb_ptr1 + i), color1);
     }
-    PIXEL_TYPE color2 = *fb_ptr2;
-    PIXEL_TYPE color1 = getHalfColor[mode][half_scanlines](color0, color2);
 
-    *fb_ptr0 = color0;
-    *fb_ptr1 = color1;
+    _ntsc_kernelScalar(table, indices + i, count - i, half, fb_ptr + i);
+}
 
-    ntsc_color_phase = (ntsc_color_phase + 1) & 0x03;
+__attribute__((target("avx2")))
+static void _ntsc_kernelAVX2(const PIXEL_TYPE *table, const uint32_t *indices, unsigned int count, bool half, PIXEL_TYPE *fb_ptr) {
+    PIXEL_TYPE *fb_ptr1 = fb_ptr + SCANWIDTH;
+    const __m256i mask = _mm256_set1_epi32((int)HALF_MASK(half));
+    const __m256i alpha = _mm256_set1_epi32((int)HALF_ALPHA(half));
+    const __m128i shift = _mm_cvtsi32_si128(half ? 1 : 0);
+
+    unsigned int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i idx = _mm256_loadu_si256((const __m256i *)(indices + i));
+        __m256i color0 = _mm256_i32gather_epi32((const int *)table, idx, sizeof(PIXEL_TYPE));
+        __m256i color1 = _mm256_or_si256(_mm256_srl_epi32(_mm256_and_si256(color0, mask), shift), alpha);
+        _mm256_storeu_si256((__m256i *)(fb_ptr + i), color0);
+        _mm256_storeu_si256((__m256i *)(fb_ptr1 + i), color1);
+    }
+
+    _ntsc_kernelScalar(table, indices + i, count - i, half, fb_ptr + i);
 }
+#endif
+
+#if NTSC_NEON_KERNEL
+static void _ntsc_kernelNEON(const PIXEL_TYPE *table, const uint32_t *indices, unsigned int count, bool half, PIXEL_TYPE *fb_ptr) {
+    PIXEL_TYPE *fb_ptr1 = fb_ptr + SCANWIDTH;
+    const uint32x4_t mask = vdupq_n_u32(HALF_MASK(half));
+    const uint32x4_t alpha = vdupq_n_u32(HALF_ALPHA(half));
+    const int32x4_t shift = vdupq_n_s32(half ? -1 : 0);
+
+    unsigned int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        uint32x4_t color0 = vdupq_n_u32(table[indices[i+0]]);
+        color0 = vsetq_lane_u32(table[indices[i+1]], color0, 1);
+        color0 = vsetq_lane_u32(table[indices[i+2]], color0, 2);
+        color0 = vsetq_lane_u32(table[indices[i+3]], color0, 3);
+        uint32x4_t color1 = vorrq_u32(vshlq_u32(vandq_u32(color0, mask), shift), alpha);
+        vst1q_u32(fb_ptr + i, color0);
+        vst1q_u32(fb_ptr1 + i, color1);
+    }
 
-static void updateFBMonoTV(color_mode_t mode, uint16_t signal, PIXEL_TYPE *fb_ptr) {
-    updateFBCommon(mode, signal, fb_ptr, monoPixelsTV);
+    _ntsc_kernelScalar(table, indices + i, count - i, half, fb_ptr + i);
 }
+#endif
 
-static void updateFBColorTV(color_mode_t mode, uint16_t signal, PIXEL_TYPE *fb_ptr) {
-    updateFBCommon(mode, signal, fb_ptr, colorPixelsTV[ntsc_color_phase]);
+static void _ntsc_plotPixels(color_mode_t mode, const uint16_t *bits14, unsigned int count, unsigned int npixels, PIXEL_TYPE *fb_ptr) {
+    assert(npixels <= NTSC_SPAN_PIXELS);
+    uint32_t indices[NTSC_SPAN_PIXELS];
+    _ntsc_signalIndices(mode, bits14, count, npixels, indices);
+    kernels[ntsc_kernel](pixelTable[mode], indices, npixels, half_scanlines, fb_ptr);
 }
 
 // ----------------------------------------------------------------------------
-// Monitor pixel updates
 
-static PIXEL_TYPE halfScanlineMonitor(PIXEL_TYPE color0, PIXEL_TYPE color2) {
-    (void)color2;
-    PIXEL_TYPE color1 = ((color0 & 0xFEFEFEFE) >> 1) | (0xFF << SHIFT_A);
-    return color1;
+void ntsc_plotSpan(color_mode_t mode, const uint16_t *bits14, unsigned int count, PIXEL_TYPE *fb_ptr) {
+    assert(!(mode == COLOR_MODE_COLOR || mode == COLOR_MODE_INTERP));
+    assert(count <= CYCLES_VIS);
+    _ntsc_plotPixels(mode, bits14, count, count * 14, fb_ptr);
+}
+
+void ntsc_plotBits(color_mode_t mode, uint16_t bits14, PIXEL_TYPE *fb_ptr) {
+    ntsc_plotSpan(mode, &bits14, 1, fb_ptr);
+}
+
+void ntsc_flushScanline(color_mode_t mode, PIXEL_TYPE *fb_ptr) {
+    static const uint16_t zero = 0x0;
+    _ntsc_plotPixels(mode, &zero, 1, 4, fb_ptr);
+
+    ntsc_color_phase = 0;
+    ntsc_signal_bits = 0;
 }
 
-static PIXEL_TYPE doubleScanlineMonitor(PIXEL_TYPE color0, PIXEL_TYPE color2) {
-    (void)color2;
-    return color0;
+static bool _ntsc_kernelSupported(ntsc_kernel_t kernel) {
+    if (kernel >= NUM_NTSC_KERNELS || !kernels[kernel]) {
+        return false;
+    }
+#if NTSC_X86_KERNELS
+    __builtin_cpu_init();
+    if (kernel == NTSC_KERNEL_SSE2) {
+        return __builtin_cpu_supports("sse2");
+    }
+    if (kernel == NTSC_KERNEL_AVX2) {
+        return __builtin_cpu_supports("avx2");
+    }
+#endif
+    return true;
 }
 
-static void updateFBMonoMonitor(color_mode_t mode, uint16_t signal, PIXEL_TYPE *fb_ptr) {
-    updateFBCommon(mode, signal, fb_ptr, monoPixelsMonitor);
+bool ntsc_setKernel(ntsc_kernel_t kernel) {
+    if (!_ntsc_kernelSupported(kernel)) {
+        return false;
+    }
+    ntsc_kernel = kernel;
+    return true;
 }
 
-static void updateFBColorMonitor(color_mode_t mode, uint16_t signal, PIXEL_TYPE *fb_ptr) {
-    updateFBCommon(mode, signal, fb_ptr, colorPixelsMonitor[ntsc_color_phase]);
+ntsc_kernel_t ntsc_getKernel(void) {
+    return ntsc_kernel;
 }
 
 // ----------------------------------------------------------------------------
+// Benchmark
 
-void ntsc_plotBits(color_mode_t mode, uint16_t bits14, PIXEL_TYPE *fb_ptr) {
-    assert(!(mode == COLOR_MODE_COLOR || mode == COLOR_MODE_INTERP));
+#define NTSC_BENCH_ITERATIONS 20000
 
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr); bits14 >>= 1; ++fb_ptr;
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr); bits14 >>= 1; ++fb_ptr;
+static unsigned long _ntsc_bench(color_mode_t mode, const uint16_t *bits14, bool perColumn, PIXEL_TYPE *fb) {
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (unsigned int i = 0; i < NTSC_BENCH_ITERATIONS; i++) {
+        if (perColumn) {
+            for (unsigned int col = 0; col < CYCLES_VIS; col++) {
+                ntsc_plotBits(mode, bits14[col], fb + (col * FONT_WIDTH_PIXELS));
+            }
+        } else {
+            ntsc_plotSpan(mode, bits14, CYCLES_VIS, fb);
+        }
+        ntsc_flushScanline(mode, fb + _SCANWIDTH);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    struct timespec dt = timespec_diff(t0, t1, NULL);
+    return (dt.tv_sec * NANOSECONDS_PER_SECOND + dt.tv_nsec) / 1000;
+}
 
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr); bits14 >>= 1; ++fb_ptr;
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr); bits14 >>= 1; ++fb_ptr;
+void ntsc_benchmark(FILE *out) {
+    static PIXEL_TYPE fb[SCANWIDTH<<1];
+
+    uint16_t bits14[CYCLES_VIS];
+    for (unsigned int col = 0; col < CYCLES_VIS; col++) {
+        bits14[col] = (uint16_t)(random() & 0x3FFF);
+    }
 
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr); bits14 >>= 1; ++fb_ptr;
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr); bits14 >>= 1; ++fb_ptr;
+    ntsc_kernel_t savedKernel = ntsc_kernel;
+    const color_mode_t modes[] = { COLOR_MODE_MONO, COLOR_MODE_COLOR_MONITOR, COLOR_MODE_MONO_TV, COLOR_MODE_COLOR_TV };
 
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr); bits14 >>= 1; ++fb_ptr;
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr); bits14 >>= 1; ++fb_ptr;
+    for (unsigned int m = 0; m < sizeof(modes)/sizeof(modes[0]); m++) {
+        color_mode_t mode = modes[m];
 
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr); bits14 >>= 1; ++fb_ptr;
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr); bits14 >>= 1; ++fb_ptr;
+        ntsc_setKernel(NTSC_KERNEL_SCALAR);
+        unsigned long usecsColumn = _ntsc_bench(mode, bits14, /*perColumn:*/true, fb);
 
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr); bits14 >>= 1; ++fb_ptr;
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr); bits14 >>= 1; ++fb_ptr;
+        for (ntsc_kernel_t kernel = NTSC_KERNEL_SCALAR; kernel < NUM_NTSC_KERNELS; kernel++) {
+            if (!ntsc_setKernel(kernel)) {
+                continue;
+            }
+            unsigned long usecsSpan = _ntsc_bench(mode, bits14, /*perColumn:*/false, fb);
+            fprintf(out, "NTSC mode %d kernel %d : %u scanlines in %luus (per-column %luus)\n", mode, kernel, NTSC_BENCH_ITERATIONS, usecsSpan, usecsColumn);
+        }
+    }
 
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr); bits14 >>= 1; ++fb_ptr;
-    pixelPlotter[mode](mode, bits14 & 1, fb_ptr);               ++fb_ptr;
+    ntsc_kernel = savedKernel;
 }
 
-void ntsc_flushScanline(color_mode_t mode, PIXEL_TYPE *fb_ptr) {
+#if TESTING
+// ----------------------------------------------------------------------------
+// Reference plotter : the original per-pixel path (a table lookup and half-scanline color per signal bit) that the
+// span kernels replaced
+
+static void _ntsc_plotPixelReference(color_mode_t mode, unsigned int signal, PIXEL_TYPE *fb_ptr) {
+    ntsc_signal_bits = ((ntsc_signal_bits << 1) | signal) & 0xFFF; // 12-bit ?
+
+    PIXEL_TYPE color0;
+    switch (mode) {
+        case COLOR_MODE_COLOR_MONITOR:
+            color0 = colorPixelsMonitor[ntsc_color_phase][ntsc_signal_bits];
+            break;
+        case COLOR_MODE_MONO_TV:
+            color0 = monoPixelsTV[ntsc_signal_bits];
+            break;
+        case COLOR_MODE_COLOR_TV:
+            color0 = colorPixelsTV[ntsc_color_phase][ntsc_signal_bits];
+            break;
+        default:
+            color0 = monoPixelsMonitor[ntsc_signal_bits];
+            break;
+    }
+    PIXEL_TYPE color1 = half_scanlines ? (((color0 & 0xFEFEFEFE) >> 1) | (0xFFU << SHIFT_A)) : color0;
 
-    pixelPlotter[mode](mode, 0, fb_ptr); ++fb_ptr;
-    pixelPlotter[mode](mode, 0, fb_ptr); ++fb_ptr;
-    pixelPlotter[mode](mode, 0, fb_ptr); ++fb_ptr;
-    pixelPlotter[mode](mode, 0, fb_ptr); ++fb_ptr;
+    fb_ptr[0] = color0;
+    fb_ptr[SCANWIDTH] = color1;
+
+    ntsc_color_phase = (ntsc_color_phase + 1) & 0x03;
+}
+
+void ntsc_plotBitsReference(color_mode_t mode, uint16_t bits14, PIXEL_TYPE *fb_ptr) {
+    for (unsigned int i = 0; i < 14; i++) {
+        _ntsc_plotPixelReference(mode, bits14 & 0x1, fb_ptr + i);
+        bits14 >>= 1;
+    }
+}
+
+void ntsc_flushScanlineReference(color_mode_t mode, PIXEL_TYPE *fb_ptr) {
+    for (unsigned int i = 0; i < 4; i++) {
+        _ntsc_plotPixelReference(mode, 0, fb_ptr + i);
+    }
 
     ntsc_color_phase = 0;
     ntsc_signal_bits = 0;
 }
+#endif
 
 //----------------------------------------------------------------------------
 // pixel color creation
@@ -428,6 +587,11 @@ static void ntsc_prefsChanged(const char *domain) {
     bool bVal = false;
     half_scanlines = prefs_parseBoolValue(domain, PREF_SHOW_HALF_SCANLINES, &bVal) ? (bVal ? 1 : 0) : 1;
 
+    lVal = ntsc_bestKernel;
+    if (!prefs_parseLongValue(domain, PREF_NTSC_KERNEL, &lVal, /*base:*/10) || !ntsc_setKernel((ntsc_kernel_t)lVal)) {
+        ntsc_setKernel(ntsc_bestKernel);
+    }
+
     initChromaPhaseTables(color_mode, mono_mode);
 }
 
@@ -435,25 +599,33 @@ static void _init_ntsc(void) {
     LOG("Initializing NTSC renderer");
     initChromaPhaseTables(COLOR_MODE_DEFAULT, MONO_MODE_DEFAULT);
 
-    pixelPlotter[COLOR_MODE_MONO]             = updateFBMonoMonitor;
-    pixelPlotter[COLOR_MODE_COLOR]            = updateFBMonoMonitor;
-    pixelPlotter[COLOR_MODE_INTERP]           = updateFBMonoMonitor;
-    pixelPlotter[COLOR_MODE_COLOR_MONITOR]    = updateFBColorMonitor;
-    pixelPlotter[COLOR_MODE_MONO_TV]          = updateFBMonoTV;
-    pixelPlotter[COLOR_MODE_COLOR_TV]         = updateFBColorTV;
-
-    getHalfColor[COLOR_MODE_MONO][0]          = doubleScanlineMonitor;
-    getHalfColor[COLOR_MODE_MONO][1]          = halfScanlineMonitor;
-    getHalfColor[COLOR_MODE_COLOR][0]         = doubleScanlineMonitor;
-    getHalfColor[COLOR_MODE_COLOR][1]         = halfScanlineMonitor;
-    getHalfColor[COLOR_MODE_INTERP][0]        = doubleScanlineMonitor;
-    getHalfColor[COLOR_MODE_INTERP][1]        = halfScanlineMonitor;
-    getHalfColor[COLOR_MODE_COLOR_MONITOR][0] = doubleScanlineMonitor;
-    getHalfColor[COLOR_MODE_COLOR_MONITOR][1] = halfScanlineMonitor;
-    getHalfColor[COLOR_MODE_MONO_TV][0]       = doubleScanlineTV;
-    getHalfColor[COLOR_MODE_MONO_TV][1]       = halfScanlineTV;
-    getHalfColor[COLOR_MODE_COLOR_TV][0]      = doubleScanlineTV;
-    getHalfColor[COLOR_MODE_COLOR_TV][1]      = halfScanlineTV;
+    pixelTable[COLOR_MODE_MONO]               = &monoPixelsMonitor[0];
+    pixelTable[COLOR_MODE_COLOR]              = &monoPixelsMonitor[0];
+    pixelTable[COLOR_MODE_INTERP]             = &monoPixelsMonitor[0];
+    pixelTable[COLOR_MODE_COLOR_MONITOR]      = &colorPixelsMonitor[0][0];
+    pixelTable[COLOR_MODE_MONO_TV]            = &monoPixelsTV[0];
+    pixelTable[COLOR_MODE_COLOR_TV]           = &colorPixelsTV[0][0];
+
+    phaseStride[COLOR_MODE_COLOR_MONITOR]     = NTSC_NUM_SEQUENCES;
+    phaseStride[COLOR_MODE_COLOR_TV]          = NTSC_NUM_SEQUENCES;
+
+    kernels[NTSC_KERNEL_SCALAR]               = _ntsc_kernelScalar;
+#if NTSC_X86_KERNELS
+    kernels[NTSC_KERNEL_SSE2]                 = _ntsc_kernelSSE2;
+    kernels[NTSC_KERNEL_AVX2]                 = _ntsc_kernelAVX2;
+#endif
+#if NTSC_NEON_KERNEL
+    kernels[NTSC_KERNEL_NEON]                 = _ntsc_kernelNEON;
+#endif
+
+    // prefer the widest kernel this host supports
+    for (ntsc_kernel_t kernel = NTSC_KERNEL_SCALAR; kernel < NUM_NTSC_KERNELS; kernel++) {
+        if (_ntsc_kernelSupported(kernel)) {
+            ntsc_bestKernel = kernel;
+        }
+    }
+    ntsc_setKernel(ntsc_bestKernel);
+    LOG("NTSC kernel : %d", ntsc_bestKernel);
 
     prefs_registerListener(PREF_DOMAIN_VIDEO, &ntsc_prefsChanged);
 }
@@ -14,9 +14,35 @@
 
 #include "common.h"
 
+typedef enum ntsc_kernel_t {
+    NTSC_KERNEL_SCALAR = 0,
+    NTSC_KERNEL_SSE2,
+    NTSC_KERNEL_AVX2,
+    NTSC_KERNEL_NEON,
+    NUM_NTSC_KERNELS,
+} ntsc_kernel_t;
+
+// Plot 14 pixels of signal bits (LSB first) to the scanline row and the half-scanline row below it
 void ntsc_plotBits(color_mode_t mode, uint16_t bits, PIXEL_TYPE *fb_ptr);
 
+// Plot count contiguous columns of 14-bit signal (up to a full 560 pixel scanline) in one pass
+void ntsc_plotSpan(color_mode_t mode, const uint16_t *bits14, unsigned int count, PIXEL_TYPE *fb_ptr);
+
 void ntsc_flushScanline(color_mode_t mode, PIXEL_TYPE *fb_ptr);
 
+// Select the pixel kernel, returns false if the kernel is not supported on this host
+bool ntsc_setKernel(ntsc_kernel_t kernel);
+
+ntsc_kernel_t ntsc_getKernel(void);
+
+// Time plotting a random scanline per-column (ntsc_plotBits) and per-span with each kernel supported on this host
+void ntsc_benchmark(FILE *out);
+
+#if TESTING
+// Original per-pixel plotter, reference output for the kernels
+void ntsc_plotBitsReference(color_mode_t mode, uint16_t bits14, PIXEL_TYPE *fb_ptr);
+void ntsc_flushScanlineReference(color_mode_t mode, PIXEL_TYPE *fb_ptr);
+#endif
+
 #endif /* A2_NTSC_H */
 
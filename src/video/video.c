@@ -30,10 +30,11 @@ static pthread_t render_thread_id = 0;
 
 static eof_node_s *eofs = NULL;
 
-static unsigned int cyclesFrameLast = 0;
-static unsigned int cyclesDirty = CYCLES_FRAME;
-static unsigned long dirty = 0UL;
-static bool reset_scanner = false;
+static VM_LOCAL unsigned int cyclesFrameLast = 0;
+static VM_LOCAL unsigned int cyclesDirty = CYCLES_FRAME;
+static VM_LOCAL unsigned long dirty = 0UL;
+static VM_LOCAL bool reset_scanner = false;
+static VM_LOCAL uint8_t scanlinesDirty[SCANLINES_VIS] = { [0 ... SCANLINES_VIS-1] = 1 }; // render passes still needed
 
 #if VIDEO_TRACING
 static FILE *video_trace_fp = NULL;
@@ -227,26 +228,67 @@ static void _setScannerDirty() {
     assert((cyclesFrameLast + cyclesDirty) % CYCLES_SCANLINE == 0);
 }
 
-void video_setDirty(unsigned long flags) {
-    __sync_fetch_and_or(&dirty, flags);
-    if (flags & A2_DIRTY_FLAG) {
-        ASSERT_ON_CPU_THREAD();
-        SCOPE_TRACE_CPU("video_setDirty ...");
+static void _setScanlinesDirty(unsigned int first, unsigned int count) {
+    // the scanline under the beam may already be partially rendered from the old data, so it needs one more pass
+    unsigned int hCount = cyclesFrameLast % CYCLES_SCANLINE;
+    unsigned int vCount = (cyclesFrameLast / CYCLES_SCANLINE) % SCANLINES_FRAME;
+    assert(first + count <= SCANLINES_VIS);
+    for (unsigned int i = first; i < first + count; i++) {
+        uint8_t passes = ((i == vCount) && (hCount > 0)) ? 2 : 1;
+        if (scanlinesDirty[i] < passes) {
+            scanlinesDirty[i] = passes;
+        }
+    }
+}
 
-        // NOTE without knowing any specific information about the nature of the video update, the scanner needs to render 1.X full frames to make sure we've correct rendered the change ...
-        timing_checkpointCycles();
+static void _setVideoDirty(unsigned int first, unsigned int count) {
+    ASSERT_ON_CPU_THREAD();
+    SCOPE_TRACE_CPU("video_setDirty ...");
 
-        if (cyclesDirty == 0) {
-            unsigned int hCount = cycles_video_frame % CYCLES_SCANLINE;
-            cyclesFrameLast = cycles_video_frame - hCount;
-        }
+    // NOTE : the scanner runs for 1.X full frames to make sure we've correctly rendered the change at the beam position,
+    // but only the scanlines flagged dirty are re-plotted ...
+    timing_checkpointCycles();
+
+    if (cyclesDirty == 0) {
+        unsigned int hCount = cycles_video_frame % CYCLES_SCANLINE;
+        cyclesFrameLast = cycles_video_frame - hCount;
+    }
+
+    cyclesDirty = ((typeof(cyclesDirty))-1);
+    video_scannerUpdate();
+    assert(cyclesFrameLast == cycles_video_frame);
 
-        cyclesDirty = ((typeof(cyclesDirty))-1);
-        video_scannerUpdate();
-        assert(cyclesFrameLast == cycles_video_frame);
+    _setScannerDirty();
+    _setScanlinesDirty(first, count);
+}
 
-        _setScannerDirty();
+void video_setDirty(unsigned long flags) {
+    __sync_fetch_and_or(&dirty, flags);
+    if (flags & A2_DIRTY_FLAG) {
+        // without knowing any specific information about the nature of the video update, all scanlines are dirty
+        _setVideoDirty(0, SCANLINES_VIS);
+    }
+}
+
+void video_setDirtyAddress(drawpage_mode_t mode, uint16_t ea) {
+    unsigned int first = 0;
+    unsigned int count = 0;
+    uint16_t off = 0;
+    if (mode == DRAWPAGE_TEXT) {
+        off = ea & 0x3FF;
+        first = (((off & 0x7F) / 0x28) << 6) + ((off >> 7) << 3); // text row * 8
+        count = 8;
+    } else {
+        off = ea & 0x1FFF;
+        first = (((off & 0x7F) / 0x28) << 6) + (((off >> 7) & 0x7) << 3) + (off >> 10);
+        count = 1;
     }
+    if ((off & 0x7F) >= 0x78) {
+        return; // screen holes are not displayed
+    }
+
+    __sync_fetch_and_or(&dirty, A2_DIRTY_FLAG);
+    _setVideoDirty(first, count);
 }
 
 unsigned long video_clearDirty(unsigned long flags) {
@@ -256,11 +298,64 @@ unsigned long video_clearDirty(unsigned long flags) {
 // ----------------------------------------------------------------------------
 // video scanner & generator routines
 
-static inline uint16_t _getScannerAddress(drawpage_mode_t mode, int page, unsigned int vCount, unsigned int hCount) {
+static inline uint16_t _getScannerRowAddress(drawpage_mode_t mode, int page, unsigned int vCount) {
     uint16_t baseOff = (0x1 << 10) << (mode * 3) << page; // 0x400 or 0x2000 + page
     unsigned int vCount3 = vCount >> ((1 - (mode & 0x1)) * 3); // TEXT:vCount>>3 GRAPHICS:vCount
-    return baseOff + vert_offset[mode][vCount3] + scan_offset[vCount>>6][hCount];
+    return baseOff + vert_offset[mode][vCount3];
+}
+
+static inline uint16_t _getScannerAddress(drawpage_mode_t mode, int page, unsigned int vCount, unsigned int hCount) {
+    return _getScannerRowAddress(mode, page, vCount) + scan_offset[vCount>>6][hCount];
+}
+
+// Gather the aux/main bytes for visible cycles [hBegin, hEnd) of a scanline.  Horizontal offsets are contiguous across
+// the visible portion of a scanline, so this is a straight interleaving copy from one row address.
+static inline void _gatherScanlineSpan(uint8_t *scanline, drawpage_mode_t mode, int page, unsigned int vCount, unsigned int hBegin, unsigned int hEnd) {
+    assert(hBegin >= CYCLES_VIS_BEGIN && hBegin < hEnd && hEnd <= CYCLES_SCANLINE);
+    const uint8_t *offsets = &scan_offset[vCount>>6][0];
+    assert(offsets[hEnd-1] - offsets[hBegin] == (int)(hEnd - 1 - hBegin));
+    uint16_t addr = _getScannerRowAddress(mode, page, vCount) + offsets[hBegin];
+    const uint8_t *aux = &apple_ii_64k[1][addr];
+    const uint8_t *mbd = &apple_ii_64k[0][addr];
+    for (unsigned int i = 0, count = hEnd - hBegin; i < count; i++) {
+        scanline[(i<<1)+0] = aux[i];
+        scanline[(i<<1)+1] = mbd[i];
+    }
+}
+
+#if VIDEO_TRACING
+static void _traceScannerSpan(drawpage_mode_t mode, int page, unsigned int vCount, unsigned int hCount, unsigned int count) {
+    if (!video_trace_fp || !(frameBegin <= frameCount && frameCount <= frameEnd)) {
+        return;
+    }
+    for (unsigned int i = 0; i < count; i++, hCount++) {
+        const bool isVisible = ((hCount >= CYCLES_VIS_BEGIN) && (vCount < SCANLINES_VBL_BEGIN));
+        char *type = isVisible ? "VIS" : "xBL";
+        uint16_t addr = _getScannerAddress(mode, page, vCount, hCount);
+        uint8_t aux = apple_ii_64k[1][addr];
+        uint8_t mbd = apple_ii_64k[0][addr];
+
+        char buf[16] = { 0 };
+
+        uint8_t c = keys_apple2ASCII(mbd, NULL);
+        if (c <= 0x1F || c >= 0x7F) {
+            c = ' ';
+        }
+        snprintf(buf, sizeof(buf), "%c", c);
+        fprintf(video_trace_fp, "%03u %s %04X/0:%02X:%s ", vCount, type, addr, mbd, buf);
+
+        c = keys_apple2ASCII(aux, NULL);
+        if (c <= 0x1F || c >= 0x7F) {
+            c = ' ';
+        }
+        snprintf(buf, sizeof(buf), "%c", c);
+        fprintf(video_trace_fp, "/1:%02X:%s (%lu) ", aux, buf, frameCount);
+
+        vm_printSoftwitches(video_trace_fp, /*output_mem:*/false, /*output_pseudo:*/false);
+        fprintf(video_trace_fp, "%s", "\n");
+    }
 }
+#endif
 
 static drawpage_mode_t _currentMode(unsigned int vCount) {
     // FIXME TODO ... this is currently incorrect in VBL for MIXED
@@ -287,13 +382,14 @@ static void _endOfFrame() {
     cycles_video_frame %= CYCLES_FRAME;
 
     // FLASH counter and keyboard auto-strobe mod-16 counter ...
-    static uint8_t textFlashCounter = 0x0;
+    static VM_LOCAL uint8_t textFlashCounter = 0x0;
     textFlashCounter = (textFlashCounter+1) & 0xf;
     if (textFlashCounter == 0x0) {
         video_flashText();
         if (!(run_args.softswitches & SS_80COL) && (run_args.softswitches & (SS_TEXT|SS_MIXED))) {
             cyclesFrameLast = 0;
             _setScannerDirty();
+            _setScanlinesDirty(0, SCANLINES_VIS);
             assert(cyclesDirty == CYCLES_FRAME);
         }
     }
@@ -312,12 +408,27 @@ static void _endOfFrame() {
     //  - power-up reset timing ...
 }
 
+static void _scannerFrameEvent(void);
+
+// Schedule a scanner update on the last cycle of the current video frame
+static void _scheduleFrameEvent(void) {
+    unsigned int remaining = (cycles_video_frame < CYCLES_FRAME) ? (CYCLES_FRAME - cycles_video_frame) : 1;
+    timing_scheduleEvent(TIMING_EVENT_VIDEO_FRAME, cycles_count_total + remaining, &_scannerFrameEvent);
+}
+
+static void _scannerFrameEvent(void) {
+    video_scannerUpdate();
+    _scheduleFrameEvent();
+}
+
 void video_scannerReset(void) {
     ASSERT_ON_CPU_THREAD();
     assert(cycles_video_frame == 0);
     cyclesFrameLast = 0;
     cyclesDirty = CYCLES_FRAME;
+    memset(scanlinesDirty, 1, sizeof(scanlinesDirty));
     reset_scanner = true;
+    _scheduleFrameEvent();
 }
 
 // Call to advance the video scanner and generator when the following events occur:
@@ -326,9 +437,9 @@ void video_scannerReset(void) {
 //  3: After cpu65_run()
 void video_scannerUpdate(void) {
 
-    static uint8_t scanline[CYCLES_VIS<<1] = { 0 }; // 80 columns of data ...
-    static unsigned int scancol = 0;
-    static unsigned int scanidx = 0;
+    static VM_LOCAL uint8_t scanline[CYCLES_VIS<<1] = { 0 }; // 80 columns of data ...
+    static VM_LOCAL unsigned int scancol = 0;
+    static VM_LOCAL unsigned int scanidx = 0;
 
     ASSERT_ON_CPU_THREAD();
 
@@ -354,68 +465,40 @@ void video_scannerUpdate(void) {
     unsigned int page = video_currentPage(run_args.softswitches);
     drawpage_mode_t mode = _currentMode(vCount);
 
-    uint8_t aux = 0x0;
-    uint8_t mbd = 0x0;
-    uint16_t addr = 0x0;
-
     assert(cycles_video_frame >= cyclesFrameLast);
     unsigned int cyclesCount = cycles_video_frame - cyclesFrameLast;
     cyclesCount = (cyclesCount <= cyclesDirty) ? cyclesCount : cyclesDirty;
 
     SCOPE_TRACE_CPU("video_scannerUpdate : %u", cyclesCount);
 
-    for (unsigned int i=0; i<cyclesCount; i++) {
-        assert(cyclesDirty > 0); // subtract below will not underflow ...
-        const bool isVisible = ((hCount >= CYCLES_VIS_BEGIN) && (vCount < SCANLINES_VBL_BEGIN));
-
-#if VIDEO_TRACING
-        char *type = "xBL";
-#else
-        if (isVisible)
-#endif
-        {
-            addr = _getScannerAddress(mode, page, vCount, hCount);
-            aux = apple_ii_64k[1][addr];
-            mbd = apple_ii_64k[0][addr];
+    // Softswitch changes always flush the scanner first, so mode and page are constant for the duration of this call
+    // (except for MIXED, which is resolved per scanline).  Advance a scanline segment at a time.
+    while (cyclesCount > 0) {
+        unsigned int spanCount = CYCLES_SCANLINE - hCount;
+        if (spanCount > cyclesCount) {
+            spanCount = cyclesCount;
         }
-
-        if (isVisible) {
-#if VIDEO_TRACING
-            type = "VIS";
-#endif
-            unsigned int idx = (scancol<<1)+(scanidx<<1);
-            assert(idx < ((CYCLES_VIS<<1) - 1));
-            scanline[idx+0] = aux;
-            scanline[idx+1] = mbd;
-            ++scanidx;
+        assert(cyclesDirty >= spanCount); // subtract below will not underflow ...
+
+        if (vCount < SCANLINES_VBL_BEGIN) {
+            unsigned int visBegin = (hCount >= CYCLES_VIS_BEGIN) ? hCount : CYCLES_VIS_BEGIN;
+            unsigned int visEnd = hCount + spanCount;
+            if (visEnd > visBegin) {
+                unsigned int idx = (scancol<<1)+(scanidx<<1);
+                assert(idx + ((visEnd - visBegin)<<1) <= (CYCLES_VIS<<1));
+                _gatherScanlineSpan(&scanline[idx], mode, page, vCount, visBegin, visEnd);
+                scanidx += visEnd - visBegin;
+            }
         }
 
 #if VIDEO_TRACING
-        if (video_trace_fp && (frameBegin <= frameCount && frameCount <= frameEnd)) {
-            char buf[16] = { 0 };
-
-            uint8_t c = keys_apple2ASCII(mbd, NULL);
-            if (c <= 0x1F || c >= 0x7F) {
-                c = ' ';
-            }
-            snprintf(buf, sizeof(buf), "%c", c);
-            fprintf(video_trace_fp, "%03u %s %04X/0:%02X:%s ", vCount, type, addr, mbd, buf);
-
-            c = keys_apple2ASCII(aux, NULL);
-            if (c <= 0x1F || c >= 0x7F) {
-                c = ' ';
-            }
-            snprintf(buf, sizeof(buf), "%c", c);
-            fprintf(video_trace_fp, "/1:%02X:%s (%lu) ", aux, buf, frameCount);
-
-            vm_printSoftwitches(video_trace_fp, /*output_mem:*/false, /*output_pseudo:*/false);
-            fprintf(video_trace_fp, "%s", "\n");
-        }
+        _traceScannerSpan(mode, page, vCount, hCount, spanCount);
 #endif
 
-        ++hCount;
-        ++cyclesFrameLast;
-        --cyclesDirty;
+        hCount += spanCount;
+        cyclesFrameLast += spanCount;
+        cyclesDirty -= spanCount;
+        cyclesCount -= spanCount;
 
         if (hCount == CYCLES_SCANLINE) {
 
@@ -423,7 +506,10 @@ void video_scannerUpdate(void) {
                 // complete scanline flush ...
                 unsigned int scanend = scancol+scanidx;
                 assert(scanend == CYCLES_VIS);
-                _flushScanline(scanline, /*scanrow:*/vCount, scancol, scanend);
+                if (scanlinesDirty[vCount]) {
+                    --scanlinesDirty[vCount];
+                    _flushScanline(scanline, /*scanrow:*/vCount, scancol, scanend);
+                }
             }
 
             // begin new scanline ...
@@ -451,7 +537,9 @@ void video_scannerUpdate(void) {
         // incomplete scanline flush ...
         unsigned int scanend = scancol+scanidx;
         assert(scanend < CYCLES_VIS);
-        _flushScanline(scanline, /*scanrow:*/vCount, scancol, scanend);
+        if (scanlinesDirty[vCount]) {
+            _flushScanline(scanline, /*scanrow:*/vCount, scancol, scanend);
+        }
         scancol = scanend;
         scanidx = 0;
     }
@@ -546,7 +634,9 @@ bool video_saveState(StateHelper_s *helper) {
         if (!helper->save(fd, &state, 1)) {
             break;
         }
-        LOG("SAVE (no-op) video__current_page = %02x", state);
+        if (!helper->isRewind) {
+            LOG("SAVE (no-op) video__current_page = %02x", state);
+        }
 
         saved = true;
     } while (0);
@@ -156,6 +156,12 @@ void video_scannerReset(void);
  */
 void video_scannerUpdate(void) CALL_ON_CPU_THREAD;
 
+/*
+ * Called from the video memory write handlers when a displayed byte of the text/lores (DRAWPAGE_TEXT) or hires
+ * (DRAWPAGE_HIRES) page changes.  Like video_setDirty(A2_DIRTY_FLAG), but only the scanlines showing ea are re-rendered
+ */
+void video_setDirtyAddress(drawpage_mode_t mode, uint16_t ea) CALL_ON_CPU_THREAD;
+
 /*
  * Get current video scanner address
  */
@@ -0,0 +1,218 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+#include "common.h"
+
+typedef struct vmpool_worker_s {
+    struct vmpool_s *pool;
+    unsigned int instance;
+    pthread_t thread_id;
+    unsigned long result;
+} vmpool_worker_s;
+
+struct vmpool_s {
+    unsigned int count;
+    vmpool_worker_s *workers;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+
+    unsigned long generation;   // bumped for each dispatch
+    unsigned int pending;       // workers not yet finished with the current generation
+    vmpool_fn fn;
+    void *ctx;
+    bool quit;
+};
+
+// Backend selection, audio init and disk ejection touch process-wide state, so instances begin/end one at a time
+static pthread_mutex_t lifecycle_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t prepare_once = PTHREAD_ONCE_INIT;
+
+// ----------------------------------------------------------------------------
+
+static void _vmpool_finished(vmpool_s *pool) {
+    pthread_mutex_lock(&pool->mutex);
+    assert(pool->pending > 0);
+    if (--pool->pending == 0) {
+        pthread_cond_signal(&pool->done_cond);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+static void *_vmpool_thread(void *arg) {
+    vmpool_worker_s *worker = (vmpool_worker_s *)arg;
+    vmpool_s *pool = worker->pool;
+
+    pthread_mutex_lock(&lifecycle_mutex);
+    timing_headlessBegin();
+    pthread_mutex_unlock(&lifecycle_mutex);
+
+    unsigned long generation = 0;
+    _vmpool_finished(pool);
+
+    for (;;) {
+        pthread_mutex_lock(&pool->mutex);
+        while (!pool->quit && pool->generation == generation) {
+            pthread_cond_wait(&pool->work_cond, &pool->mutex);
+        }
+        bool quit = pool->quit;
+        generation = pool->generation;
+        vmpool_fn fn = pool->fn;
+        void *ctx = pool->ctx;
+        pthread_mutex_unlock(&pool->mutex);
+
+        if (quit) {
+            break;
+        }
+
+        fn(worker->instance, ctx);
+        _vmpool_finished(pool);
+    }
+
+    pthread_mutex_lock(&lifecycle_mutex);
+    timing_headlessEnd();
+    pthread_mutex_unlock(&lifecycle_mutex);
+
+    return NULL;
+}
+
+static void _vmpool_wait(vmpool_s *pool) {
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->done_cond, &pool->mutex);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+static void _vmpool_runCycles(unsigned int instance, void *ctx) {
+    vmpool_s *pool = (vmpool_s *)ctx;
+    vmpool_worker_s *worker = &pool->workers[instance];
+    worker->result = timing_headlessRunCycles(worker->result);
+}
+
+static void _vmpool_runFrames(unsigned int instance, void *ctx) {
+    vmpool_s *pool = (vmpool_s *)ctx;
+    vmpool_worker_s *worker = &pool->workers[instance];
+    worker->result = timing_headlessRunFrames(worker->result);
+}
+
+static unsigned long _vmpool_run(vmpool_s *pool, vmpool_fn fn, unsigned long count) {
+    for (unsigned int i = 0; i < pool->count; i++) {
+        pool->workers[i].result = count;
+    }
+    vmpool_dispatch(pool, fn, pool);
+
+    unsigned long total = 0;
+    for (unsigned int i = 0; i < pool->count; i++) {
+        total += pool->workers[i].result;
+    }
+    return total;
+}
+
+// ----------------------------------------------------------------------------
+
+vmpool_s *vmpool_create(unsigned int count, vmpool_fn setup, void *ctx) {
+    if (count == 0) {
+        return NULL;
+    }
+#if !VM_MULTI_INSTANCE
+    if (count > 1) {
+        LOG("vmpool : cannot create %u instances, build with VM_MULTI_INSTANCE=1", count);
+        return NULL;
+    }
+#endif
+
+    pthread_once(&prepare_once, &emulator_prepareHeadless);
+
+    vmpool_s *pool = CALLOC(1, sizeof(vmpool_s));
+    vmpool_worker_s *workers = CALLOC(count, sizeof(vmpool_worker_s));
+    if (!pool || !workers) {
+        LOG("vmpool : OOM");
+        FREE(pool);
+        FREE(workers);
+        return NULL;
+    }
+
+    pool->count = count;
+    pool->workers = workers;
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->work_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+
+    pool->pending = count;
+    for (unsigned int i = 0; i < count; i++) {
+        workers[i].pool = pool;
+        workers[i].instance = i;
+        int err = TEMP_FAILURE_RETRY(pthread_create(&workers[i].thread_id, NULL, &_vmpool_thread, &workers[i]));
+        assert(!err);
+    }
+    _vmpool_wait(pool);
+
+    LOG("vmpool : created %u instances", count);
+
+    if (setup) {
+        vmpool_dispatch(pool, setup, ctx);
+    }
+
+    return pool;
+}
+
+void vmpool_destroy(vmpool_s **pool) {
+    if (!pool || !*pool) {
+        return;
+    }
+
+    vmpool_s *p = *pool;
+
+    pthread_mutex_lock(&p->mutex);
+    p->quit = true;
+    pthread_cond_broadcast(&p->work_cond);
+    pthread_mutex_unlock(&p->mutex);
+
+    for (unsigned int i = 0; i < p->count; i++) {
+        pthread_join(p->workers[i].thread_id, NULL);
+    }
+
+    pthread_cond_destroy(&p->done_cond);
+    pthread_cond_destroy(&p->work_cond);
+    pthread_mutex_destroy(&p->mutex);
+
+    FREE(p->workers);
+    FREE(*pool);
+}
+
+unsigned int vmpool_count(const vmpool_s *pool) {
+    return pool->count;
+}
+
+void vmpool_dispatch(vmpool_s *pool, vmpool_fn fn, void *ctx) {
+    assert(fn);
+
+    pthread_mutex_lock(&pool->mutex);
+    assert(pool->pending == 0);
+    pool->fn = fn;
+    pool->ctx = ctx;
+    pool->pending = pool->count;
+    ++pool->generation;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->mutex);
+
+    _vmpool_wait(pool);
+}
+
+unsigned long vmpool_runCycles(vmpool_s *pool, unsigned long cycles) {
+    return _vmpool_run(pool, &_vmpool_runCycles, cycles);
+}
+
+unsigned long vmpool_runFrames(vmpool_s *pool, unsigned long frames) {
+    return _vmpool_run(pool, &_vmpool_runFrames, frames);
+}
@@ -0,0 +1,64 @@
+/*
+ * Apple // emulator for *ix
+ *
+ * This software package is subject to the GNU General Public License
+ * version 3 or later (your choice) as published by the Free Software
+ * Foundation.
+ *
+ * Copyright 2013-2015 Aaron Culliney
+ *
+ */
+
+/*
+ * Pool of independent headless emulator instances.
+ *
+ * Each instance is bound to its own worker thread for its entire lifetime (machine state is thread-local in a
+ * VM_MULTI_INSTANCE build) and is driven with the timing_headless*() API.  Work is dispatched to all instances
+ * concurrently and the dispatching thread blocks until every instance has finished.
+ *
+ * Without VM_MULTI_INSTANCE there is only one machine per process, so only pools of a single instance may be created.
+ */
+
+#ifndef _VM_POOL_H_
+#define _VM_POOL_H_
+
+#include "common.h"
+
+typedef struct vmpool_s vmpool_s;
+
+// Invoked on an instance's worker (CPU) thread, with the instance index and the caller's context
+typedef void (*vmpool_fn)(unsigned int instance, void *ctx);
+
+/*
+ * Create a pool of count instances, each begun in headless mode on its own thread.  Emulator ctors and prefs are
+ * loaded if not already done.  The optional setup function is called once per instance (e.g. to insert disks).
+ * Returns NULL on failure.
+ */
+vmpool_s *vmpool_create(unsigned int count, vmpool_fn setup, void *ctx);
+
+/*
+ * Tear down all instances and free the pool.
+ */
+void vmpool_destroy(vmpool_s **pool);
+
+/*
+ * Count of instances in the pool.
+ */
+unsigned int vmpool_count(const vmpool_s *pool);
+
+/*
+ * Run fn on every instance concurrently and wait for all to complete.
+ */
+void vmpool_dispatch(vmpool_s *pool, vmpool_fn fn, void *ctx);
+
+/*
+ * Run every instance for (at least) the specified count of 65c02 cycles.  Returns the sum of cycles executed.
+ */
+unsigned long vmpool_runCycles(vmpool_s *pool, unsigned long cycles);
+
+/*
+ * Run every instance for the specified count of video frames.  Returns the sum of cycles executed.
+ */
+unsigned long vmpool_runFrames(vmpool_s *pool, unsigned long frames);
+
+#endif // whole file
@@ -13,11 +13,9 @@
 
 extern const uint8_t apple_iie_rom[32768]; // rom.c
 
-uint8_t apple_ii_64k[2][65536] = { { 0 } };
-uint8_t language_card[2][8192] = { { 0 } };
-uint8_t language_banks[2][8192] = { { 0 } };
-
-const uint8_t *base_vmem = apple_ii_64k[0];
+VM_LOCAL uint8_t apple_ii_64k[2][65536] = { { 0 } };
+VM_LOCAL uint8_t language_card[2][8192] = { { 0 } };
+VM_LOCAL uint8_t language_banks[2][8192] = { { 0 } };
 
 #if VM_TRACING
 FILE *test_vm_fp = NULL;
@@ -63,7 +61,6 @@ GLUE_C_READ(iie_read_peripheral_card)
         case 0x1:
         case 0x2:
         case 0x3:
-        case 0x7:
             break;
 
         case 0x4:
@@ -75,6 +72,10 @@ GLUE_C_READ(iie_read_peripheral_card)
             return apple_ii_64k[0][ea];
             break;
 
+        case HDD_SLOT:
+            return hdd_romRead(ea);
+            break;
+
         default:
             assert(false && "internal configuration error!");
             break;
@@ -235,7 +236,7 @@ GLUE_C_WRITE(video__write_2e_text0)
         if (!(run_args.softswitches & SS_PAGE2)) {
             uint8_t b0 = run_args.base_textwrt[ea];
             if (b0 != b) {
-                video_setDirty(A2_DIRTY_FLAG);
+                video_setDirtyAddress(DRAWPAGE_TEXT, ea);
             }
         }
     } while (0);
@@ -252,7 +253,7 @@ GLUE_C_WRITE(video__write_2e_text0_mixed)
         if (!(run_args.softswitches & SS_PAGE2)) {
             uint8_t b0 = run_args.base_textwrt[ea];
             if (b0 != b) {
-                video_setDirty(A2_DIRTY_FLAG);
+                video_setDirtyAddress(DRAWPAGE_TEXT, ea);
             }
         }
     } while (0);
@@ -269,7 +270,7 @@ GLUE_C_WRITE(video__write_2e_text1)
         if ((run_args.softswitches & SS_PAGE2) && !(run_args.softswitches & SS_80STORE)) {
             uint8_t b0 = run_args.base_ramwrt[ea];
             if (b0 != b) {
-                video_setDirty(A2_DIRTY_FLAG);
+                video_setDirtyAddress(DRAWPAGE_TEXT, ea);
             }
         }
     } while (0);
@@ -286,7 +287,7 @@ GLUE_C_WRITE(video__write_2e_text1_mixed)
         if ((run_args.softswitches & SS_PAGE2) && !(run_args.softswitches & SS_80STORE)) {
             uint8_t b0 = run_args.base_ramwrt[ea];
             if (b0 != b) {
-                video_setDirty(A2_DIRTY_FLAG);
+                video_setDirtyAddress(DRAWPAGE_TEXT, ea);
             }
         }
     } while (0);
@@ -303,7 +304,7 @@ GLUE_C_WRITE(video__write_2e_hgr0)
         if (!(run_args.softswitches & SS_PAGE2)) {
             uint8_t b0 = run_args.base_hgrwrt[ea];
             if (b0 != b) {
-                video_setDirty(A2_DIRTY_FLAG);
+                video_setDirtyAddress(DRAWPAGE_HIRES, ea);
             }
         }
     } while (0);
@@ -320,7 +321,7 @@ GLUE_C_WRITE(video__write_2e_hgr0_mixed)
         if (!(run_args.softswitches & SS_PAGE2)) {
             uint8_t b0 = run_args.base_hgrwrt[ea];
             if (b0 != b) {
-                video_setDirty(A2_DIRTY_FLAG);
+                video_setDirtyAddress(DRAWPAGE_HIRES, ea);
             }
         }
     } while (0);
@@ -337,7 +338,7 @@ GLUE_C_WRITE(video__write_2e_hgr1)
         if ((run_args.softswitches & SS_PAGE2) && !(run_args.softswitches & SS_80STORE)) {
             uint8_t b0 = run_args.base_ramwrt[ea];
             if (b0 != b) {
-                video_setDirty(A2_DIRTY_FLAG);
+                video_setDirtyAddress(DRAWPAGE_HIRES, ea);
             }
         }
     } while (0);
@@ -354,7 +355,7 @@ GLUE_C_WRITE(video__write_2e_hgr1_mixed)
         if ((run_args.softswitches & SS_PAGE2) && !(run_args.softswitches & SS_80STORE)) {
             uint8_t b0 = run_args.base_ramwrt[ea];
             if (b0 != b) {
-                video_setDirty(A2_DIRTY_FLAG);
+                video_setDirtyAddress(DRAWPAGE_HIRES, ea);
             }
         }
     } while (0);
@@ -1102,6 +1103,12 @@ GLUE_C_READ(read_softswitch)
         return disk6_ioRead(ea);
     }
 
+    if (sw >= 0xF0) {
+        // hard disk registers
+        // 0xC0Xi : X = slot 0x7 + 0x8 == 0xF
+        return hdd_ioRead(ea);
+    }
+
     return floating_bus();
 }
 
@@ -1394,6 +1401,70 @@ static void _initialize_apple_ii_memory(void) {
     apple_ii_64k[1][0xC000] = 0x00;
 }
 
+// Default page read handlers (and their direct-access base offsets) before any vm_setReadHandler() override
+static VM_LOCAL void *vmem_r_default[256] = { 0 };
+static VM_LOCAL uint8_t vmem_rbase_default[256] = { 0 };
+
+// C entry points of the video page write handlers, for vm_writeByte()
+static VM_LOCAL void (*vmem_w_c[256])(uint16_t, uint8_t) = { 0 };
+
+// Pages backed by a plain bank read/write (no side effects) are accessed directly from host memory by the CPU core.
+// Keying on the run_args base pointer (rather than a host address) keeps this in sync with RAMRD/RAMWRT/ALTZP/80STORE
+// and language card bank switches without any per-softswitch bookkeeping.
+static void _initialize_direct_tables(void) {
+    for (unsigned int i = 0; i < 0x100; i++) {
+        void *fn = cpu65_vmem_r[i];
+        uint8_t off = 0;
+        if (fn == iie_read_ram_default) {
+            off = offsetof(cpu65_run_args_s, base_ramrd);
+        } else if (fn == iie_read_ram_zpage_and_stack) {
+            off = offsetof(cpu65_run_args_s, base_stackzp);
+        } else if (fn == iie_read_ram_text_page0) {
+            off = offsetof(cpu65_run_args_s, base_textrd);
+        } else if (fn == iie_read_ram_hires_page0) {
+            off = offsetof(cpu65_run_args_s, base_hgrrd);
+        } else if (fn == read_ram_bank) {
+            off = offsetof(cpu65_run_args_s, base_d000_rd);
+        } else if (fn == read_ram_lc) {
+            off = offsetof(cpu65_run_args_s, base_e000_rd);
+        }
+        cpu65_vmem_rbase[i] = off;
+
+        fn = cpu65_vmem_w[i];
+        off = 0;
+        if (fn == iie_write_ram_default) {
+            off = offsetof(cpu65_run_args_s, base_ramwrt);
+        } else if (fn == iie_write_ram_zpage_and_stack) {
+            off = offsetof(cpu65_run_args_s, base_stackzp);
+        } else if (fn == write_ram_bank) {
+            off = offsetof(cpu65_run_args_s, base_d000_wrt);
+        } else if (fn == write_ram_lc) {
+            off = offsetof(cpu65_run_args_s, base_e000_wrt);
+        }
+        cpu65_vmem_wbase[i] = off;
+
+        void (*wc)(uint16_t, uint8_t) = NULL;
+        if (fn == video__write_2e_text0) {
+            wc = c_video__write_2e_text0;
+        } else if (fn == video__write_2e_text0_mixed) {
+            wc = c_video__write_2e_text0_mixed;
+        } else if (fn == video__write_2e_text1) {
+            wc = c_video__write_2e_text1;
+        } else if (fn == video__write_2e_text1_mixed) {
+            wc = c_video__write_2e_text1_mixed;
+        } else if (fn == video__write_2e_hgr0) {
+            wc = c_video__write_2e_hgr0;
+        } else if (fn == video__write_2e_hgr0_mixed) {
+            wc = c_video__write_2e_hgr0_mixed;
+        } else if (fn == video__write_2e_hgr1) {
+            wc = c_video__write_2e_hgr1;
+        } else if (fn == video__write_2e_hgr1_mixed) {
+            wc = c_video__write_2e_hgr1_mixed;
+        }
+        vmem_w_c[i] = wc;
+    }
+}
+
 static void _initialize_tables(void) {
 
     for (unsigned int i = 0; i < 0x100; i++) {
@@ -1477,7 +1548,7 @@ static void _initialize_tables(void) {
     cpu65_vmem_r[0xC4] = iie_read_slot4; // slot 4 - MB or Phasor
     cpu65_vmem_r[0xC5] = iie_read_slot5; // slot 5 - MB #2
     cpu65_vmem_r[0xC6] = iie_read_slotx; // slots 6
-    cpu65_vmem_r[0xC7] = iie_read_slotx; // slots 7
+    cpu65_vmem_r[0xC7] = iie_read_slotx; // slot 7 - ProDOS hard disk
 
     for (unsigned int i = 0xC8; i < 0xD0; i++) {
         cpu65_vmem_r[i] = iie_read_slot_expansion;
@@ -1491,6 +1562,48 @@ static void _initialize_tables(void) {
 //if (mockingboard_inserted) {
     mb_io_initialize(4, 5); /* Mockingboard(s) and/or Phasor in slots 4 & 5 */
 //}
+
+    _initialize_direct_tables();
+
+    memcpy(vmem_r_default, cpu65_vmem_r, sizeof(vmem_r_default));
+    memcpy(vmem_rbase_default, cpu65_vmem_rbase, sizeof(vmem_rbase_default));
+}
+
+uint8_t vm_readByte(uint16_t ea) {
+    uint8_t off = vmem_rbase_default[ea>>8];
+    if (!off) {
+        return floating_bus();
+    }
+    uint8_t *base = *(uint8_t **)((uint8_t *)&run_args + off);
+    return base[ea];
+}
+
+void vm_writeByte(uint16_t ea, uint8_t b) {
+    uint8_t off = cpu65_vmem_wbase[ea>>8];
+    if (off) {
+        uint8_t *base = *(uint8_t **)((uint8_t *)&run_args + off);
+        if (base) {
+            base[ea] = b;
+        }
+    } else if (vmem_w_c[ea>>8]) {
+        vmem_w_c[ea>>8](ea, b);
+    }
+}
+
+void vm_setReadHandler(uint8_t page, void *handler) {
+    assert(vmem_r_default[page] && "VM tables should be initialized");
+    assert(vmem_rbase_default[page] && "only plain RAM/ROM pages may be intercepted");
+
+    if (!handler) {
+        handler = vmem_r_default[page];
+    }
+
+    // the CPU may be running : disable direct access before swapping the handler, and restore it after
+    cpu65_vmem_rbase[page] = 0;
+    cpu65_vmem_r[page] = handler;
+    if (handler == vmem_r_default[page]) {
+        cpu65_vmem_rbase[page] = vmem_rbase_default[page];
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -1504,6 +1617,10 @@ void vm_initialize(void) {
     joystick_reset();
 }
 
+bool vm_tablesInitialized(void) {
+    return vmem_r_default[0] != NULL;
+}
+
 bool vm_saveState(StateHelper_s *helper) {
     bool saved = false;
     int fd = helper->fd;
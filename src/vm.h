@@ -117,14 +117,26 @@
 #if !defined(__ASSEMBLER__)
 
 // 128k bank-switched main memory
-extern uint8_t apple_ii_64k[2][65536];
+extern VM_LOCAL uint8_t apple_ii_64k[2][65536];
 
 // language card memory and settings
-extern uint8_t language_card[2][8192];
-extern uint8_t language_banks[2][8192];
+extern VM_LOCAL uint8_t language_card[2][8192];
+extern VM_LOCAL uint8_t language_banks[2][8192];
 
 void vm_initialize(void);
 
+// True once vm_initialize() has set up the memory tables (page handlers may then be swapped)
+bool vm_tablesInitialized(void);
+
+// Read/write the 64K address space as the CPU currently sees it (bank switches, video dirty tracking) on behalf of a
+// peripheral transferring memory directly.  I/O pages ($C000-$CFFF) are not accessible this way.
+uint8_t vm_readByte(uint16_t ea) CALL_ON_CPU_THREAD;
+void vm_writeByte(uint16_t ea, uint8_t b) CALL_ON_CPU_THREAD;
+
+// Route all reads (including instruction fetches) of a plain RAM/ROM page through a GLUE_C_READ handler, or restore
+// the default bank read with NULL.  The handler should return vm_readByte(ea) for accesses it does not intercept.
+void vm_setReadHandler(uint8_t page, void *handler);
+
 extern bool vm_saveState(StateHelper_s *helper);
 extern bool vm_loadState(StateHelper_s *helper);
 
@@ -54,6 +54,7 @@
 #   define addLQ            addq
 #   define andLQ            andq
 #   define callLQ           callq
+#   define cmpLQ            cmpq
 #   define decLQ            decq
 #   define leaLQ            leaq
 #   define orLQ             orq
@@ -92,6 +93,7 @@
 #   define addLQ            addl
 #   define andLQ            andl
 #   define callLQ           calll
+#   define cmpLQ            cmpl
 #   define decLQ            decl
 #   define leaLQ            leal
 #   define orLQ             orl
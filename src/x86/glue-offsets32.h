@@ -51,3 +51,10 @@
 #define JOY_BUTTON0 158
 #define JOY_BUTTON1 159
 #define EMUL_REINITIALIZE 160
+#define CPU65_HALTED 161
+#define CPU65_OPERAND 162
+#define CPU65_VMEM_RBASE 164
+#define CPU65__OPBYTES 168
+#define CPU65_VMEM_WBASE 172
+#define CPU65_HALTMAP 176
+#define CPU65_PROFILE 180
@@ -490,3 +490,34 @@ const char *zlib_deflate_buffer(const uint8_t *src, const unsigned int src_bytes
     return err;
 }
 
+
+/* Compress a small source buffer into destination buffer of *dst_bytescount capacity (raw zlib stream, no gzip
+ * header).
+ *
+ * Return NULL on success (with *dst_bytescount set to compressed length), or error string from zlib on failure.
+ */
+const char *zlib_compress_chunk(const uint8_t *src, const unsigned int src_bytescount, uint8_t *dst, INOUT unsigned int *dst_bytescount) {
+    uLongf dst_len = *dst_bytescount;
+    int ret = compress2(dst, &dst_len, src, src_bytescount, Z_BEST_SPEED);
+    if (ret != Z_OK) {
+        return zError(ret);
+    }
+    *dst_bytescount = (unsigned int)dst_len;
+    return NULL;
+}
+
+/* Uncompress a raw zlib stream into destination buffer of exactly expected_bytescount length.
+ *
+ * Return NULL on success, or error string (possibly from zlib) on failure.
+ */
+const char *zlib_uncompress_chunk(const uint8_t *src, const unsigned int src_bytescount, uint8_t *dst, const unsigned int expected_bytescount) {
+    uLongf dst_len = expected_bytescount;
+    int ret = uncompress(dst, &dst_len, src, src_bytescount);
+    if (ret != Z_OK) {
+        return zError(ret);
+    }
+    if (dst_len != expected_bytescount) {
+        return ZERR_UNKNOWN;
+    }
+    return NULL;
+}
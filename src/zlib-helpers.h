@@ -32,4 +32,8 @@ const char *zlib_inflate_inplace(int fd, const unsigned int expected_bytescount,
 // Deflate/compress from buffer to buffer.  This is meant for ejecting read/write disk images.
 const char *zlib_deflate_buffer(const uint8_t *src, const unsigned int src_bytescount, uint8_t *dst, OUTPARM off_t *dst_size);
 
+// Compress/uncompress small in-memory buffers (raw zlib streams).  This is meant for save-state chunks.
+const char *zlib_compress_chunk(const uint8_t *src, const unsigned int src_bytescount, uint8_t *dst, INOUT unsigned int *dst_bytescount);
+const char *zlib_uncompress_chunk(const uint8_t *src, const unsigned int src_bytescount, uint8_t *dst, const unsigned int expected_bytescount);
+
 #endif